@@ -30,6 +30,15 @@ else()
 		NAMES sundials_kinsol
 	)
 
+	# Only available if sundials has been built with KLU support
+	find_library(SUNDIALS_SUNLINSOLKLU_LIBRARY
+		NAMES sundials_sunlinsolklu
+	)
+
+	if(SUNDIALS_SUNLINSOLKLU_LIBRARY)
+		set(SundialsKLU_FOUND ON)
+	endif()
+
 	set(SUNDIALS_LIBRARIES
 		${SUNDIALS_ARKODE_LIBRARY}
 		${SUNDIALS_CVODE_LIBRARY}
@@ -42,5 +51,5 @@ else()
 	include(FindPackageHandleStandardArgs)
 	find_package_handle_standard_args(Sundials DEFAULT_MSG SUNDIALS_ARKODE_LIBRARY SUNDIALS_INCLUDE_DIR)
 
-	mark_as_advanced(SUNDIALS_INCLUDE_DIR)
+	mark_as_advanced(SUNDIALS_INCLUDE_DIR SUNDIALS_SUNLINSOLKLU_LIBRARY)
 endif()
@@ -186,6 +186,13 @@ public:
 		 * */
   virtual void appendDependencies(AttributeBase::Set *deps) = 0;
 
+  /**
+		 * Collapse reference chains so that the attribute's value can afterwards be accessed through a plain pointer
+		 * without running any update tasks. Attributes that have to compute their value on access are left untouched.
+		 * @return true if the attribute's value can be accessed directly
+		 * */
+  virtual bool resolve() { return false; }
+
   /**
 		 * Get a set of all attributes this attribute depends on. For static attributes, this set will only contain `this`.
 		 * For dynamic attributes, this will recursively collect all dependency attributes.
@@ -268,6 +275,8 @@ class Attribute : public AttributeBase,
 
 protected:
   std::shared_ptr<T> mData;
+  /// Pointer to the value if it can be accessed without running update tasks
+  T *mResolvedData = nullptr;
 
 public:
   using Type = T;
@@ -319,12 +328,18 @@ public:
   ///
   /// Real x = v;
   ///
-  operator const T &() { return this->get(); }
+  operator const T &() {
+    return mResolvedData ? *mResolvedData : this->get();
+  }
 
   /// @brief User-defined dereference operator
   ///
-  /// Allows easier access to the attribute's underlying data
-  T &operator*() { return this->get(); }
+  /// Allows easier access to the attribute's underlying data. For resolved
+  /// attributes, this is a plain load without calling the virtual getter.
+  T &operator*() { return mResolvedData ? *mResolvedData : this->get(); }
+
+  /// Whether the value can be accessed without running update tasks
+  bool isResolved() const { return mResolvedData != nullptr; }
 
   /**
 		 * @brief Copy the attribute value of `copyFrom` onto this attribute
@@ -544,7 +559,10 @@ class AttributeStatic : public Attribute<T>,
   friend class SharedFactory<AttributeStatic<T>>;
 
 public:
-  AttributeStatic(T initialValue = T()) : Attribute<T>(initialValue) {}
+  AttributeStatic(T initialValue = T()) : Attribute<T>(initialValue) {
+    // The data of a static attribute is never replaced
+    this->mResolvedData = this->mData.get();
+  }
 
   virtual void set(T value) override { *this->mData = value; };
 
@@ -561,6 +579,8 @@ public:
   virtual void appendDependencies(AttributeBase::Set *deps) override {
     deps->insert(this->shared_from_this());
   }
+
+  virtual bool resolve() override { return true; }
 };
 
 /**
@@ -575,10 +595,48 @@ protected:
   std::vector<typename AttributeUpdateTaskBase<T>::Ptr> updateTasksOnce;
   std::vector<typename AttributeUpdateTaskBase<T>::Ptr> updateTasksOnGet;
   std::vector<typename AttributeUpdateTaskBase<T>::Ptr> updateTasksOnSet;
+  /// Attribute passed to setReference, kept for collapsing reference chains
+  typename Attribute<T>::Ptr mReference;
+  /// Whether resolve may bypass the update tasks
+  bool mResolveEnabled = true;
 
 public:
   AttributeDynamic(T initialValue = T()) : Attribute<T>(initialValue) {}
 
+  /**
+		 * Opt out of resolving for attributes whose update tasks have to run on every access,
+		 * e.g. references whose target is replaced while the simulation is running.
+		 * */
+  void doResolve(bool value) {
+    mResolveEnabled = value;
+    if (!value)
+      this->mResolvedData = nullptr;
+  }
+
+  /**
+		 * Collapse a chain of references into a pointer to the data of the last attribute in the chain.
+		 * Attributes with other UPDATE_ON_GET tasks stay unresolved. Changing a reference afterwards
+		 * requires resolving the attributes referencing this one again.
+		 * */
+  virtual bool resolve() override {
+    if (this->mResolvedData)
+      return true;
+    if (!mResolveEnabled)
+      return false;
+
+    if (!mReference.isNull()) {
+      if (updateTasksOnGet.size() > 1 || !mReference->resolve())
+        return false;
+      this->mData = mReference->asRawPointer();
+      updateTasksOnGet.clear();
+    }
+    if (!updateTasksOnGet.empty())
+      return false;
+
+    this->mResolvedData = this->mData.get();
+    return true;
+  }
+
   /**
 		 * Allows for adding a new update task to this attribute.
 		 * @param kind The kind of update task
@@ -591,9 +649,11 @@ public:
       updateTasksOnce.push_back(task);
       ///THISISBAD: This is probably not the right time to run this kind of task
       task->executeUpdate(this->mData);
+      this->mResolvedData = nullptr;
       break;
     case UpdateTaskKind::UPDATE_ON_GET:
       updateTasksOnGet.push_back(task);
+      this->mResolvedData = nullptr;
       break;
     case UpdateTaskKind::UPDATE_ON_SET:
       updateTasksOnSet.push_back(task);
@@ -611,9 +671,13 @@ public:
     switch (kind) {
     case UpdateTaskKind::UPDATE_ONCE:
       updateTasksOnce.clear();
+      mReference = nullptr;
+      this->mResolvedData = nullptr;
       break;
     case UpdateTaskKind::UPDATE_ON_GET:
       updateTasksOnGet.clear();
+      mReference = nullptr;
+      this->mResolvedData = nullptr;
       break;
     case UpdateTaskKind::UPDATE_ON_SET:
       updateTasksOnSet.clear();
@@ -630,6 +694,8 @@ public:
     updateTasksOnce.clear();
     updateTasksOnGet.clear();
     updateTasksOnSet.clear();
+    mReference = nullptr;
+    this->mResolvedData = nullptr;
   }
 
   virtual void setReference(typename Attribute<T>::Ptr reference) override {
@@ -639,6 +705,7 @@ public:
           dependent = dependency->asRawPointer();
         };
     this->clearAllTasks();
+    mReference = reference;
     if (reference->isStatic()) {
       this->addTask(UpdateTaskKind::UPDATE_ONCE,
                     AttributeUpdateTask<T, T>::make(UpdateTaskKind::UPDATE_ONCE,
@@ -651,7 +718,7 @@ public:
   }
 
   virtual std::shared_ptr<T> asRawPointer() override {
-    for (typename AttributeUpdateTaskBase<T>::Ptr task : updateTasksOnGet) {
+    for (auto &task : updateTasksOnGet) {
       task->executeUpdate(this->mData);
     }
     return this->mData;
@@ -659,13 +726,13 @@ public:
 
   virtual void set(T value) override {
     *this->mData = value;
-    for (typename AttributeUpdateTaskBase<T>::Ptr task : updateTasksOnSet) {
+    for (auto &task : updateTasksOnSet) {
       task->executeUpdate(this->mData);
     }
   };
 
   virtual T &get() override {
-    for (typename AttributeUpdateTaskBase<T>::Ptr task : updateTasksOnGet) {
+    for (auto &task : updateTasksOnGet) {
       task->executeUpdate(this->mData);
     }
     return *this->mData;
@@ -692,6 +759,10 @@ public:
       newDeps.insert(taskDeps.begin(), taskDeps.end());
     }
 
+    // Resolving removes the reference task, but not the dependency
+    if (!mReference.isNull())
+      newDeps.insert(mReference);
+
     for (auto dependency : newDeps) {
       dependency->appendDependencies(deps);
     }
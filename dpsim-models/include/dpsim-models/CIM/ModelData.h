@@ -0,0 +1,231 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#pragma once
+
+#include <list>
+#include <vector>
+
+#include <dpsim-models/Definitions.h>
+#include <dpsim-models/Filesystem.h>
+
+namespace CPS {
+namespace CIM {
+
+/// Parameters of the CIM objects that the Reader maps to nodes and
+/// components, independent of CIM++. Values are stored as given in the CIM
+/// files, i.e. without applying unit multipliers.
+///
+/// The data can be written to a binary cache file keyed by a content hash of
+/// the CIM files, so that later imports of the same files skip the XML
+/// parsing. Since the components are created from this data, one cache file
+/// serves all domains, phase types and generator types.
+struct ModelData {
+  static constexpr const char *MAGIC = "DPSIMCIM";
+  static constexpr UInt VERSION = 1;
+
+  struct Terminal {
+    String mRID;
+    Int sequenceNumber = 1;
+    /// mRID of the connected ConductingEquipment, empty if there is none
+    String equipment;
+
+    template <typename Archive> void serialize(Archive &ar) {
+      ar(mRID, sequenceNumber, equipment);
+    }
+  };
+
+  struct TopologicalNode {
+    String mRID;
+    String name;
+    std::vector<Terminal> terminals;
+
+    template <typename Archive> void serialize(Archive &ar) {
+      ar(mRID, name, terminals);
+    }
+  };
+
+  struct SvVoltage {
+    /// mRID of the TopologicalNode, empty if the reference is missing
+    String topologicalNode;
+    Real v = 0;
+    Real angle = 0;
+
+    template <typename Archive> void serialize(Archive &ar) {
+      ar(topologicalNode, v, angle);
+    }
+  };
+
+  struct SvPowerFlow {
+    String terminal;
+    Real p = 0;
+    Real q = 0;
+
+    template <typename Archive> void serialize(Archive &ar) {
+      ar(terminal, p, q);
+    }
+  };
+
+  struct ACLineSegment {
+    String mRID;
+    String name;
+    Real r = 0;
+    Real x = 0;
+    Real bch = 0;
+    Real gch = 0;
+    /// Base voltage in V
+    Real baseVoltage = 0;
+
+    template <typename Archive> void serialize(Archive &ar) {
+      ar(mRID, name, r, x, bch, gch, baseVoltage);
+    }
+  };
+
+  struct EnergyConsumer {
+    String mRID;
+    String name;
+
+    template <typename Archive> void serialize(Archive &ar) { ar(mRID, name); }
+  };
+
+  struct PowerTransformerEnd {
+    String name;
+    Real ratedS = 0;
+    Real ratedU = 0;
+    Real r = 0;
+    Real x = 0;
+
+    template <typename Archive> void serialize(Archive &ar) {
+      ar(name, ratedS, ratedU, r, x);
+    }
+  };
+
+  struct PowerTransformer {
+    String mRID;
+    String name;
+    PowerTransformerEnd end1;
+    PowerTransformerEnd end2;
+    /// RatioTapChanger of the first end
+    Bool hasRatioTapChanger = false;
+    Real normalStep = 0;
+    Real neutralStep = 0;
+    Real stepVoltageIncrement = 0;
+    /// SvTapStep of the tap changer
+    Bool hasSvTapStep = false;
+    Real position = 0;
+
+    template <typename Archive> void serialize(Archive &ar) {
+      ar(mRID, name, end1, end2, hasRatioTapChanger, normalStep, neutralStep,
+         stepVoltageIncrement, hasSvTapStep, position);
+    }
+  };
+
+  /// SynchronousMachineTimeConstantReactance
+  struct SynchronousMachineDynamics {
+    Real statorResistance = 0;
+    Real statorLeakageReactance = 0;
+    Real xDirectSync = 0;
+    Real xQuadSync = 0;
+    Real xDirectTrans = 0;
+    Real xQuadTrans = 0;
+    Real xDirectSubtrans = 0;
+    Real xQuadSubtrans = 0;
+    Real tpdo = 0;
+    Real tpqo = 0;
+    Real tppdo = 0;
+    Real tppqo = 0;
+    Real inertia = 0;
+
+    template <typename Archive> void serialize(Archive &ar) {
+      ar(statorResistance, statorLeakageReactance, xDirectSync, xQuadSync,
+         xDirectTrans, xQuadTrans, xDirectSubtrans, xQuadSubtrans, tpdo, tpqo,
+         tppdo, tppqo, inertia);
+    }
+  };
+
+  struct SynchronousMachine {
+    String mRID;
+    String name;
+    Real ratedS = 0;
+    Real ratedU = 0;
+    Bool hasDynamics = false;
+    SynchronousMachineDynamics dynamics;
+    /// GeneratingUnit of the machine
+    Bool hasGeneratingUnit = false;
+    Bool hasInitialP = false;
+    Real initialP = 0;
+    Bool hasRegulatingControl = false;
+    Real targetValue = 0;
+    Bool hasMaxQ = false;
+    Real maxQ = 0;
+
+    template <typename Archive> void serialize(Archive &ar) {
+      ar(mRID, name, ratedS, ratedU, hasDynamics, dynamics, hasGeneratingUnit,
+         hasInitialP, initialP, hasRegulatingControl, targetValue, hasMaxQ,
+         maxQ);
+    }
+  };
+
+  struct ExternalNetworkInjection {
+    String mRID;
+    String name;
+    /// Base voltage in V
+    Real baseVoltage = 0;
+    Bool hasRegulatingControl = false;
+    /// False if the target value of the RegulatingControl is not set
+    Bool hasTargetValue = false;
+    Real targetValue = 0;
+
+    template <typename Archive> void serialize(Archive &ar) {
+      ar(mRID, name, baseVoltage, hasRegulatingControl, hasTargetValue,
+         targetValue);
+    }
+  };
+
+  struct EquivalentShunt {
+    String mRID;
+    String name;
+    /// Base voltage in V
+    Real baseVoltage = 0;
+    Real g = 0;
+    Real b = 0;
+
+    template <typename Archive> void serialize(Archive &ar) {
+      ar(mRID, name, baseVoltage, g, b);
+    }
+  };
+
+  /// In the order of the CIM files, which determines the node numbering
+  std::vector<TopologicalNode> topologicalNodes;
+  std::vector<SvVoltage> svVoltages;
+  std::vector<SvPowerFlow> svPowerFlows;
+  std::vector<ACLineSegment> acLineSegments;
+  std::vector<EnergyConsumer> energyConsumers;
+  std::vector<PowerTransformer> powerTransformers;
+  std::vector<SynchronousMachine> synchronousMachines;
+  std::vector<ExternalNetworkInjection> externalNetworkInjections;
+  std::vector<EquivalentShunt> equivalentShunts;
+
+  template <typename Archive> void serialize(Archive &ar) {
+    ar(topologicalNodes, svVoltages, svPowerFlows, acLineSegments,
+       energyConsumers, powerTransformers, synchronousMachines,
+       externalNetworkInjections, equivalentShunts);
+  }
+
+  /// Hash of the contents of the files in the given order.
+  /// Throws if a file cannot be read.
+  static String contentHash(const std::list<fs::path> &filenames);
+  /// Writes the data and the content hash of its CIM files
+  void write(const fs::path &filename, const String &hash) const;
+  /// Reads the data written by write. Returns false if the file does not
+  /// exist, is invalid or was written for CIM files with another hash.
+  static Bool read(const fs::path &filename, const String &hash,
+                   ModelData &data);
+};
+} // namespace CIM
+} // namespace CPS
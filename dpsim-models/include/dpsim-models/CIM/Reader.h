@@ -10,7 +10,11 @@
 
 #include <list>
 #include <map>
+#include <memory>
+#include <utility>
+#include <vector>
 
+#include <dpsim-models/CIM/ModelData.h>
 #include <dpsim-models/Components.h>
 #include <dpsim-models/Definitions.h>
 #include <dpsim-models/Filesystem.h>
@@ -88,6 +92,19 @@ private:
   std::map<String, TopologicalTerminal::Ptr> mPowerflowTerminals;
   ///
   Bool mUseProtectionSwitches = false;
+  /// Map the equipment to components on multiple threads
+  Bool mParallelImport = false;
+  /// Number of import threads, 0 for the number of hardware threads
+  UInt mImportThreads = 0;
+  /// Objects of the CIM model bucketed by type, built in a single pass
+  struct ObjectIndex;
+  std::unique_ptr<ObjectIndex> mObjects;
+  /// Parameters of the objects that are mapped to nodes and components
+  ModelData mData;
+  /// Directory of the model data cache, empty if caching is disabled
+  fs::path mCacheDirectory;
+  /// Duration of the import stages in seconds
+  std::vector<std::pair<String, Real>> mImportTimes;
 
   // #### shunt component settings ####
   /// activates global shunt capacitor setting
@@ -103,49 +120,86 @@ private:
   /// Resolves unit multipliers.
   static Real unitValue(Real value, CIMPP::UnitMultiplier mult);
   ///
-  void processSvVoltage(CIMPP::SvVoltage *volt);
+  void processSvVoltage(const ModelData::SvVoltage &volt);
   ///
-  void processSvPowerFlow(CIMPP::SvPowerFlow *flow);
+  void processSvPowerFlow(const ModelData::SvPowerFlow &flow);
   ///
   template <typename VarType>
-  void processTopologicalNode(CIMPP::TopologicalNode *topNode);
+  void processTopologicalNode(const ModelData::TopologicalNode &topNode);
   ///
   void addFiles(const fs::path &filename);
   /// Adds CIM files to list of files to be parsed.
   void addFiles(const std::list<fs::path> &filenames);
-  /// First, go through all topological nodes and collect them in a list.
+  /// Fills mData from the cache if it holds the data of the files,
+  /// otherwise parses the files and updates the cache.
+  void loadModelData(const std::list<fs::path> &filenames);
+  /// Parses the files and extracts the parameters of the objects that are
+  /// mapped to nodes and components into mData.
+  Bool parseFiles();
+  /// First, map all equipment to components. Then, go through all topological nodes and collect them in a list.
   /// Since all nodes have references to the equipment connected to them (via Terminals), but not
-  /// the other way around (which we need for instantiating the components), we collect that information here as well.
-  void parseFiles();
+  /// the other way around (which we need for instantiating the components), we connect the components here as well.
+  void createComponents();
+  /// Maps all equipment in mData, in parallel if enabled
+  void mapEquipment();
   /// Returns list of components and nodes.
   SystemTopology systemTopology();
+  /// Logs and clears mImportTimes
+  void logImportTimes();
+
+  // #### Extraction Functions ####
+  /// Sorts the objects of the model into mObjects with one cast per object
+  void indexObjects();
+  /// Extracts the parameters of the indexed objects into mData
+  void extractModelData();
+  ///
+  void extractTopologicalNode(CIMPP::TopologicalNode *topNode);
+  ///
+  void extractSvVoltage(CIMPP::SvVoltage *volt);
+  ///
+  void extractSvPowerFlow(CIMPP::SvPowerFlow *flow);
+  ///
+  void extractACLineSegment(CIMPP::ACLineSegment *line);
+  ///
+  void extractPowerTransformer(CIMPP::PowerTransformer *trans);
+  ///
+  void extractSynchronousMachine(CIMPP::SynchronousMachine *machine);
+  ///
+  void extractEnergyConsumer(CIMPP::EnergyConsumer *consumer);
+  ///
+  void
+  extractExternalNetworkInjection(CIMPP::ExternalNetworkInjection *extnet);
+  ///
+  void extractEquivalentShunt(CIMPP::EquivalentShunt *shunt);
 
   // #### Mapping Functions ####
   /// Returns simulation node index which belongs to mRID.
   Matrix::Index mapTopologicalNode(String mrid);
-  /// Maps CIM components to CPowerSystem components.
-  TopologicalPowerComp::Ptr mapComponent(BaseClass *obj);
   /// Returns an RX-Line.
   /// The voltage should be given in kV and the angle in degree.
   /// TODO: Introduce different models such as PI and wave model.
-  TopologicalPowerComp::Ptr mapACLineSegment(CIMPP::ACLineSegment *line);
+  TopologicalPowerComp::Ptr
+  mapACLineSegment(const ModelData::ACLineSegment &line);
   /// Returns a transformer, either ideal or with RL elements to model losses.
-  TopologicalPowerComp::Ptr mapPowerTransformer(CIMPP::PowerTransformer *trans);
+  TopologicalPowerComp::Ptr
+  mapPowerTransformer(const ModelData::PowerTransformer &trans);
   /// Returns an IdealVoltageSource with voltage setting according to load flow data
   /// at machine terminals. The voltage should be given in kV and the angle in degree.
   /// TODO: Introduce real synchronous generator models here.
   TopologicalPowerComp::Ptr
-  mapSynchronousMachine(CIMPP::SynchronousMachine *machine);
+  mapSynchronousMachine(const ModelData::SynchronousMachine &machine);
   /// Returns an PQload with voltage setting according to load flow data.
   /// Currently the only option is to create an RL-load.
   /// The voltage should be given in kV and the angle in degree.
   /// TODO: Introduce real PQload model here.
-  TopologicalPowerComp::Ptr mapEnergyConsumer(CIMPP::EnergyConsumer *consumer);
-  /// Returns an external grid injection.
   TopologicalPowerComp::Ptr
-  mapExternalNetworkInjection(CIMPP::ExternalNetworkInjection *extnet);
+  mapEnergyConsumer(const ModelData::EnergyConsumer &consumer);
+  /// Returns an external grid injection.
+  TopologicalPowerComp::Ptr mapExternalNetworkInjection(
+      const ModelData::ExternalNetworkInjection &extnet);
   /// Returns a shunt
-  TopologicalPowerComp::Ptr mapEquivalentShunt(CIMPP::EquivalentShunt *shunt);
+  TopologicalPowerComp::Ptr
+  mapEquivalentShunt(const ModelData::EquivalentShunt &shunt);
 
   // #### Helper Functions ####
   /// Determine base voltage associated with object
@@ -185,6 +239,13 @@ public:
   void setShuntConductance(Real v);
   /// If set, some components like loads include protection switches
   void useProtectionSwitches(Bool value = true);
+  /// If set, the components are created on multiple threads. A threads
+  /// value of 0 uses all hardware threads.
+  void useParallelImport(Bool value = true, UInt threads = 0);
+  /// Caches the model data of the CIM files in the directory. Later imports
+  /// of files with the same content read the cache instead of parsing the
+  /// files. An empty path disables the cache.
+  void setCacheDirectory(const fs::path &directory);
 };
 } // namespace CIM
 } // namespace CPS
@@ -28,6 +28,7 @@
 #include <dpsim-models/SP/SP_Ph1_SynchronGenerator6aOrderVBR.h>
 #include <dpsim-models/SP/SP_Ph1_SynchronGenerator6bOrderVBR.h>
 #include <dpsim-models/SP/SP_Ph1_SynchronGeneratorTrStab.h>
+#include <dpsim-models/SP/SP_Ph1_SynchronGeneratorVBRGroup.h>
 #include <dpsim-models/SP/SP_Ph1_Transformer.h>
 #include <dpsim-models/SP/SP_Ph1_VDNode.h>
 #include <dpsim-models/SP/SP_Ph1_VoltageSource.h>
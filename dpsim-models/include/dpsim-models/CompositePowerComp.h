@@ -3,6 +3,7 @@
 #pragma once
 
 #include <dpsim-models/MNASimPowerComp.h>
+#include <dpsim-models/Solver/MNAVariableTimeStepInterface.h>
 
 namespace CPS {
 enum class MNA_SUBCOMP_TASK_ORDER {
@@ -11,6 +12,8 @@ enum class MNA_SUBCOMP_TASK_ORDER {
   TASK_AFTER_PARENT
 };
 
+template <typename VarType> class MNAVariableTimeStepComposite;
+
 /// Base class for composite power components
 template <typename VarType>
 class CompositePowerComp : public MNASimPowerComp<VarType> {
@@ -24,6 +27,12 @@ private:
 
   std::vector<CPS::Attribute<Matrix>::Ptr> mRightVectorStamps;
 
+protected:
+  /// Updates the time step of the subcomponents that support it
+  void mnaUpdateSubcomponentsTimeStep(Real omega, Real timeStep);
+
+  friend class MNAVariableTimeStepComposite<VarType>;
+
 public:
   using Type = VarType;
   using Ptr = std::shared_ptr<CompositePowerComp<VarType>>;
@@ -111,4 +120,15 @@ public:
       // By default, the parent has no custom post-step-dependencies, only the subcomponents' dependencies are added
   };
 };
+
+/// Opt-in base for composites whose own stamps do not depend on the time
+/// step. Variable time steps are forwarded to the subcomponents.
+template <typename VarType>
+class MNAVariableTimeStepComposite : public MNAVariableTimeStepInterface {
+public:
+  void mnaUpdateTimeStep(Real omega, Real timeStep) override {
+    dynamic_cast<CompositePowerComp<VarType> &>(*this)
+        .mnaUpdateSubcomponentsTimeStep(omega, timeStep);
+  }
+};
 } // namespace CPS
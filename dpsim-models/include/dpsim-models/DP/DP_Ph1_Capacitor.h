@@ -10,6 +10,8 @@
 
 #include <dpsim-models/Base/Base_Ph1_Capacitor.h>
 #include <dpsim-models/MNASimPowerComp.h>
+#include <dpsim-models/Solver/MNALocalRightVectorInterface.h>
+#include <dpsim-models/Solver/MNAVariableTimeStepInterface.h>
 
 namespace CPS {
 namespace DP {
@@ -23,6 +25,8 @@ namespace Ph1 {
 /// frequency and the current source changes for each iteration.
 class Capacitor : public MNASimPowerComp<Complex>,
                   public Base::Ph1::Capacitor,
+                  public MNAVariableTimeStepInterface,
+                  public MNALocalRightVectorInterface,
                   public SharedFactory<Capacitor> {
 protected:
   /// DC equivalent current source for harmonics [A]
@@ -52,6 +56,8 @@ public:
   /// Initializes internal variables of the component
   void mnaCompInitialize(Real omega, Real timeStep,
                          Attribute<Matrix>::Ptr leftVector) override;
+  /// Updates the companion model coefficients for a new time step
+  void mnaUpdateTimeStep(Real omega, Real timeStep) override;
   void mnaCompInitializeHarm(
       Real omega, Real timeStep,
       std::vector<Attribute<Matrix>::Ptr> leftVector) override;
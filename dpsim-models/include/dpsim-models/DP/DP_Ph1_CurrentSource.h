@@ -11,6 +11,8 @@
 #include <dpsim-models/Base/Base_Ph1_CurrentSource.h>
 #include <dpsim-models/MNASimPowerComp.h>
 #include <dpsim-models/Solver/MNAInterface.h>
+#include <dpsim-models/Solver/MNALocalRightVectorInterface.h>
+#include <dpsim-models/Solver/MNATimeStepIndependentInterface.h>
 #include <dpsim-models/Task.h>
 
 namespace CPS {
@@ -22,6 +24,8 @@ namespace Ph1 {
 /// In case of a dynamic phasor simulation, a frequency different
 /// from zero is added on top of the system frequency.
 class CurrentSource : public MNASimPowerComp<Complex>,
+                      public MNALocalRightVectorInterface,
+                      public MNATimeStepIndependentInterface,
                       public SharedFactory<CurrentSource> {
 public:
   const Attribute<Complex>::Ptr mCurrentRef;
@@ -10,7 +10,9 @@
 
 #include <dpsim-models/Base/Base_Ph1_Inductor.h>
 #include <dpsim-models/MNASimPowerComp.h>
+#include <dpsim-models/Solver/MNALocalRightVectorInterface.h>
 #include <dpsim-models/Solver/MNATearInterface.h>
+#include <dpsim-models/Solver/MNAVariableTimeStepInterface.h>
 
 namespace CPS {
 namespace DP {
@@ -25,6 +27,8 @@ namespace Ph1 {
 class Inductor : public MNASimPowerComp<Complex>,
                  public Base::Ph1::Inductor,
                  public MNATearInterface,
+                 public MNAVariableTimeStepInterface,
+                 public MNALocalRightVectorInterface,
                  public SharedFactory<Inductor> {
 protected:
   /// DC equivalent current source for harmonics [A]
@@ -34,7 +38,7 @@ protected:
   /// Coefficient in front of previous current value for harmonics
   MatrixComp mPrevCurrFac;
   ///
-  void initVars(Real timeStep);
+  void initVars(Real omega, Real timeStep);
 
 public:
   /// Defines UID, name and log level
@@ -56,6 +60,8 @@ public:
   /// Initializes MNA specific variables
   void mnaCompInitialize(Real omega, Real timeStep,
                          Attribute<Matrix>::Ptr leftVector) override;
+  /// Updates the companion model coefficients for a new time step
+  void mnaUpdateTimeStep(Real omega, Real timeStep) override;
   void mnaCompInitializeHarm(
       Real omega, Real timeStep,
       std::vector<Attribute<Matrix>::Ptr> leftVectors) override;
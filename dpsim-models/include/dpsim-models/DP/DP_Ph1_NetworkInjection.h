@@ -12,6 +12,7 @@
 #include <dpsim-models/DP/DP_Ph1_VoltageSource.h>
 #include <dpsim-models/Solver/DAEInterface.h>
 #include <dpsim-models/Solver/MNAInterface.h>
+#include <dpsim-models/Solver/MNALocalRightVectorInterface.h>
 
 namespace CPS {
 namespace DP {
@@ -24,7 +25,9 @@ namespace Ph1 {
 /// the frequency, magnitude and phase of the sine wave can be modified through the mVoltageRef and mSrcFreq attributes.
 /// See DP_Ph1_VoltageSource.h for more details.
 class NetworkInjection : public CompositePowerComp<Complex>,
+                         public MNAVariableTimeStepComposite<Complex>,
                          public DAEInterface,
+                         public MNALocalRightVectorInterface,
                          public SharedFactory<NetworkInjection> {
 private:
   // ### Electrical Subcomponents ###
@@ -19,6 +19,7 @@ namespace Ph1 {
 /// TODO: read from CSV files
 /// \brief PQ-load represented by a current source
 class PQLoadCS : public CompositePowerComp<Complex>,
+                 public MNAVariableTimeStepComposite<Complex>,
                  public SharedFactory<PQLoadCS> {
 protected:
   /// Internal current source
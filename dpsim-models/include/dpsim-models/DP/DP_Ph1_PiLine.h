@@ -13,6 +13,7 @@
 #include <dpsim-models/DP/DP_Ph1_Capacitor.h>
 #include <dpsim-models/DP/DP_Ph1_Inductor.h>
 #include <dpsim-models/DP/DP_Ph1_Resistor.h>
+#include <dpsim-models/Solver/MNALocalRightVectorInterface.h>
 #include <dpsim-models/Solver/MNATearInterface.h>
 
 namespace CPS {
@@ -23,8 +24,10 @@ namespace Ph1 {
 /// This model consists sub components to represent the
 /// RLC elements of a PI-line.
 class PiLine : public CompositePowerComp<Complex>,
+               public MNAVariableTimeStepComposite<Complex>,
                public MNATearInterface,
                public Base::Ph1::PiLine,
+               public MNALocalRightVectorInterface,
                public SharedFactory<PiLine> {
 protected:
   /// Series Inductance submodel
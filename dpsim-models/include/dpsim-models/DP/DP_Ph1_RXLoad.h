@@ -19,6 +19,7 @@ namespace DP {
 namespace Ph1 {
 /// Constant impedance load model consisting of RLC elements
 class RXLoad : public CompositePowerComp<Complex>,
+               public MNAVariableTimeStepComposite<Complex>,
                public SharedFactory<RXLoad> {
 protected:
   /// Resistance [Ohm]
@@ -16,6 +16,7 @@ namespace DP {
 namespace Ph1 {
 /// Constant impedance load model consisting of RLC elements
 class RXLoadSwitch : public CompositePowerComp<Complex>,
+                     public MNAVariableTimeStepComposite<Complex>,
                      public MNASwitchInterface,
                      public SharedFactory<RXLoadSwitch> {
 protected:
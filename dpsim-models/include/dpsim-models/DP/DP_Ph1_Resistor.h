@@ -11,7 +11,9 @@
 #include <dpsim-models/Base/Base_Ph1_Resistor.h>
 #include <dpsim-models/MNASimPowerComp.h>
 #include <dpsim-models/Solver/DAEInterface.h>
+#include <dpsim-models/Solver/MNALocalRightVectorInterface.h>
 #include <dpsim-models/Solver/MNATearInterface.h>
+#include <dpsim-models/Solver/MNATimeStepIndependentInterface.h>
 
 namespace CPS {
 namespace DP {
@@ -21,6 +23,8 @@ class Resistor : public MNASimPowerComp<Complex>,
                  public Base::Ph1::Resistor,
                  public MNATearInterface,
                  public DAEInterface,
+                 public MNALocalRightVectorInterface,
+                 public MNATimeStepIndependentInterface,
                  public SharedFactory<Resistor> {
 public:
   /// Defines UID, name and logging level
@@ -89,6 +93,12 @@ public:
                    double resid[], std::vector<int> &off);
   ///Voltage Getter
   Complex daeInitialize();
+  /// The residual is linear, so the Jacobian is provided analytically
+  Bool daeHasJacobian() override { return true; }
+  /// Partial derivatives of the residual equations
+  void daeJacobian(double ttime, const double state[], const double dstate_dt[],
+                   double cj, SparseMatrix &jacobian,
+                   std::vector<int> &off) override;
 };
 } // namespace Ph1
 } // namespace DP
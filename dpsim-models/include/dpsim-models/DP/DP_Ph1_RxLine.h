@@ -19,6 +19,7 @@ namespace DP {
 namespace Ph1 {
 
 class RxLine : public CompositePowerComp<Complex>,
+               public MNAVariableTimeStepComposite<Complex>,
                public Base::Ph1::PiLine,
                public SharedFactory<RxLine> {
 protected:
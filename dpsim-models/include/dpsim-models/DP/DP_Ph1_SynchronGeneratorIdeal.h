@@ -17,6 +17,7 @@ namespace DP {
 namespace Ph1 {
 /// Ideal voltage source representing a synchronous generator
 class SynchronGeneratorIdeal : public CompositePowerComp<Complex>,
+                               public MNAVariableTimeStepComposite<Complex>,
                                public SharedFactory<SynchronGeneratorIdeal> {
 private:
   /// Inner voltage source that represents the generator
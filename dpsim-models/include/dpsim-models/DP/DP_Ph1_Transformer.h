@@ -20,6 +20,7 @@ namespace DP {
 namespace Ph1 {
 /// Transformer that includes an inductance and resistance
 class Transformer : public CompositePowerComp<Complex>,
+                    public MNAVariableTimeStepComposite<Complex>,
                     public SharedFactory<Transformer>,
                     public Base::Ph1::Transformer {
 private:
@@ -16,6 +16,8 @@
 #include <dpsim-models/Signal/SineWaveGenerator.h>
 #include <dpsim-models/Solver/DAEInterface.h>
 #include <dpsim-models/Solver/MNAInterface.h>
+#include <dpsim-models/Solver/MNALocalRightVectorInterface.h>
+#include <dpsim-models/Solver/MNATimeStepIndependentInterface.h>
 
 namespace CPS {
 namespace DP {
@@ -39,6 +41,8 @@ namespace Ph1 {
 /// a new equation ej - ek = V is added to the problem.
 class VoltageSource : public MNASimPowerComp<Complex>,
                       public DAEInterface,
+                      public MNALocalRightVectorInterface,
+                      public MNATimeStepIndependentInterface,
                       public SharedFactory<VoltageSource> {
 private:
   ///
@@ -156,6 +160,12 @@ public:
                    double resid[], std::vector<int> &off) override;
   ///Voltage Getter
   Complex daeInitialize() override;
+  /// The residual is linear, so the Jacobian is provided analytically
+  Bool daeHasJacobian() override { return true; }
+  /// Partial derivatives of the residual equations
+  void daeJacobian(double ttime, const double state[], const double dstate_dt[],
+                   double cj, SparseMatrix &jacobian,
+                   std::vector<int> &off) override;
 };
 } // namespace Ph1
 } // namespace DP
@@ -11,6 +11,8 @@
 #include <dpsim-models/Base/Base_Ph1_VoltageSource.h>
 #include <dpsim-models/MNASimPowerComp.h>
 #include <dpsim-models/Solver/MNAInterface.h>
+#include <dpsim-models/Solver/MNALocalRightVectorInterface.h>
+#include <dpsim-models/Solver/MNATimeStepIndependentInterface.h>
 
 namespace CPS {
 namespace DP {
@@ -22,6 +24,8 @@ namespace Ph1 {
 /// a parallel resistance using the Norton equivalent.
 class VoltageSourceNorton : public MNASimPowerComp<Complex>,
                             public Base::Ph1::VoltageSource,
+                            public MNALocalRightVectorInterface,
+                            public MNATimeStepIndependentInterface,
                             public SharedFactory<VoltageSourceNorton> {
 protected:
   /// Equivalent current source [A]
@@ -16,6 +16,7 @@ namespace CPS {
 namespace DP {
 namespace Ph1 {
 class VoltageSourceRamp : public CompositePowerComp<Complex>,
+                          public MNAVariableTimeStepComposite<Complex>,
                           public SharedFactory<VoltageSourceRamp> {
 protected:
   ///
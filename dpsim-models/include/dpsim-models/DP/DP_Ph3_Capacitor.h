@@ -11,6 +11,8 @@
 #include <dpsim-models/Base/Base_Ph3_Capacitor.h>
 #include <dpsim-models/MNASimPowerComp.h>
 #include <dpsim-models/Solver/MNAInterface.h>
+#include <dpsim-models/Solver/MNALocalRightVectorInterface.h>
+#include <dpsim-models/Solver/MNAVariableTimeStepInterface.h>
 
 namespace CPS {
 namespace DP {
@@ -24,14 +26,16 @@ namespace Ph3 {
 /// frequency and the current source changes for each iteration.
 class Capacitor : public MNASimPowerComp<Complex>,
                   public Base::Ph3::Capacitor,
+                  public MNAVariableTimeStepInterface,
+                  public MNALocalRightVectorInterface,
                   public SharedFactory<Capacitor> {
 protected:
   /// DC equivalent current source [A]
-  MatrixComp mEquivCurrent = Matrix::Zero(3, 1);
+  MatrixFixedSizeComp<3, 1> mEquivCurrent = MatrixFixedSizeComp<3, 1>::Zero();
   /// Equivalent conductance [S]
-  MatrixComp mEquivCond = Matrix::Zero(3, 1);
+  MatrixFixedSizeComp<3, 3> mEquivCond = MatrixFixedSizeComp<3, 3>::Zero();
   /// Coefficient in front of previous voltage value
-  MatrixComp mPrevVoltCoeff;
+  MatrixFixedSizeComp<3, 3> mPrevVoltCoeff;
   /// init resistive companion model of capacitor
   void initVars(Real omega, Real timeStep);
 
@@ -52,6 +56,8 @@ public:
   /// Initializes internal variables of the component
   void mnaCompInitialize(Real omega, Real timeStep,
                          Attribute<Matrix>::Ptr leftVector) override;
+  /// Updates the companion model coefficients for a new time step
+  void mnaUpdateTimeStep(Real omega, Real timeStep) override;
   /// Stamps system matrix
   void mnaCompApplySystemMatrixStamp(SparseMatrixRow &systemMatrix) override;
   /// Stamps right side (source) vector
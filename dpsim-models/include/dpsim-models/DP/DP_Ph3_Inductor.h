@@ -10,7 +10,9 @@
 
 #include <dpsim-models/Base/Base_Ph3_Inductor.h>
 #include <dpsim-models/MNASimPowerComp.h>
+#include <dpsim-models/Solver/MNALocalRightVectorInterface.h>
 #include <dpsim-models/Solver/MNATearInterface.h>
+#include <dpsim-models/Solver/MNAVariableTimeStepInterface.h>
 
 namespace CPS {
 namespace DP {
@@ -25,12 +27,14 @@ namespace Ph3 {
 class Inductor : public MNASimPowerComp<Complex>,
                  public Base::Ph3::Inductor,
                  public MNATearInterface,
+                 public MNAVariableTimeStepInterface,
+                 public MNALocalRightVectorInterface,
                  public SharedFactory<Inductor> {
 protected:
   /// DC equivalent current source [A]
-  MatrixComp mEquivCurrent;
+  MatrixFixedSizeComp<3, 1> mEquivCurrent;
   /// Equivalent conductance [S]
-  MatrixComp mEquivCond;
+  MatrixFixedSizeComp<3, 3> mEquivCond;
   /// Coefficient in front of previous current value
   Complex mPrevCurrFac;
 
@@ -56,6 +60,8 @@ public:
   /// Initializes internal variables of the component
   void mnaCompInitialize(Real omega, Real timeStep,
                          Attribute<Matrix>::Ptr leftVector) override;
+  /// Updates the companion model coefficients for a new time step
+  void mnaUpdateTimeStep(Real omega, Real timeStep) override;
   /// Stamps system matrix
   void mnaCompApplySystemMatrixStamp(SparseMatrixRow &systemMatrix) override;
   /// Stamps right side (source) vector
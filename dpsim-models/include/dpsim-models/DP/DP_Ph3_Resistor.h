@@ -13,6 +13,7 @@
 #include <dpsim-models/Logger.h>
 #include <dpsim-models/MNASimPowerComp.h>
 #include <dpsim-models/Solver/MNAInterface.h>
+#include <dpsim-models/Solver/MNATimeStepIndependentInterface.h>
 
 namespace CPS {
 namespace DP {
@@ -20,6 +21,7 @@ namespace Ph3 {
 ///
 class Resistor : public MNASimPowerComp<Complex>,
                  public Base::Ph3::Resistor,
+                 public MNATimeStepIndependentInterface,
                  public SharedFactory<Resistor> {
 
 public:
@@ -14,6 +14,7 @@
 #include <dpsim-models/MNASimPowerComp.h>
 #include <dpsim-models/Solver/MNAInterface.h>
 #include <dpsim-models/Solver/MNASwitchInterface.h>
+#include <dpsim-models/Solver/MNATimeStepIndependentInterface.h>
 
 namespace CPS {
 namespace DP {
@@ -26,6 +27,7 @@ namespace Ph3 {
 /// only in series.
 class SeriesSwitch : public MNASimPowerComp<Complex>,
                      public Base::Ph1::Switch,
+                     public MNATimeStepIndependentInterface,
                      public SharedFactory<SeriesSwitch>,
                      public MNASwitchInterface {
 
@@ -40,6 +42,12 @@ public:
   // #### General ####
   /// Initializes component from power flow data
   void initializeFromNodesAndTerminals(Real frequency) override;
+  /// Switch state in addition to the interface quantities
+  AttributeBase::Map stateAttributes() override {
+    auto attributes = MNASimPowerComp<Complex>::stateAttributes();
+    attributes["is_closed"] = mIsClosed;
+    return attributes;
+  }
 
   // #### General MNA section ####
   ///
@@ -11,6 +11,8 @@
 #include <dpsim-models/MNASimPowerComp.h>
 #include <dpsim-models/Solver/DAEInterface.h>
 #include <dpsim-models/Solver/MNAInterface.h>
+#include <dpsim-models/Solver/MNALocalRightVectorInterface.h>
+#include <dpsim-models/Solver/MNATimeStepIndependentInterface.h>
 
 namespace CPS {
 namespace DP {
@@ -25,6 +27,8 @@ namespace Ph3 {
 /// a new equation ej - ek = V is added to the problem.
 class VoltageSource : public MNASimPowerComp<Complex>,
                       public DAEInterface,
+                      public MNALocalRightVectorInterface,
+                      public MNATimeStepIndependentInterface,
                       public SharedFactory<VoltageSource> {
 private:
   void updateVoltage(Real time);
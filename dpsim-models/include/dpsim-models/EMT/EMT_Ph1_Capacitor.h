@@ -11,6 +11,8 @@
 #include <dpsim-models/Base/Base_Ph1_Capacitor.h>
 #include <dpsim-models/MNASimPowerComp.h>
 #include <dpsim-models/Solver/MNAInterface.h>
+#include <dpsim-models/Solver/MNALocalRightVectorInterface.h>
+#include <dpsim-models/Solver/MNAVariableTimeStepInterface.h>
 
 namespace CPS {
 namespace EMT {
@@ -24,6 +26,8 @@ namespace Ph1 {
 ///frequency and the current source changes for each iteration.
 class Capacitor : public MNASimPowerComp<Real>,
                   public Base::Ph1::Capacitor,
+                  public MNAVariableTimeStepInterface,
+                  public MNALocalRightVectorInterface,
                   public SharedFactory<Capacitor> {
 protected:
   /// DC equivalent current source [A]
@@ -49,6 +53,8 @@ public:
   /// Initializes internal variables of the component
   void mnaCompInitialize(Real omega, Real timeStep,
                          Attribute<Matrix>::Ptr leftVector) override;
+  /// Updates the companion model coefficients for a new time step
+  void mnaUpdateTimeStep(Real omega, Real timeStep) override;
   /// Stamps system matrix
   void mnaCompApplySystemMatrixStamp(SparseMatrixRow &systemMatrix) override;
   /// Stamps right side (source) vector
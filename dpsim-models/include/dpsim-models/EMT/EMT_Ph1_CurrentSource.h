@@ -11,6 +11,8 @@
 #include <dpsim-models/Base/Base_Ph1_CurrentSource.h>
 #include <dpsim-models/MNASimPowerComp.h>
 #include <dpsim-models/Solver/MNAInterface.h>
+#include <dpsim-models/Solver/MNALocalRightVectorInterface.h>
+#include <dpsim-models/Solver/MNATimeStepIndependentInterface.h>
 
 namespace CPS {
 namespace EMT {
@@ -20,6 +22,8 @@ namespace Ph1 {
 /// A positive current is flowing out of
 /// node1 and into node2.
 class CurrentSource : public MNASimPowerComp<Real>,
+                      public MNALocalRightVectorInterface,
+                      public MNATimeStepIndependentInterface,
                       public SharedFactory<CurrentSource> {
 public:
   const Attribute<Complex>::Ptr mCurrentRef;
@@ -13,6 +13,8 @@
 #include <dpsim-models/Base/Base_Ph1_Resistor.h>
 #include <dpsim-models/MNASimPowerComp.h>
 #include <dpsim-models/Solver/MNAInterface.h>
+#include <dpsim-models/Solver/MNALocalRightVectorInterface.h>
+#include <dpsim-models/Solver/MNATimeStepIndependentInterface.h>
 
 namespace CPS {
 namespace EMT {
@@ -20,6 +22,8 @@ namespace Ph1 {
 /// EMT Resistor
 class Resistor : public MNASimPowerComp<Real>,
                  public Base::Ph1::Resistor,
+                 public MNALocalRightVectorInterface,
+                 public MNATimeStepIndependentInterface,
                  public SharedFactory<Resistor> {
 protected:
 public:
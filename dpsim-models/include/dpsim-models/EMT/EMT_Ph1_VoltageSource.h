@@ -10,6 +10,8 @@
 
 #include <dpsim-models/MNASimPowerComp.h>
 #include <dpsim-models/Solver/MNAInterface.h>
+#include <dpsim-models/Solver/MNALocalRightVectorInterface.h>
+#include <dpsim-models/Solver/MNATimeStepIndependentInterface.h>
 
 namespace CPS {
 namespace EMT {
@@ -23,6 +25,8 @@ namespace Ph1 {
 /// of node k as negative. Moreover
 /// a new equation ej - ek = V is added to the problem.
 class VoltageSource : public MNASimPowerComp<Real>,
+                      public MNALocalRightVectorInterface,
+                      public MNATimeStepIndependentInterface,
                       public SharedFactory<VoltageSource> {
 private:
   Real mTimeStep;
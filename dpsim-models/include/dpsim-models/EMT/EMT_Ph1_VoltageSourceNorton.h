@@ -11,6 +11,8 @@
 #include <dpsim-models/Base/Base_Ph1_VoltageSource.h>
 #include <dpsim-models/MNASimPowerComp.h>
 #include <dpsim-models/Solver/MNAInterface.h>
+#include <dpsim-models/Solver/MNALocalRightVectorInterface.h>
+#include <dpsim-models/Solver/MNATimeStepIndependentInterface.h>
 
 namespace CPS {
 namespace EMT {
@@ -18,6 +20,8 @@ namespace Ph1 {
 /// Voltage source as Norton equivalent
 class VoltageSourceNorton : public MNASimPowerComp<Real>,
                             public Base::Ph1::VoltageSource,
+                            public MNALocalRightVectorInterface,
+                            public MNATimeStepIndependentInterface,
                             public SharedFactory<VoltageSourceNorton> {
 protected:
   void updateState(Real time);
@@ -16,6 +16,7 @@ namespace CPS {
 namespace EMT {
 namespace Ph1 {
 class VoltageSourceRamp : public CompositePowerComp<Real>,
+                          public MNAVariableTimeStepComposite<Real>,
                           public SharedFactory<VoltageSourceRamp> {
 protected:
   ///
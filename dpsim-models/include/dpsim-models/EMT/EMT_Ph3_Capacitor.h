@@ -11,6 +11,8 @@
 #include <dpsim-models/Base/Base_Ph3_Capacitor.h>
 #include <dpsim-models/MNASimPowerComp.h>
 #include <dpsim-models/Solver/MNAInterface.h>
+#include <dpsim-models/Solver/MNALocalRightVectorInterface.h>
+#include <dpsim-models/Solver/MNAVariableTimeStepInterface.h>
 
 namespace CPS {
 namespace EMT {
@@ -24,12 +26,14 @@ namespace Ph3 {
 ///frequency and the current source changes for each iteration.
 class Capacitor : public MNASimPowerComp<Real>,
                   public Base::Ph3::Capacitor,
+                  public MNAVariableTimeStepInterface,
+                  public MNALocalRightVectorInterface,
                   public SharedFactory<Capacitor> {
 protected:
   /// DC equivalent current source [A]
-  Matrix mEquivCurrent = Matrix::Zero(3, 1);
+  MatrixFixedSize<3, 1> mEquivCurrent = MatrixFixedSize<3, 1>::Zero();
   /// Equivalent conductance [S]
-  Matrix mEquivCond = Matrix::Zero(3, 1);
+  MatrixFixedSize<3, 3> mEquivCond = MatrixFixedSize<3, 3>::Zero();
 
 public:
   /// Defines UID, name and logging level
@@ -49,6 +53,8 @@ public:
   /// Initializes internal variables of the component
   void mnaCompInitialize(Real omega, Real timeStep,
                          Attribute<Matrix>::Ptr leftVector) override;
+  /// Updates the companion model coefficients for a new time step
+  void mnaUpdateTimeStep(Real omega, Real timeStep) override;
   /// Stamps system matrix
   void mnaCompApplySystemMatrixStamp(SparseMatrixRow &systemMatrix) override;
   /// Stamps right side (source) vector
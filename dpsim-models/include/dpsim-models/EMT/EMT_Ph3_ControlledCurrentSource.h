@@ -13,6 +13,8 @@
 #include <dpsim-models/Signal/SignalGenerator.h>
 #include <dpsim-models/Signal/SineWaveGenerator.h>
 #include <dpsim-models/Solver/MNAInterface.h>
+#include <dpsim-models/Solver/MNALocalRightVectorInterface.h>
+#include <dpsim-models/Solver/MNATimeStepIndependentInterface.h>
 
 namespace CPS {
 namespace EMT {
@@ -21,7 +23,10 @@ namespace Ph3 {
 ///
 /// This model uses modified nodal analysis to represent an ideal current source.
 /// This involves the stamping of the current to the right side vector.
-class ControlledCurrentSource : public MNASimPowerComp<Real>, public SharedFactory<ControlledCurrentSource> {
+class ControlledCurrentSource : public MNASimPowerComp<Real>,
+                                public MNALocalRightVectorInterface,
+                                public MNATimeStepIndependentInterface,
+                                public SharedFactory<ControlledCurrentSource> {
 protected:
   // Updates current according to reference phasor and frequency
   void updateCurrent(Real time);
@@ -13,6 +13,8 @@
 #include <dpsim-models/Signal/SignalGenerator.h>
 #include <dpsim-models/Signal/SineWaveGenerator.h>
 #include <dpsim-models/Solver/MNAInterface.h>
+#include <dpsim-models/Solver/MNALocalRightVectorInterface.h>
+#include <dpsim-models/Solver/MNATimeStepIndependentInterface.h>
 
 namespace CPS {
 namespace EMT {
@@ -21,7 +23,10 @@ namespace Ph3 {
 ///
 /// This model uses modified nodal analysis to represent an ideal voltage source.
 /// This voltage source derives it's output purely from attributes rather than an internal signal generator.
-class ControlledVoltageSource : public MNASimPowerComp<Real>, public SharedFactory<ControlledVoltageSource> {
+class ControlledVoltageSource : public MNASimPowerComp<Real>,
+                                public MNALocalRightVectorInterface,
+                                public MNATimeStepIndependentInterface,
+                                public SharedFactory<ControlledVoltageSource> {
 protected:
   // Updates voltage according to reference phasor and frequency
   void updateVoltage(Real time);
@@ -13,6 +13,8 @@
 #include <dpsim-models/Signal/SignalGenerator.h>
 #include <dpsim-models/Signal/SineWaveGenerator.h>
 #include <dpsim-models/Solver/MNAInterface.h>
+#include <dpsim-models/Solver/MNALocalRightVectorInterface.h>
+#include <dpsim-models/Solver/MNATimeStepIndependentInterface.h>
 
 namespace CPS {
 namespace EMT {
@@ -22,6 +24,8 @@ namespace Ph3 {
 /// This model uses modified nodal analysis to represent an ideal current source.
 /// This involves the stamping of the current to the right side vector.
 class CurrentSource : public MNASimPowerComp<Real>,
+                      public MNALocalRightVectorInterface,
+                      public MNATimeStepIndependentInterface,
                       public SharedFactory<CurrentSource> {
 private:
   ///
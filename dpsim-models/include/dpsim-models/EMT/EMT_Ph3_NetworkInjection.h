@@ -11,6 +11,7 @@
 #include <dpsim-models/CompositePowerComp.h>
 #include <dpsim-models/EMT/EMT_Ph3_VoltageSource.h>
 #include <dpsim-models/Solver/MNAInterface.h>
+#include <dpsim-models/Solver/MNALocalRightVectorInterface.h>
 
 namespace CPS {
 namespace EMT {
@@ -19,6 +20,8 @@ namespace Ph3 {
 ///
 /// This model represents network injections by an ideal voltage source.
 class NetworkInjection : public CompositePowerComp<Real>,
+                         public MNAVariableTimeStepComposite<Real>,
+                         public MNALocalRightVectorInterface,
                          public SharedFactory<NetworkInjection> {
 private:
   // ### Electrical Subcomponents ###
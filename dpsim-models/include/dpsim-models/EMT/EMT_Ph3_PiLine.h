@@ -14,6 +14,7 @@
 #include <dpsim-models/EMT/EMT_Ph3_Inductor.h>
 #include <dpsim-models/EMT/EMT_Ph3_Resistor.h>
 #include <dpsim-models/Solver/MNAInterface.h>
+#include <dpsim-models/Solver/MNALocalRightVectorInterface.h>
 
 namespace CPS {
 namespace EMT {
@@ -23,7 +24,9 @@ namespace Ph3 {
 /// This model consists sub components to represent the
 /// RLC elements of a PI-line.
 class PiLine : public CompositePowerComp<Real>,
+               public MNAVariableTimeStepComposite<Real>,
                public Base::Ph3::PiLine,
+               public MNALocalRightVectorInterface,
                public SharedFactory<PiLine> {
 protected:
   /// Series Inductance submodel
@@ -20,7 +20,9 @@ namespace Ph3 {
 /// \brief
 /// TODO: currently modelled as an impedance, which obviously doesn't have a constant power characteristic
 /// Model as current source and read from CSV files
-class RXLoad : public CompositePowerComp<Real>, public SharedFactory<RXLoad> {
+class RXLoad : public CompositePowerComp<Real>,
+               public MNAVariableTimeStepComposite<Real>,
+               public SharedFactory<RXLoad> {
 protected:
   /// Power [Watt]
   MatrixComp mPower;
@@ -22,9 +22,9 @@ class ReducedOrderSynchronGeneratorVBR
 public:
   // Common elements of all VBR models
   /// voltage behind reactance
-  Matrix mEvbr;
+  MatrixFixedSize<3, 1> mEvbr;
   /// norton equivalent current of mEvbr
-  Matrix mIvbr;
+  MatrixFixedSize<3, 1> mIvbr;
 
 protected:
   /// Resistance matrix in dq0 reference frame
@@ -34,8 +34,8 @@ protected:
   MatrixFixedSize<3, 3> mConductanceMatrix;
 
   ///
-  Matrix mAbcToDq0;
-  Matrix mDq0ToAbc;
+  MatrixFixedSize<3, 3> mAbcToDq0;
+  MatrixFixedSize<3, 3> mDq0ToAbc;
 
   /// Constructor
   ReducedOrderSynchronGeneratorVBR(const String &uid, const String &name,
@@ -52,9 +52,9 @@ protected:
   ///
   void calculateResistanceMatrix();
   /// Park Transformation according to Kundur
-  Matrix get_parkTransformMatrix() const;
+  MatrixFixedSize<3, 3> get_parkTransformMatrix() const;
   /// Inverse Park Transformation according to Kundur
-  Matrix get_inverseParkTransformMatrix() const;
+  MatrixFixedSize<3, 3> get_inverseParkTransformMatrix() const;
 
   // ### MNA Section ###
   void mnaCompApplySystemMatrixStamp(SparseMatrixRow &systemMatrix) override;
@@ -11,12 +11,16 @@
 #include <dpsim-models/Base/Base_Ph3_Resistor.h>
 #include <dpsim-models/MNASimPowerComp.h>
 #include <dpsim-models/Solver/MNAInterface.h>
+#include <dpsim-models/Solver/MNALocalRightVectorInterface.h>
+#include <dpsim-models/Solver/MNATimeStepIndependentInterface.h>
 namespace CPS {
 namespace EMT {
 namespace Ph3 {
 /// EMT Resistor
 class Resistor : public MNASimPowerComp<Real>,
                  public Base::Ph3::Resistor,
+                 public MNALocalRightVectorInterface,
+                 public MNATimeStepIndependentInterface,
                  public SharedFactory<Resistor> {
 protected:
 public:
@@ -19,6 +19,7 @@ namespace EMT {
 namespace Ph3 {
 
 class RxLine : public CompositePowerComp<Real>,
+               public MNAVariableTimeStepComposite<Real>,
                public Base::Ph3::PiLine,
                public SharedFactory<RxLine> {
 protected:
@@ -12,6 +12,7 @@
 #include <dpsim-models/MNASimPowerComp.h>
 #include <dpsim-models/Solver/MNAInterface.h>
 #include <dpsim-models/Solver/MNASwitchInterface.h>
+#include <dpsim-models/Solver/MNATimeStepIndependentInterface.h>
 
 namespace CPS {
 namespace EMT {
@@ -24,6 +25,7 @@ namespace Ph3 {
 /// same for all phases and only in series.
 class SeriesSwitch : public MNASimPowerComp<Real>,
                      public Base::Ph1::Switch,
+                     public MNATimeStepIndependentInterface,
                      public SharedFactory<SeriesSwitch>,
                      public MNASwitchInterface {
 
@@ -40,6 +42,12 @@ public:
   SimPowerComp<Real>::Ptr clone(String name) override;
   /// Initializes states from power flow data
   void initializeFromNodesAndTerminals(Real frequency) override;
+  /// Switch state in addition to the interface quantities
+  AttributeBase::Map stateAttributes() override {
+    auto attributes = MNASimPowerComp<Real>::stateAttributes();
+    attributes["is_closed"] = mIsClosed;
+    return attributes;
+  }
 
   // #### General MNA section ####
   /// Initializes MNA specific variables
@@ -14,6 +14,7 @@
 #include <dpsim-models/MNASimPowerComp.h>
 #include <dpsim-models/Solver/MNAInterface.h>
 #include <dpsim-models/Solver/MNASwitchInterface.h>
+#include <dpsim-models/Solver/MNATimeStepIndependentInterface.h>
 
 namespace CPS {
 namespace EMT {
@@ -24,6 +25,7 @@ namespace Ph3 {
 /// Each state has a specific resistance value.
 class Switch : public MNASimPowerComp<Real>,
                public Base::Ph3::Switch,
+               public MNATimeStepIndependentInterface,
                public SharedFactory<Switch>,
                public MNASwitchInterface {
 
@@ -39,6 +41,12 @@ public:
   // #### General ####
   /// Initializes component from power flow data
   void initializeFromNodesAndTerminals(Real frequency) override;
+  /// Switch state in addition to the interface quantities
+  AttributeBase::Map stateAttributes() override {
+    auto attributes = MNASimPowerComp<Real>::stateAttributes();
+    attributes["is_closed"] = mSwitchClosed;
+    return attributes;
+  }
 
   // #### General MNA section ####
   void mnaCompInitialize(Real omega, Real timeStep,
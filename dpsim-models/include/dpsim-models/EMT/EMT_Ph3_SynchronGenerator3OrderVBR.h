@@ -26,7 +26,7 @@ public:
 
 protected:
   /// history term of VBR
-  Matrix mEhs_vbr;
+  MatrixFixedSize<3, 1> mEhs_vbr;
 
 public:
   ///
@@ -25,7 +25,7 @@ public:
 
 protected:
   /// history term of VBR
-  Matrix mEhs_vbr;
+  MatrixFixedSize<3, 1> mEhs_vbr;
 
 public:
   ///
@@ -28,9 +28,9 @@ public:
 
 protected:
   /// history term of voltage behind the transient reactance
-  Matrix mEh_t;
+  MatrixFixedSize<3, 1> mEh_t;
   /// history term of voltage behind the subtransient reactance
-  Matrix mEh_s;
+  MatrixFixedSize<3, 1> mEh_s;
 
 public:
   ///
@@ -18,6 +18,7 @@ namespace EMT {
 namespace Ph3 {
 /// Ideal voltage source representing a synchronous generator
 class SynchronGeneratorIdeal : public CompositePowerComp<Real>,
+                               public MNAVariableTimeStepComposite<Real>,
                                public SharedFactory<SynchronGeneratorIdeal> {
 private:
   /// Specifies type of ideal source
@@ -97,14 +97,14 @@ protected:
   Real mVfd;
 
   /// Phase currents in pu
-  Matrix mIabc = Matrix::Zero(3, 1);
+  MatrixFixedSize<3, 1> mIabc = MatrixFixedSize<3, 1>::Zero();
   ///Phase Voltages in pu
-  Matrix mVabc = Matrix::Zero(3, 1);
+  MatrixFixedSize<3, 1> mVabc = MatrixFixedSize<3, 1>::Zero();
   /// Subtransient voltage in pu
-  Matrix mDVabc = Matrix::Zero(3, 1);
+  MatrixFixedSize<3, 1> mDVabc = MatrixFixedSize<3, 1>::Zero();
 
   /// Dq stator current vector
-  Matrix mDqStatorCurrents = Matrix::Zero(2, 1);
+  MatrixFixedSize<2, 1> mDqStatorCurrents = MatrixFixedSize<2, 1>::Zero();
   /// Q axis stator current of  from last time step
   Real mIq_hist;
   /// D axis stator current of  from last time step
@@ -112,22 +112,24 @@ protected:
 
   // ### Useful Matrices ###
   /// inductance matrix
-  Matrix mDInductanceMat = Matrix::Zero(3, 3);
+  MatrixFixedSize<3, 3> mDInductanceMat = MatrixFixedSize<3, 3>::Zero();
 
   /// Q axis Rotor flux
-  Matrix mPsikq1kq2 = Matrix::Zero(2, 1);
+  MatrixFixedSize<2, 1> mPsikq1kq2 = MatrixFixedSize<2, 1>::Zero();
   /// D axis rotor flux
-  Matrix mPsifdkd = Matrix::Zero(2, 1);
+  MatrixFixedSize<2, 1> mPsifdkd = MatrixFixedSize<2, 1>::Zero();
   /// Equivalent Stator Conductance Matrix
-  Matrix mConductanceMat = Matrix::Zero(3, 3);
+  MatrixFixedSize<3, 3> mConductanceMat = MatrixFixedSize<3, 3>::Zero();
   /// Equivalent Stator Current Source
-  Matrix mISourceEq = Matrix::Zero(3, 1);
+  MatrixFixedSize<3, 1> mISourceEq = MatrixFixedSize<3, 1>::Zero();
   /// Dynamic Voltage Vector
-  Matrix mDVqd = Matrix::Zero(2, 1);
+  MatrixFixedSize<2, 1> mDVqd = MatrixFixedSize<2, 1>::Zero();
   /// Equivalent VBR Stator Resistance
   MatrixFixedSize<3, 3> R_eq_vbr = MatrixFixedSize<3, 3>::Zero(3, 3);
+  /// Inverse of the equivalent VBR stator resistance
+  MatrixFixedSize<3, 3> R_eq_vbr_inv = MatrixFixedSize<3, 3>::Zero();
   /// Equivalent VBR Stator Voltage Source
-  Matrix E_eq_vbr = Matrix::Zero(3, 1);
+  MatrixFixedSize<3, 1> E_eq_vbr = MatrixFixedSize<3, 1>::Zero();
   /// Park Transformation Matrix
   MatrixFixedSize<3, 3> mKrs_teta = MatrixFixedSize<3, 3>::Zero(3, 3);
   /// Inverse Park Transformation Matrix
@@ -139,16 +141,18 @@ protected:
   Real c13_omega;
   Real c14_omega;
   MatrixFixedSize<2, 2> K1a = MatrixFixedSize<2, 2>::Zero(2, 2);
-  Matrix K1b = Matrix::Zero(2, 1);
-  Matrix K1 = Matrix::Zero(2, 1);
+  /// K1a with a single damping winding in the q axis
+  MatrixFixedSize<2, 1> K1a_1d = MatrixFixedSize<2, 1>::Zero();
+  MatrixFixedSize<2, 1> K1b = MatrixFixedSize<2, 1>::Zero();
+  MatrixFixedSize<2, 1> K1 = MatrixFixedSize<2, 1>::Zero();
   MatrixFixedSize<2, 2> K2a = MatrixFixedSize<2, 2>::Zero(2, 2);
-  Matrix K2b = Matrix::Zero(2, 1);
-  Matrix K2 = Matrix::Zero(2, 1);
-  Matrix H_qdr = Matrix::Zero(3, 1);
-  Matrix h_qdr;
+  MatrixFixedSize<2, 1> K2b = MatrixFixedSize<2, 1>::Zero();
+  MatrixFixedSize<2, 1> K2 = MatrixFixedSize<2, 1>::Zero();
+  MatrixFixedSize<3, 1> H_qdr = MatrixFixedSize<3, 1>::Zero();
+  MatrixFixedSize<2, 1> h_qdr = MatrixFixedSize<2, 1>::Zero();
   MatrixFixedSize<3, 3> K = MatrixFixedSize<3, 3>::Zero(3, 3);
-  Matrix mEsh_vbr = Matrix::Zero(3, 1);
-  Matrix E_r_vbr = Matrix::Zero(3, 1);
+  MatrixFixedSize<3, 1> mEsh_vbr = MatrixFixedSize<3, 1>::Zero();
+  MatrixFixedSize<3, 1> E_r_vbr = MatrixFixedSize<3, 1>::Zero();
   MatrixFixedSize<2, 2> K1K2 = MatrixFixedSize<2, 2>::Zero(2, 2);
 
   /// Auxiliar constants
@@ -177,19 +181,18 @@ protected:
   Real E2_1d;
 
   MatrixFixedSize<2, 2> Ea = MatrixFixedSize<2, 2>::Zero(2, 2);
-  Matrix E1b = Matrix::Zero(2, 1);
-  // CHECK: E1 and F1 seem to be vectors (Zero(2, 1)) and not matrices
-  Matrix E1 = Matrix::Zero(2, 2);
+  MatrixFixedSize<2, 1> E1b = MatrixFixedSize<2, 1>::Zero();
+  MatrixFixedSize<2, 1> E1 = MatrixFixedSize<2, 1>::Zero();
   MatrixFixedSize<2, 2> Fa = MatrixFixedSize<2, 2>::Zero(2, 2);
-  Matrix F1b = Matrix::Zero(2, 1);
-  Matrix F1 = Matrix::Zero(2, 2);
+  MatrixFixedSize<2, 1> F1b = MatrixFixedSize<2, 1>::Zero();
+  MatrixFixedSize<2, 1> F1 = MatrixFixedSize<2, 1>::Zero();
   MatrixFixedSize<2, 2> E2b = MatrixFixedSize<2, 2>::Zero(2, 2);
   MatrixFixedSize<2, 2> E2 = MatrixFixedSize<2, 2>::Zero(2, 2);
   MatrixFixedSize<2, 2> F2b = MatrixFixedSize<2, 2>::Zero(2, 2);
   MatrixFixedSize<2, 2> F2 = MatrixFixedSize<2, 2>::Zero(2, 2);
-  Matrix F3b = Matrix::Zero(2, 1);
-  Matrix F3 = Matrix::Zero(2, 2);
-  Matrix C26 = Matrix::Zero(2, 1);
+  MatrixFixedSize<2, 1> F3b = MatrixFixedSize<2, 1>::Zero();
+  MatrixFixedSize<2, 1> F3 = MatrixFixedSize<2, 1>::Zero();
+  MatrixFixedSize<2, 1> C26 = MatrixFixedSize<2, 1>::Zero();
 
 public:
   /// Defines UID, name and logging level
@@ -238,10 +241,11 @@ public:
   void stepInPerUnit();
 
   /// Park transform as described in Krause
-  Matrix parkTransform(Real theta, Real a, Real b, Real c);
+  MatrixFixedSize<3, 1> parkTransform(Real theta, Real a, Real b, Real c);
 
   /// Inverse Park transform as described in Krause
-  Matrix inverseParkTransform(Real theta, Real q, Real d, Real zero);
+  MatrixFixedSize<3, 1> inverseParkTransform(Real theta, Real q, Real d,
+                                             Real zero);
 
   /// Calculate inductance Matrix L and its derivative
   void CalculateL();
@@ -250,11 +254,11 @@ public:
 
   /// Getters
   //Matrix& rotorFluxes() { return mRotorFlux; }
-  Matrix &dqStatorCurrents() { return mDqStatorCurrents; }
+  MatrixFixedSize<2, 1> &dqStatorCurrents() { return mDqStatorCurrents; }
   Real electricalTorque() const { return **mElecTorque * mBase_T; }
   Real rotationalSpeed() const { return **mOmMech * mBase_OmMech; }
   Real rotorPosition() const { return mThetaMech; }
-  Matrix &statorCurrents() { return mIabc; }
+  MatrixFixedSize<3, 1> &statorCurrents() { return mIabc; }
 
   // #### MNA section ####
   /// Stamps system matrix
@@ -20,6 +20,7 @@ namespace EMT {
 namespace Ph3 {
 /// Transformer that includes an inductance and resistance
 class Transformer : public CompositePowerComp<Real>,
+                    public MNAVariableTimeStepComposite<Real>,
                     public SharedFactory<Transformer>,
                     public Base::Ph3::Transformer {
 private:
@@ -13,6 +13,8 @@
 #include <dpsim-models/Signal/SignalGenerator.h>
 #include <dpsim-models/Signal/SineWaveGenerator.h>
 #include <dpsim-models/Solver/MNAInterface.h>
+#include <dpsim-models/Solver/MNALocalRightVectorInterface.h>
+#include <dpsim-models/Solver/MNATimeStepIndependentInterface.h>
 
 namespace CPS {
 namespace EMT {
@@ -26,6 +28,8 @@ namespace Ph3 {
 /// of node k as negative. Moreover
 /// a new equation ej - ek = V is added to the problem.
 class VoltageSource : public MNASimPowerComp<Real>,
+                      public MNALocalRightVectorInterface,
+                      public MNATimeStepIndependentInterface,
                       public SharedFactory<VoltageSource> {
 private:
   ///
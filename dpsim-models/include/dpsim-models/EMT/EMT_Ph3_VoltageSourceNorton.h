@@ -10,6 +10,8 @@
 #include <dpsim-models/Base/Base_Ph1_VoltageSource.h>
 #include <dpsim-models/MNASimPowerComp.h>
 #include <dpsim-models/Solver/MNAInterface.h>
+#include <dpsim-models/Solver/MNALocalRightVectorInterface.h>
+#include <dpsim-models/Solver/MNATimeStepIndependentInterface.h>
 
 namespace CPS {
 namespace EMT {
@@ -17,6 +19,8 @@ namespace Ph3 {
 /// \brief Voltage source with Norton equivalent model
 class VoltageSourceNorton : public MNASimPowerComp<Real>,
                             public Base::Ph1::VoltageSource,
+                            public MNALocalRightVectorInterface,
+                            public MNATimeStepIndependentInterface,
                             public SharedFactory<VoltageSourceNorton> {
 protected:
   void updateState(Real time);
@@ -63,5 +63,8 @@ public:
   String type() { return Utils::className(this); }
   // Returns a description of the object
   virtual String description() { return ""; }
+  /// Attributes holding the state of the object between two steps, e.g. for
+  /// checkpoints. Parameters are not part of the state.
+  virtual AttributeBase::Map stateAttributes() { return {}; }
 };
 } // namespace CPS
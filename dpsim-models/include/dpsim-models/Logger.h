@@ -41,6 +41,9 @@ public:
   static String prefix();
   static String logDir();
   static void setLogDir(String path);
+  /// Overrides the log directory for the calling thread, e.g. to separate the
+  /// logs of scenarios simulated concurrently. An empty path removes it.
+  static void setThreadLogDir(String path);
 
   // #### SPD log wrapper ####
   ///
@@ -11,6 +11,8 @@
 #include <dpsim-models/Base/Base_Ph1_Capacitor.h>
 #include <dpsim-models/MNASimPowerComp.h>
 #include <dpsim-models/Solver/MNAInterface.h>
+#include <dpsim-models/Solver/MNALocalRightVectorInterface.h>
+#include <dpsim-models/Solver/MNATimeStepIndependentInterface.h>
 #include <dpsim-models/Solver/PFSolverInterfaceBranch.h>
 
 namespace CPS {
@@ -18,6 +20,8 @@ namespace SP {
 namespace Ph1 {
 class Capacitor : public MNASimPowerComp<Complex>,
                   public Base::Ph1::Capacitor,
+                  public MNALocalRightVectorInterface,
+                  public MNATimeStepIndependentInterface,
                   public SharedFactory<Capacitor>,
                   public PFSolverInterfaceBranch {
 
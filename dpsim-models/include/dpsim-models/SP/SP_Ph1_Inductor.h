@@ -11,7 +11,9 @@
 #include <dpsim-models/MNASimPowerComp.h>
 
 #include <dpsim-models/Base/Base_Ph1_Inductor.h>
+#include <dpsim-models/Solver/MNALocalRightVectorInterface.h>
 #include <dpsim-models/Solver/MNATearInterface.h>
+#include <dpsim-models/Solver/MNATimeStepIndependentInterface.h>
 
 namespace CPS {
 namespace SP {
@@ -20,6 +22,8 @@ namespace Ph1 {
 class Inductor : public MNASimPowerComp<Complex>,
                  public Base::Ph1::Inductor,
                  public MNATearInterface,
+                 public MNALocalRightVectorInterface,
+                 public MNATimeStepIndependentInterface,
                  public SharedFactory<Inductor> {
 protected:
   /// susceptance [S]
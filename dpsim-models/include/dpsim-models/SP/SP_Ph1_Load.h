@@ -22,6 +22,7 @@ namespace CPS {
 namespace SP {
 namespace Ph1 {
 class Load : public CompositePowerComp<Complex>,
+             public MNAVariableTimeStepComposite<Complex>,
              public SharedFactory<Load>,
              public PFSolverInterfaceBus {
 public:
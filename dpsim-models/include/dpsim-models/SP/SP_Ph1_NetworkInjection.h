@@ -11,6 +11,7 @@
 #include <dpsim-models/CompositePowerComp.h>
 #include <dpsim-models/SP/SP_Ph1_VoltageSource.h>
 #include <dpsim-models/Solver/DAEInterface.h>
+#include <dpsim-models/Solver/MNALocalRightVectorInterface.h>
 #include <dpsim-models/Solver/PFSolverInterfaceBus.h>
 
 namespace CPS {
@@ -24,6 +25,8 @@ namespace Ph1 {
 /// the frequency, magnitude and phase of the sine wave can be modified through the mVoltageRef and mSrcFreq attributes.
 /// See SP_Ph1_VoltageSource.h for more details.
 class NetworkInjection : public CompositePowerComp<Complex>,
+                         public MNAVariableTimeStepComposite<Complex>,
+                         public MNALocalRightVectorInterface,
                          public SharedFactory<NetworkInjection>,
                          public PFSolverInterfaceBus,
                          public DAEInterface {
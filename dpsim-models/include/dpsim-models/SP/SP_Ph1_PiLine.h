@@ -13,6 +13,7 @@
 #include <dpsim-models/SP/SP_Ph1_Capacitor.h>
 #include <dpsim-models/SP/SP_Ph1_Inductor.h>
 #include <dpsim-models/SP/SP_Ph1_Resistor.h>
+#include <dpsim-models/Solver/MNALocalRightVectorInterface.h>
 #include <dpsim-models/Solver/MNATearInterface.h>
 #include <dpsim-models/Solver/PFSolverInterfaceBranch.h>
 
@@ -24,8 +25,10 @@ namespace Ph1 {
 /// For MNA this model consists sub components to represent the
 /// RLC elements of a PI-line.
 class PiLine : public CompositePowerComp<Complex>,
+               public MNAVariableTimeStepComposite<Complex>,
                public Base::Ph1::PiLine,
                public MNATearInterface,
+               public MNALocalRightVectorInterface,
                public SharedFactory<PiLine>,
                public PFSolverInterfaceBranch {
 public:
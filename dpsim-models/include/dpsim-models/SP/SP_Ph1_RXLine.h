@@ -19,6 +19,7 @@ namespace SP {
 namespace Ph1 {
 
 class RXLine : public CompositePowerComp<Complex>,
+               public MNAVariableTimeStepComposite<Complex>,
                public SharedFactory<RXLine>,
                public PFSolverInterfaceBranch,
                public Base::Ph1::PiLine {
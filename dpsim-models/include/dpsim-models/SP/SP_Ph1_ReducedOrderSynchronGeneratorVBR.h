@@ -14,10 +14,14 @@
 namespace CPS {
 namespace SP {
 namespace Ph1 {
+class SynchronGeneratorVBRGroup;
+
 /// @brief Base class for SP VBR synchronous generator model single phase
 class ReducedOrderSynchronGeneratorVBR
     : public Base::ReducedOrderSynchronGenerator<Complex>,
       public MNAVariableCompInterface {
+  friend class SynchronGeneratorVBRGroup;
+
 public:
   // Common elements of all VBR models
   /// voltage behind reactance phase a
@@ -56,6 +60,41 @@ protected:
   ///
   Matrix get_DqToComplexATransformMatrix() const;
 
+  // ### Scalar kernels, shared with SynchronGeneratorVBRGroup ###
+  // cosTheta and sinTheta are the entries of the first column of mDqToComplexA
+
+  /// Rotates a dq quantity into the complex phasor of phase a
+  static void dqToComplexA(Real cosTheta, Real sinTheta, Real d, Real q,
+                           Real &re, Real &im) {
+    re = cosTheta * d - sinTheta * q;
+    im = sinTheta * d + cosTheta * q;
+  }
+  /// Rotates the complex phasor of phase a into the dq reference frame
+  static void complexAToDq(Real cosTheta, Real sinTheta, Real re, Real im,
+                           Real &d, Real &q) {
+    d = cosTheta * re + sinTheta * im;
+    q = cosTheta * im - sinTheta * re;
+  }
+  /// Inverse of the resistance matrix [0 A; B 0] in the dq reference frame
+  /// after rotation into the complex reference frame, scaled by baseZ.
+  /// Closed form of (mDqToComplexA * R * mComplexAToDq * baseZ)^-1.
+  static void conductanceMatrix(Real cosTheta, Real sinTheta, Real A, Real B,
+                                Real baseZ, Real &g00, Real &g01, Real &g10,
+                                Real &g11) {
+    Real cc = cosTheta * cosTheta;
+    Real ss = sinTheta * sinTheta;
+    Real cs = cosTheta * sinTheta * (A + B);
+    Real r00 = -cs * baseZ;
+    Real r01 = (cc * A - ss * B) * baseZ;
+    Real r10 = (cc * B - ss * A) * baseZ;
+    Real r11 = cs * baseZ;
+    Real invDet = 1. / (r00 * r11 - r01 * r10);
+    g00 = r11 * invDet;
+    g01 = -r01 * invDet;
+    g10 = -r10 * invDet;
+    g11 = r00 * invDet;
+  }
+
   // ### MNA Section ###
   ///
   void mnaCompApplySystemMatrixStamp(SparseMatrixRow &systemMatrix) override;
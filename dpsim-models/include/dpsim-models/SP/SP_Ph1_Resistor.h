@@ -12,7 +12,9 @@
 #include <dpsim-models/Definitions.h>
 #include <dpsim-models/Logger.h>
 #include <dpsim-models/MNASimPowerComp.h>
+#include <dpsim-models/Solver/MNALocalRightVectorInterface.h>
 #include <dpsim-models/Solver/MNATearInterface.h>
+#include <dpsim-models/Solver/MNATimeStepIndependentInterface.h>
 #include <dpsim-models/Solver/PFSolverInterfaceBranch.h>
 
 namespace CPS {
@@ -22,6 +24,8 @@ namespace Ph1 {
 class Resistor : public MNASimPowerComp<Complex>,
                  public Base::Ph1::Resistor,
                  public MNATearInterface,
+                 public MNALocalRightVectorInterface,
+                 public MNATimeStepIndependentInterface,
                  public SharedFactory<Resistor>,
                  public PFSolverInterfaceBranch {
 
@@ -18,6 +18,8 @@ namespace Ph1 {
 class SynchronGenerator3OrderVBR
     : public ReducedOrderSynchronGeneratorVBR,
       public SharedFactory<SynchronGenerator3OrderVBR> {
+  friend class SynchronGeneratorVBRGroup;
+
 public:
   // #### Model specific variables ####
   /// voltage behind transient reactance
@@ -18,6 +18,8 @@ namespace Ph1 {
 class SynchronGenerator4OrderVBR
     : public ReducedOrderSynchronGeneratorVBR,
       public SharedFactory<SynchronGenerator4OrderVBR> {
+  friend class SynchronGeneratorVBRGroup;
+
 public:
   // ### Model specific elements ###
   /// transient voltage
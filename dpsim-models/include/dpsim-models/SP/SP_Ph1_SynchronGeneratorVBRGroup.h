@@ -0,0 +1,150 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#pragma once
+
+#include <unordered_set>
+#include <vector>
+
+#include <dpsim-models/SP/SP_Ph1_SynchronGenerator3OrderVBR.h>
+#include <dpsim-models/SP/SP_Ph1_SynchronGenerator4OrderVBR.h>
+#include <dpsim-models/Solver/MNAInterface.h>
+#include <dpsim-models/Task.h>
+
+namespace CPS {
+namespace SP {
+namespace Ph1 {
+/// @brief Steps a group of SP VBR generators of the same model type at once
+///
+/// Replaces the MNA pre- and post-step tasks of its members. The per-unit
+/// states are gathered into one array per quantity, updated with plain loops
+/// over all generators and written back to the members, so that the results
+/// are the same as for the individual tasks. Supported are the 3rd and 4th
+/// order VBR models.
+class SynchronGeneratorVBRGroup {
+public:
+  using Ptr = std::shared_ptr<SynchronGeneratorVBRGroup>;
+  using List = std::vector<Ptr>;
+
+  /// All members must be initialized for MNA and of the same model type
+  SynchronGeneratorVBRGroup(
+      const String &name,
+      const std::vector<std::shared_ptr<ReducedOrderSynchronGeneratorVBR>>
+          &members,
+      Attribute<Matrix>::Ptr leftVector);
+
+  /// Whether the generator can be a member of a group
+  static Bool isSupported(const MNAInterface::Ptr &comp);
+  /// Creates one group per model type with at least two supported
+  /// generators among the components
+  static List createGroups(const String &name,
+                           const MNAInterface::List &components,
+                           Attribute<Matrix>::Ptr leftVector);
+
+  /// Whether the component is stepped by this group
+  Bool contains(const MNAInterface::Ptr &comp) const;
+  UInt size() const { return static_cast<UInt>(mMembers.size()); }
+  const Task::List &mnaTasks() const { return mMnaTasks; }
+
+  void mnaPreStep(Real time, Int timeStepCount);
+  void mnaPostStep(const Matrix &leftVector);
+
+  class MnaPreStep : public Task {
+  public:
+    explicit MnaPreStep(SynchronGeneratorVBRGroup &group);
+    void execute(Real time, Int timeStepCount) override {
+      mGroup.mnaPreStep(time, timeStepCount);
+    }
+
+  private:
+    SynchronGeneratorVBRGroup &mGroup;
+  };
+
+  class MnaPostStep : public Task {
+  public:
+    explicit MnaPostStep(SynchronGeneratorVBRGroup &group);
+    void execute(Real time, Int timeStepCount) override {
+      mGroup.mnaPostStep(**mGroup.mLeftVector);
+    }
+
+  private:
+    SynchronGeneratorVBRGroup &mGroup;
+  };
+
+private:
+  /// Copies the per-unit states of the members into the arrays
+  void gatherStates();
+
+  String mName;
+  SGOrder mOrder;
+  std::vector<std::shared_ptr<ReducedOrderSynchronGeneratorVBR>> mMembers;
+  std::unordered_set<const MNAInterface *> mMemberSet;
+  /// Transient voltage and VBR history voltage of the members
+  std::vector<Attribute<Matrix>::Ptr> mEdq_t;
+  std::vector<Matrix *> mEh_vbr;
+  Attribute<Matrix>::Ptr mLeftVector;
+  Task::List mMnaTasks;
+
+  // ### Parameters ###
+  std::vector<Real> mH;
+  std::vector<Real> mLd_t;
+  std::vector<Real> mLq_t;
+  std::vector<Real> mAd_t;
+  std::vector<Real> mBd_t;
+  std::vector<Real> mAq_t;
+  std::vector<Real> mBq_t;
+  std::vector<Real> mDq_t;
+  std::vector<Real> mA;
+  std::vector<Real> mB;
+  std::vector<Real> mBase_Z;
+  std::vector<Real> mBase_V_RMS;
+  std::vector<Real> mBase_I_RMS;
+  std::vector<Real> mBase_OmMech;
+  /// Matrix node index of the terminal and virtual node of the voltage source
+  std::vector<Matrix::Index> mNodeIndex;
+  std::vector<Matrix::Index> mVirtualNodeIndex;
+  Real mTimeStep;
+
+  // ### States in per unit ###
+  std::vector<Real> mVd;
+  std::vector<Real> mVq;
+  std::vector<Real> mId;
+  std::vector<Real> mIq;
+  std::vector<Real> mEd_t;
+  std::vector<Real> mEq_t;
+  std::vector<Real> mEf;
+  std::vector<Real> mEf_prev;
+  std::vector<Real> mMechTorque_prev;
+  std::vector<Real> mElecTorque;
+  std::vector<Real> mOmMech;
+  std::vector<Real> mThetaMech;
+  std::vector<Real> mDelta;
+
+  // ### Network interface ###
+  /// Rotation between dq and complex reference frame
+  std::vector<Real> mCosTheta;
+  std::vector<Real> mSinTheta;
+  /// Conductance matrix of each member
+  std::vector<Real> mG00;
+  std::vector<Real> mG01;
+  std::vector<Real> mG10;
+  std::vector<Real> mG11;
+  /// VBR history voltage in dq and complex reference frame
+  std::vector<Real> mEhD;
+  std::vector<Real> mEhQ;
+  std::vector<Real> mEhRe;
+  std::vector<Real> mEhIm;
+  /// Interface voltage and current in the complex reference frame
+  std::vector<Real> mVRe;
+  std::vector<Real> mVIm;
+  std::vector<Real> mIRe;
+  std::vector<Real> mIIm;
+};
+} // namespace Ph1
+} // namespace SP
+} // namespace CPS
@@ -21,6 +21,7 @@ namespace SP {
 namespace Ph1 {
 /// Transformer that includes an inductance and resistance
 class Transformer : public CompositePowerComp<Complex>,
+                    public MNAVariableTimeStepComposite<Complex>,
                     public Base::Ph1::Transformer,
                     public SharedFactory<Transformer>,
                     public PFSolverInterfaceBranch {
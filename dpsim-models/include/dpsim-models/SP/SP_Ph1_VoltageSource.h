@@ -15,6 +15,8 @@
 #include <dpsim-models/Signal/SineWaveGenerator.h>
 #include <dpsim-models/Solver/DAEInterface.h>
 #include <dpsim-models/Solver/MNAInterface.h>
+#include <dpsim-models/Solver/MNALocalRightVectorInterface.h>
+#include <dpsim-models/Solver/MNATimeStepIndependentInterface.h>
 
 namespace CPS {
 namespace SP {
@@ -38,6 +40,8 @@ namespace Ph1 {
 /// a new equation ej - ek = V is added to the problem.
 class VoltageSource : public MNASimPowerComp<Complex>,
                       public DAEInterface,
+                      public MNALocalRightVectorInterface,
+                      public MNATimeStepIndependentInterface,
                       public SharedFactory<VoltageSource> {
 private:
   ///
@@ -11,6 +11,7 @@
 #include <dpsim-models/Base/Base_Ph3_Capacitor.h>
 #include <dpsim-models/MNASimPowerComp.h>
 #include <dpsim-models/Solver/MNAInterface.h>
+#include <dpsim-models/Solver/MNATimeStepIndependentInterface.h>
 
 namespace CPS {
 namespace SP {
@@ -24,6 +25,7 @@ namespace Ph3 {
 /// frequency and the current source changes for each iteration.
 class Capacitor : public MNASimPowerComp<Complex>,
                   public Base::Ph3::Capacitor,
+                  public MNATimeStepIndependentInterface,
                   public SharedFactory<Capacitor> {
 protected:
   /// Equivalent conductance [S]
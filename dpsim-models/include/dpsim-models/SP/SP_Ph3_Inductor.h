@@ -12,6 +12,7 @@
 
 #include <dpsim-models/Base/Base_Ph3_Inductor.h>
 #include <dpsim-models/Solver/MNATearInterface.h>
+#include <dpsim-models/Solver/MNATimeStepIndependentInterface.h>
 
 namespace CPS {
 namespace SP {
@@ -26,6 +27,7 @@ namespace Ph3 {
 class Inductor : public MNASimPowerComp<Complex>,
                  public Base::Ph3::Inductor,
                  public MNATearInterface,
+                 public MNATimeStepIndependentInterface,
                  public SharedFactory<Inductor> {
 protected:
   /// susceptance [S]
@@ -13,6 +13,7 @@
 #include <dpsim-models/Logger.h>
 #include <dpsim-models/MNASimPowerComp.h>
 #include <dpsim-models/Solver/MNATearInterface.h>
+#include <dpsim-models/Solver/MNATimeStepIndependentInterface.h>
 
 namespace CPS {
 namespace SP {
@@ -21,6 +22,7 @@ namespace Ph3 {
 class Resistor : public MNASimPowerComp<Complex>,
                  public Base::Ph3::Resistor,
                  public MNATearInterface,
+                 public MNATimeStepIndependentInterface,
                  public SharedFactory<Resistor> {
 
 public:
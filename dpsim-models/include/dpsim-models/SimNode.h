@@ -82,6 +82,8 @@ public:
   void setVoltage(VarType newVoltage) {}
   ///
   void setPower(VarType newPower) {}
+  /// Node voltage
+  AttributeBase::Map stateAttributes() override { return {{"v", mVoltage}}; }
 
   // #### MNA Section ####
   ///
@@ -145,5 +145,10 @@ public:
   virtual void initialize(Matrix frequencies);
   /// Initializes Component variables according to power flow data stored in Nodes.
   virtual void initializeFromNodesAndTerminals(Real frequency) {}
+  /// Interface voltage and current, from which companion models compute their
+  /// history terms. Components with further states have to add them.
+  AttributeBase::Map stateAttributes() override {
+    return {{"v_intf", mIntfVoltage}, {"i_intf", mIntfCurrent}};
+  }
 };
 } // namespace CPS
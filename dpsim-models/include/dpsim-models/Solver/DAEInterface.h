@@ -19,6 +19,9 @@ public:
 
   using ResFn = std::function<void(double, const double *, const double *,
                                    double *, std::vector<int> &)>;
+  using JacFn =
+      std::function<void(double, const double *, const double *, double,
+                         SparseMatrix &, std::vector<int> &)>;
 
   // #### DAE Section ####
   ///Residual Function for DAE Solver
@@ -27,5 +30,16 @@ public:
                            std::vector<int> &off) = 0;
   ///Voltage Getter for Components
   virtual Complex daeInitialize() = 0;
+
+  /// Returns true if the component implements daeJacobian. Otherwise, the
+  /// solver approximates the Jacobian by finite differences.
+  virtual Bool daeHasJacobian() { return false; }
+  /// Adds the partial derivatives dF/dy + cj * dF/dy' of the component's
+  /// residual equations to the Jacobian and advances the offsets like
+  /// daeResidual. All structurally nonzero entries have to be added, even if
+  /// their current value is zero, as the sparsity pattern is fixed on the first call.
+  virtual void daeJacobian(double ttime, const double state[],
+                           const double dstate_dt[], double cj,
+                           SparseMatrix &jacobian, std::vector<int> &off) {}
 };
 } // namespace CPS
@@ -0,0 +1,25 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#pragma once
+
+#include <dpsim-models/Config.h>
+#include <dpsim-models/Definitions.h>
+
+namespace CPS {
+/// MNA interface to be used by elements whose right side vector stamp only
+/// has entries at the matrix node indices of their terminals and virtual
+/// nodes. For composites, this applies to the parent stamp, the solver also
+/// requires all subcomponents to implement this interface.
+class MNALocalRightVectorInterface {
+public:
+  typedef std::shared_ptr<MNALocalRightVectorInterface> Ptr;
+
+  virtual ~MNALocalRightVectorInterface() = default;
+};
+} // namespace CPS
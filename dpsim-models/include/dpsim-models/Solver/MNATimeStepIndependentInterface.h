@@ -0,0 +1,24 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#pragma once
+
+#include <dpsim-models/Config.h>
+#include <dpsim-models/Definitions.h>
+
+namespace CPS {
+/// MNA interface to be used by elements whose stamps and states do not depend
+/// on the time step, so that they can be used with variable time steps
+/// without implementing MNAVariableTimeStepInterface
+class MNATimeStepIndependentInterface {
+public:
+  typedef std::shared_ptr<MNATimeStepIndependentInterface> Ptr;
+
+  virtual ~MNATimeStepIndependentInterface() = default;
+};
+} // namespace CPS
@@ -0,0 +1,26 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#pragma once
+
+#include <dpsim-models/Config.h>
+#include <dpsim-models/Definitions.h>
+
+namespace CPS {
+/// MNA interface to be used by elements with a time step dependent companion
+/// model that can change the time step during the simulation
+class MNAVariableTimeStepInterface {
+public:
+  typedef std::shared_ptr<MNAVariableTimeStepInterface> Ptr;
+  typedef std::vector<Ptr> List;
+
+  /// Updates the time step dependent coefficients between two steps. The
+  /// history terms follow from the interface quantities in the next pre-step.
+  virtual void mnaUpdateTimeStep(Real omega, Real timeStep) = 0;
+};
+} // namespace CPS
@@ -28,6 +28,8 @@ public:
 
   using JacFn = std::function<void(double, const double *, double *, double *,
                                    double *, double *, double *)>;
+  using SparseJacFn = std::function<void(double, const double *,
+                                         const double *, SparseMatrix &)>;
 
   // #### ODE Section ####
   /// State Space Equation System for ODE Solver
@@ -37,6 +39,15 @@ public:
   virtual void odeJacobian(double t, const double y[], double fy[], double J[],
                            double tmp1[], double tmp2[], double tmp3[]) = 0;
 
+  /// Returns true if the component implements odeSparseJacobian. Otherwise,
+  /// the implicit solver uses the dense odeJacobian.
+  virtual Bool odeHasSparseJacobian() { return false; }
+  /// Sets the partial derivatives df/dy of the state space equations. All
+  /// structurally nonzero entries have to be set, even if their current value
+  /// is zero, as the sparsity pattern is fixed on the first call.
+  virtual void odeSparseJacobian(double t, const double y[], const double fy[],
+                                 SparseMatrix &jacobian) {}
+
 protected:
   explicit ODEInterface(AttributeList::Ptr attrList)
       : mAttributeList(attrList),
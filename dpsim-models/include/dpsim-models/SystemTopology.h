@@ -9,6 +9,7 @@
 #pragma once
 
 #include <algorithm>
+#include <unordered_map>
 #include <vector>
 
 #include <dpsim-models/SimNode.h>
@@ -128,16 +129,7 @@ public:
   /// Returns Component by name
   template <typename Type>
   typename std::shared_ptr<Type> component(const String &name) {
-    for (auto comp : mComponents) {
-      if (comp->name() == name) {
-        auto comp2 = std::dynamic_pointer_cast<Type>(comp);
-        if (comp2)
-          return comp2;
-        else
-          return nullptr;
-      }
-    }
-    return nullptr;
+    return std::dynamic_pointer_cast<Type>(findComponent(name));
   }
 
   std::map<String, String, std::less<>> listIdObjects() const;
@@ -167,6 +159,19 @@ public:
 #endif
 
 private:
+  /// Positions of the objects in a list by name, kept up to date by the add
+  /// and remove methods. As the lists are public members, hits are validated
+  /// on lookup.
+  struct NameIndex {
+    std::unordered_map<String, UInt> positions;
+  };
+
+  NameIndex mNodeIndex;
+  NameIndex mComponentIndex;
+
+  TopologicalNode::Ptr findNode(const String &name);
+  IdentifiedObject::Ptr findComponent(const String &name);
+
   template <typename VarType> void multiplyPowerComps(Int numberCopies);
 };
 } // namespace CPS
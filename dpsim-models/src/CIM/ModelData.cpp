@@ -0,0 +1,210 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <thread>
+
+#include <dpsim-models/CIM/ModelData.h>
+
+using namespace CPS;
+using namespace CPS::CIM;
+
+namespace {
+/// Writes values in native byte order, strings and vectors with their size
+class OutputArchive {
+public:
+  OutputArchive(std::ofstream &file) : mFile(file) {}
+
+  template <typename... Args> void operator()(Args &...args) {
+    (write(args), ...);
+  }
+
+private:
+  void write(String &value) {
+    writeSize(value.size());
+    mFile.write(value.data(), value.size());
+  }
+  void write(Real &value) { writeRaw(value); }
+  void write(Int &value) { writeRaw(static_cast<std::int32_t>(value)); }
+  void write(Bool &value) { writeRaw(static_cast<std::uint8_t>(value)); }
+  template <typename T> void write(std::vector<T> &values) {
+    writeSize(values.size());
+    for (auto &value : values)
+      write(value);
+  }
+  template <typename T> void write(T &value) { value.serialize(*this); }
+
+  void writeSize(std::size_t size) {
+    writeRaw(static_cast<std::uint32_t>(size));
+  }
+  template <typename T> void writeRaw(const T &value) {
+    mFile.write(reinterpret_cast<const char *>(&value), sizeof(value));
+  }
+
+  std::ofstream &mFile;
+};
+
+/// Reads the values written by OutputArchive from a buffer
+class InputArchive {
+public:
+  InputArchive(const std::vector<char> &buffer, std::size_t pos)
+      : mBuffer(buffer), mPos(pos) {}
+
+  template <typename... Args> void operator()(Args &...args) {
+    (read(args), ...);
+  }
+
+private:
+  void read(String &value) {
+    std::size_t size = readSize();
+    require(size);
+    value.assign(mBuffer.data() + mPos, size);
+    mPos += size;
+  }
+  void read(Real &value) { readRaw(value); }
+  void read(Int &value) {
+    std::int32_t raw;
+    readRaw(raw);
+    value = raw;
+  }
+  void read(Bool &value) {
+    std::uint8_t raw;
+    readRaw(raw);
+    value = raw != 0;
+  }
+  template <typename T> void read(std::vector<T> &values) {
+    std::size_t size = readSize();
+    // Every element takes at least one byte
+    require(size);
+    values.resize(size);
+    for (auto &value : values)
+      read(value);
+  }
+  template <typename T> void read(T &value) { value.serialize(*this); }
+
+  std::size_t readSize() {
+    std::uint32_t size;
+    readRaw(size);
+    return size;
+  }
+  template <typename T> void readRaw(T &value) {
+    require(sizeof(value));
+    std::memcpy(&value, mBuffer.data() + mPos, sizeof(value));
+    mPos += sizeof(value);
+  }
+  void require(std::size_t size) {
+    if (mBuffer.size() - mPos < size)
+      throw std::runtime_error("Truncated CIM model cache");
+  }
+
+  const std::vector<char> &mBuffer;
+  std::size_t mPos;
+};
+} // namespace
+
+String ModelData::contentHash(const std::list<fs::path> &filenames) {
+  // 64-bit FNV-1a over the file sizes and contents
+  std::uint64_t hash = 14695981039346656037ull;
+  auto add = [&hash](const char *data, std::size_t size) {
+    for (std::size_t idx = 0; idx < size; ++idx) {
+      hash ^= static_cast<unsigned char>(data[idx]);
+      hash *= 1099511628211ull;
+    }
+  };
+
+  std::vector<char> chunk(1 << 16);
+  for (auto &filename : filenames) {
+    std::ifstream file(filename, std::ios_base::in | std::ios_base::binary);
+    if (!file.is_open())
+      throw std::runtime_error("Cannot open CIM file " + filename.string());
+
+    std::uint64_t size = 0;
+    while (file.read(chunk.data(), chunk.size()) || file.gcount() > 0) {
+      add(chunk.data(), static_cast<std::size_t>(file.gcount()));
+      size += static_cast<std::uint64_t>(file.gcount());
+    }
+    add(reinterpret_cast<const char *>(&size), sizeof(size));
+  }
+
+  std::ostringstream hex;
+  hex << std::hex << std::setw(16) << std::setfill('0') << hash;
+  return hex.str();
+}
+
+void ModelData::write(const fs::path &filename, const String &hash) const {
+  // Write to a temporary file first, so that concurrent imports never read a
+  // partially written cache. The name is unique per writer, so that
+  // concurrent writers of the same entry do not share the temporary file.
+  std::random_device random;
+  std::ostringstream suffix;
+  suffix << ".tmp." << std::hex << random() << random() << "."
+         << std::hash<std::thread::id>()(std::this_thread::get_id());
+  fs::path tmpFilename = filename.string() + suffix.str();
+  try {
+    std::ofstream file(tmpFilename, std::ios_base::out |
+                                        std::ios_base::trunc |
+                                        std::ios_base::binary);
+    if (!file.is_open())
+      throw std::runtime_error("Cannot open CIM model cache " +
+                               tmpFilename.string());
+
+    OutputArchive archive(file);
+    String magic = MAGIC;
+    Int version = VERSION;
+    String contentHash = hash;
+    archive(magic, version, contentHash);
+    const_cast<ModelData &>(*this).serialize(archive);
+
+    if (!file.good())
+      throw std::runtime_error("Cannot write CIM model cache " +
+                               tmpFilename.string());
+    file.close();
+    fs::rename(tmpFilename, filename);
+  } catch (...) {
+    std::error_code error;
+    fs::remove(tmpFilename, error);
+    throw;
+  }
+}
+
+Bool ModelData::read(const fs::path &filename, const String &hash,
+                     ModelData &data) {
+  std::ifstream file(filename, std::ios_base::in | std::ios_base::binary |
+                                   std::ios_base::ate);
+  if (!file.is_open())
+    return false;
+
+  // Read the whole file at once and decode it from memory
+  std::vector<char> buffer(static_cast<std::size_t>(file.tellg()));
+  file.seekg(0);
+  if (!file.read(buffer.data(), buffer.size()))
+    return false;
+
+  try {
+    InputArchive archive(buffer, 0);
+    String magic, contentHash;
+    Int version;
+    archive(magic, version, contentHash);
+    if (magic != MAGIC || version != static_cast<Int>(VERSION) ||
+        contentHash != hash)
+      return false;
+
+    ModelData result;
+    result.serialize(archive);
+    data = std::move(result);
+  } catch (std::runtime_error &) {
+    return false;
+  }
+  return true;
+}
@@ -9,7 +9,15 @@
 #include <CIMExceptions.hpp>
 #include <CIMModel.hpp>
 #include <IEC61970.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 
 #define READER_CPP
 #include <dpsim-models/CIM/Reader.h>
@@ -18,6 +26,48 @@ using namespace CPS;
 using namespace CPS::CIM;
 using CIMPP::UnitMultiplier;
 
+namespace {
+using Clock = std::chrono::steady_clock;
+
+/// Returns the seconds since start and resets start to now
+Real secondsSince(Clock::time_point &start) {
+  auto now = Clock::now();
+  Real seconds = std::chrono::duration<Real>(now - start).count();
+  start = now;
+  return seconds;
+}
+
+/// Reads an optional CIM value, returns false if it is not initialized
+template <typename T> Bool readValue(T &field, Real &value) {
+  try {
+    value = field;
+    return true;
+  } catch (ReadingUninitializedField *e) {
+    return false;
+  }
+}
+} // namespace
+
+struct Reader::ObjectIndex {
+  std::vector<CIMPP::TopologicalNode *> topologicalNodes;
+  std::vector<CIMPP::SvVoltage *> svVoltages;
+  std::vector<CIMPP::SvPowerFlow *> svPowerFlows;
+  /// Candidates for the mapping functions
+  std::vector<CIMPP::ConductingEquipment *> equipment;
+  /// Last SvTapStep of a tap changer
+  std::unordered_map<CIMPP::TapChanger *, CIMPP::SvTapStep *> tapSteps;
+  /// First dynamic parameter set by machine mRID
+  std::unordered_map<String, CIMPP::SynchronousMachineTimeConstantReactance *>
+      machineDynamics;
+  /// First generating unit by machine mRID
+  std::unordered_map<String, CIMPP::GeneratingUnit *> generatingUnits;
+  /// Last base voltage listing the equipment, by equipment name
+  std::unordered_map<String, CIMPP::BaseVoltage *> equipmentBaseVoltages;
+  /// Base voltage of the last topological node the equipment is connected
+  /// to, by equipment name
+  std::unordered_map<String, CIMPP::BaseVoltage *> nodeBaseVoltages;
+};
+
 Reader::Reader(String name, Logger::Level logLevel,
                Logger::Level componentLogLevel) {
   mSLog = Logger::get(name + "_CIM", logLevel);
@@ -25,6 +75,7 @@ Reader::Reader(String name, Logger::Level logLevel,
   mModel = new CIMModel();
   mModel->setDependencyCheckOff();
   mComponentLogLevel = componentLogLevel;
+  mObjects = std::make_unique<ObjectIndex>();
 }
 
 Reader::~Reader() { delete mModel; }
@@ -57,6 +108,15 @@ void Reader::useProtectionSwitches(Bool value) {
   mUseProtectionSwitches = value;
 }
 
+void Reader::useParallelImport(Bool value, UInt threads) {
+  mParallelImport = value;
+  mImportThreads = threads;
+}
+
+void Reader::setCacheDirectory(const fs::path &directory) {
+  mCacheDirectory = directory;
+}
+
 Real Reader::unitValue(Real value, CIMPP::UnitMultiplier mult) {
   switch (mult) {
   case UnitMultiplier::p:
@@ -95,28 +155,6 @@ Real Reader::unitValue(Real value, CIMPP::UnitMultiplier mult) {
   return value;
 }
 
-TopologicalPowerComp::Ptr Reader::mapComponent(BaseClass *obj) {
-  if (CIMPP::ACLineSegment *line = dynamic_cast<CIMPP::ACLineSegment *>(obj))
-    return mapACLineSegment(line);
-  if (CIMPP::EnergyConsumer *consumer =
-          dynamic_cast<CIMPP::EnergyConsumer *>(obj))
-    return mapEnergyConsumer(consumer);
-  if (CIMPP::PowerTransformer *trans =
-          dynamic_cast<CIMPP::PowerTransformer *>(obj))
-    return mapPowerTransformer(trans);
-  if (CIMPP::SynchronousMachine *syncMachine =
-          dynamic_cast<CIMPP::SynchronousMachine *>(obj))
-    return mapSynchronousMachine(syncMachine);
-  if (CIMPP::ExternalNetworkInjection *extnet =
-          dynamic_cast<CIMPP::ExternalNetworkInjection *>(obj))
-    return mapExternalNetworkInjection(extnet);
-  if (CIMPP::EquivalentShunt *shunt =
-          dynamic_cast<CIMPP::EquivalentShunt *>(obj))
-    return mapEquivalentShunt(shunt);
-
-  return nullptr;
-}
-
 void Reader::addFiles(const fs::path &filename) {
   if (!mModel->addCIMFile(filename.string()))
     SPDLOG_LOGGER_ERROR(mSLog, "Failed to read file {}", filename);
@@ -127,64 +165,86 @@ void Reader::addFiles(const std::list<fs::path> &filenames) {
     addFiles(filename);
 }
 
-void Reader::parseFiles() {
+void Reader::loadModelData(const std::list<fs::path> &filenames) {
+  auto start = Clock::now();
+  String hash;
+  fs::path cacheFile;
+  if (!mCacheDirectory.empty()) {
+    try {
+      hash = ModelData::contentHash(filenames);
+      cacheFile = mCacheDirectory / ("cim_" + hash + ".bin");
+      if (ModelData::read(cacheFile, hash, mData)) {
+        SPDLOG_LOGGER_INFO(mSLog, "Read model data from cache {}", cacheFile);
+        mImportTimes.emplace_back("Read cache", secondsSince(start));
+        return;
+      }
+    } catch (std::exception &e) {
+      SPDLOG_LOGGER_WARN(mSLog, "Model data cache not usable: {}", e.what());
+      hash.clear();
+    }
+    mImportTimes.emplace_back("Hash files", secondsSince(start));
+  }
+
+  addFiles(filenames);
+  if (!parseFiles() || hash.empty())
+    return;
+
+  start = Clock::now();
+  try {
+    if (!fs::exists(mCacheDirectory))
+      fs::create_directories(mCacheDirectory);
+    mData.write(cacheFile, hash);
+    SPDLOG_LOGGER_INFO(mSLog, "Wrote model data to cache {}", cacheFile);
+  } catch (std::exception &e) {
+    SPDLOG_LOGGER_WARN(mSLog, "Cannot write model data cache: {}", e.what());
+  }
+  mImportTimes.emplace_back("Write cache", secondsSince(start));
+}
+
+Bool Reader::parseFiles() {
+  auto start = Clock::now();
   try {
     mModel->parseFiles();
   } catch (...) {
     SPDLOG_LOGGER_ERROR(mSLog, "Failed to parse CIM files");
-    return;
+    return false;
   }
+  mImportTimes.emplace_back("Parse files", secondsSince(start));
+
+  indexObjects();
+  mImportTimes.emplace_back("Index objects", secondsSince(start));
+
+  extractModelData();
+  mImportTimes.emplace_back("Extract parameters", secondsSince(start));
+  return true;
+}
+
+void Reader::createComponents() {
+  auto start = Clock::now();
+  SPDLOG_LOGGER_INFO(mSLog, "#### Create components");
+  mapEquipment();
+  mImportTimes.emplace_back("Create components", secondsSince(start));
 
   SPDLOG_LOGGER_INFO(
       mSLog,
       "#### List of TopologicalNodes, associated Terminals and Equipment");
-  for (auto obj : mModel->Objects) {
-    if (CIMPP::TopologicalNode *topNode =
-            dynamic_cast<CIMPP::TopologicalNode *>(obj)) {
-      if (mDomain == Domain::EMT)
-        processTopologicalNode<Real>(topNode);
-      else
-        processTopologicalNode<Complex>(topNode);
-    }
+  for (auto &topNode : mData.topologicalNodes) {
+    if (mDomain == Domain::EMT)
+      processTopologicalNode<Real>(topNode);
+    else
+      processTopologicalNode<Complex>(topNode);
   }
+  mImportTimes.emplace_back("Connect nodes", secondsSince(start));
 
   // Collect voltage state variables associated to nodes that are used
   // for various components.
   SPDLOG_LOGGER_INFO(mSLog,
                      "#### List of Node voltages and Terminal power flow data");
-  for (auto obj : mModel->Objects) {
-    // Check if object is of class SvVoltage
-    if (CIMPP::SvVoltage *volt = dynamic_cast<CIMPP::SvVoltage *>(obj)) {
-      processSvVoltage(volt);
-    }
-    // Check if object is of class SvPowerFlow
-    else if (CIMPP::SvPowerFlow *flow =
-                 dynamic_cast<CIMPP::SvPowerFlow *>(obj)) {
-      processSvPowerFlow(flow);
-    }
-  }
-
-  SPDLOG_LOGGER_INFO(mSLog, "#### Create other components");
-  for (auto obj : mModel->Objects) {
-
-    // Check if object is not TopologicalNode, SvVoltage or SvPowerFlow
-    if (!dynamic_cast<CIMPP::TopologicalNode *>(obj) &&
-        !dynamic_cast<CIMPP::SvVoltage *>(obj) &&
-        !dynamic_cast<CIMPP::SvPowerFlow *>(obj)) {
-
-      if (CIMPP::IdentifiedObject *idObj =
-              dynamic_cast<CIMPP::IdentifiedObject *>(obj)) {
-
-        // Check if object is already in equipment list
-        if (mPowerflowEquipment.find(idObj->mRID) ==
-            mPowerflowEquipment.end()) {
-          TopologicalPowerComp::Ptr comp = mapComponent(obj);
-          if (comp)
-            mPowerflowEquipment.insert(std::make_pair(comp->uid(), comp));
-        }
-      }
-    }
-  }
+  for (auto &volt : mData.svVoltages)
+    processSvVoltage(volt);
+  for (auto &flow : mData.svPowerFlows)
+    processSvPowerFlow(flow);
+  mImportTimes.emplace_back("State variables", secondsSince(start));
 
   SPDLOG_LOGGER_INFO(mSLog, "#### Check topology for unconnected components");
   for (auto pfe : mPowerflowEquipment) {
@@ -204,19 +264,92 @@ void Reader::parseFiles() {
       }
     }
   }
+  mImportTimes.emplace_back("Check topology", secondsSince(start));
+}
+
+void Reader::mapEquipment() {
+  // One job per component, the mapping only reads the model data and the
+  // components are independent of each other
+  std::vector<std::function<TopologicalPowerComp::Ptr()>> jobs;
+  for (auto &line : mData.acLineSegments)
+    jobs.push_back([this, &line]() { return mapACLineSegment(line); });
+  for (auto &consumer : mData.energyConsumers)
+    jobs.push_back([this, &consumer]() { return mapEnergyConsumer(consumer); });
+  for (auto &trans : mData.powerTransformers)
+    jobs.push_back([this, &trans]() { return mapPowerTransformer(trans); });
+  for (auto &machine : mData.synchronousMachines)
+    jobs.push_back(
+        [this, &machine]() { return mapSynchronousMachine(machine); });
+  for (auto &extnet : mData.externalNetworkInjections)
+    jobs.push_back(
+        [this, &extnet]() { return mapExternalNetworkInjection(extnet); });
+  for (auto &shunt : mData.equivalentShunts)
+    jobs.push_back([this, &shunt]() { return mapEquivalentShunt(shunt); });
+
+  std::vector<TopologicalPowerComp::Ptr> components(jobs.size());
+  UInt threads = 1;
+  if (mParallelImport) {
+    threads = mImportThreads > 0 ? mImportThreads
+                                 : std::thread::hardware_concurrency();
+    threads = std::min<UInt>(std::max(threads, 1u),
+                             std::max<UInt>(jobs.size(), 1));
+  }
+
+  if (threads == 1) {
+    for (std::size_t idx = 0; idx < jobs.size(); ++idx)
+      components[idx] = jobs[idx]();
+  } else {
+    std::atomic<std::size_t> next{0};
+    std::exception_ptr error;
+    std::mutex errorMutex;
+    auto worker = [&]() {
+      try {
+        for (std::size_t idx = next++; idx < jobs.size(); idx = next++)
+          components[idx] = jobs[idx]();
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(errorMutex);
+        if (!error)
+          error = std::current_exception();
+        next = jobs.size();
+      }
+    };
+
+    std::vector<std::thread> pool;
+    for (UInt idx = 1; idx < threads; ++idx)
+      pool.emplace_back(worker);
+    worker();
+    for (auto &thread : pool)
+      thread.join();
+    if (error)
+      std::rethrow_exception(error);
+  }
+
+  for (auto &comp : components) {
+    if (comp)
+      mPowerflowEquipment.insert(std::make_pair(comp->uid(), comp));
+  }
+  SPDLOG_LOGGER_INFO(mSLog, "Created {} components on {} threads",
+                     mPowerflowEquipment.size(), threads);
+}
+
+void Reader::logImportTimes() {
+  Real total = 0;
+  SPDLOG_LOGGER_INFO(mSLog, "#### Import of {} nodes and {} components",
+                     mPowerflowNodes.size(), mPowerflowEquipment.size());
+  for (auto &stage : mImportTimes) {
+    SPDLOG_LOGGER_INFO(mSLog, "    {:<20} {:.3f} s", stage.first + ":",
+                       stage.second);
+    total += stage.second;
+  }
+  SPDLOG_LOGGER_INFO(mSLog, "    {:<20} {:.3f} s", "Total:", total);
+  mImportTimes.clear();
 }
 
 SystemTopology Reader::loadCIM(Real systemFrequency, const fs::path &filename,
                                Domain domain, PhaseType phase,
                                GeneratorType genType) {
-  mFrequency = systemFrequency;
-  mOmega = 2 * PI * mFrequency;
-  mDomain = domain;
-  mPhase = phase;
-  mGeneratorType = genType;
-  addFiles(filename);
-  parseFiles();
-  return systemTopology();
+  return loadCIM(systemFrequency, std::list<fs::path>{filename}, domain, phase,
+                 genType);
 }
 
 SystemTopology Reader::loadCIM(Real systemFrequency,
@@ -228,59 +361,340 @@ SystemTopology Reader::loadCIM(Real systemFrequency,
   mDomain = domain;
   mPhase = phase;
   mGeneratorType = genType;
-  addFiles(filenames);
-  parseFiles();
-  return systemTopology();
+  loadModelData(filenames);
+  createComponents();
+
+  auto start = Clock::now();
+  auto system = systemTopology();
+  mImportTimes.emplace_back("System topology", secondsSince(start));
+  logImportTimes();
+  return system;
+}
+
+void Reader::indexObjects() {
+  *mObjects = ObjectIndex();
+
+  for (auto obj : mModel->Objects) {
+    if (auto topNode = dynamic_cast<CIMPP::TopologicalNode *>(obj)) {
+      mObjects->topologicalNodes.push_back(topNode);
+      if (!topNode->BaseVoltage)
+        continue;
+      for (auto term : topNode->Terminal) {
+        if (term->ConductingEquipment)
+          mObjects->nodeBaseVoltages[term->ConductingEquipment->name] =
+              topNode->BaseVoltage;
+      }
+    } else if (auto volt = dynamic_cast<CIMPP::SvVoltage *>(obj)) {
+      mObjects->svVoltages.push_back(volt);
+    } else if (auto flow = dynamic_cast<CIMPP::SvPowerFlow *>(obj)) {
+      mObjects->svPowerFlows.push_back(flow);
+    } else if (auto equipment =
+                   dynamic_cast<CIMPP::ConductingEquipment *>(obj)) {
+      mObjects->equipment.push_back(equipment);
+    } else if (auto tapStep = dynamic_cast<CIMPP::SvTapStep *>(obj)) {
+      mObjects->tapSteps[tapStep->TapChanger] = tapStep;
+    } else if (auto genDyn =
+                   dynamic_cast<CIMPP::SynchronousMachineTimeConstantReactance
+                                    *>(obj)) {
+      if (genDyn->SynchronousMachine)
+        mObjects->machineDynamics.emplace(genDyn->SynchronousMachine->mRID,
+                                          genDyn);
+    } else if (auto genUnit = dynamic_cast<CIMPP::GeneratingUnit *>(obj)) {
+      for (auto syncGen : genUnit->RotatingMachine)
+        mObjects->generatingUnits.emplace(syncGen->mRID, genUnit);
+    } else if (auto baseVolt = dynamic_cast<CIMPP::BaseVoltage *>(obj)) {
+      for (auto comp : baseVolt->ConductingEquipment)
+        mObjects->equipmentBaseVoltages[comp->name] = baseVolt;
+    }
+  }
+
+  SPDLOG_LOGGER_INFO(mSLog,
+                     "Indexed {} TopologicalNodes, {} SvVoltages, {} "
+                     "SvPowerFlows and {} ConductingEquipment objects",
+                     mObjects->topologicalNodes.size(),
+                     mObjects->svVoltages.size(),
+                     mObjects->svPowerFlows.size(),
+                     mObjects->equipment.size());
+}
+
+void Reader::extractModelData() {
+  mData = ModelData();
+
+  // The nodes first, since they set the default sequence numbers of the
+  // terminals which the transformers rely on
+  for (auto topNode : mObjects->topologicalNodes)
+    extractTopologicalNode(topNode);
+  for (auto volt : mObjects->svVoltages)
+    extractSvVoltage(volt);
+  for (auto flow : mObjects->svPowerFlows)
+    extractSvPowerFlow(flow);
+
+  for (auto obj : mObjects->equipment) {
+    if (auto line = dynamic_cast<CIMPP::ACLineSegment *>(obj))
+      extractACLineSegment(line);
+    else if (auto consumer = dynamic_cast<CIMPP::EnergyConsumer *>(obj))
+      extractEnergyConsumer(consumer);
+    else if (auto trans = dynamic_cast<CIMPP::PowerTransformer *>(obj))
+      extractPowerTransformer(trans);
+    else if (auto machine = dynamic_cast<CIMPP::SynchronousMachine *>(obj))
+      extractSynchronousMachine(machine);
+    else if (auto extnet =
+                 dynamic_cast<CIMPP::ExternalNetworkInjection *>(obj))
+      extractExternalNetworkInjection(extnet);
+    else if (auto shunt = dynamic_cast<CIMPP::EquivalentShunt *>(obj))
+      extractEquivalentShunt(shunt);
+  }
+
+  // The index refers to the CIM++ model and is not needed anymore
+  *mObjects = ObjectIndex();
+}
+
+void Reader::extractTopologicalNode(CIMPP::TopologicalNode *topNode) {
+  ModelData::TopologicalNode data;
+  data.mRID = topNode->mRID;
+  data.name = topNode->name;
+
+  for (auto term : topNode->Terminal) {
+    if (!term->sequenceNumber.initialized)
+      term->sequenceNumber = 1;
+
+    ModelData::Terminal terminal;
+    terminal.mRID = term->mRID;
+    terminal.sequenceNumber = (int)term->sequenceNumber;
+    if (term->ConductingEquipment)
+      terminal.equipment = term->ConductingEquipment->mRID;
+    data.terminals.push_back(terminal);
+  }
+  mData.topologicalNodes.push_back(data);
+}
+
+void Reader::extractSvVoltage(CIMPP::SvVoltage *volt) {
+  ModelData::SvVoltage data;
+  // The missing node is reported by processSvVoltage
+  if (volt->TopologicalNode) {
+    data.topologicalNode = volt->TopologicalNode->mRID;
+    data.v = volt->v.value;
+    if (!readValue(volt->angle.value, data.angle)) {
+      data.angle = 0;
+      std::cerr << "Uninitialized Angle for SVVoltage at "
+                << volt->TopologicalNode->name << ".Setting default value of "
+                << data.angle << std::endl;
+    }
+  }
+  mData.svVoltages.push_back(data);
+}
+
+void Reader::extractSvPowerFlow(CIMPP::SvPowerFlow *flow) {
+  if (!flow->Terminal) {
+    SPDLOG_LOGGER_WARN(mSLog,
+                       "SvPowerFlow references missing Terminal, ignoring");
+    return;
+  }
+  ModelData::SvPowerFlow data;
+  data.terminal = flow->Terminal->mRID;
+  data.p = flow->p.value;
+  data.q = flow->q.value;
+  mData.svPowerFlows.push_back(data);
+}
+
+void Reader::extractACLineSegment(CIMPP::ACLineSegment *line) {
+  ModelData::ACLineSegment data;
+  data.mRID = line->mRID;
+  data.name = line->name;
+  data.r = line->r.value;
+  data.x = line->x.value;
+  data.bch = line->bch.value;
+  data.gch = line->gch.value;
+  data.baseVoltage = determineBaseVoltageAssociatedWithEquipment(line);
+  mData.acLineSegments.push_back(data);
+}
+
+void Reader::extractEnergyConsumer(CIMPP::EnergyConsumer *consumer) {
+  ModelData::EnergyConsumer data;
+  data.mRID = consumer->mRID;
+  data.name = consumer->name;
+  mData.energyConsumers.push_back(data);
+}
+
+void Reader::extractPowerTransformer(CIMPP::PowerTransformer *trans) {
+  if (trans->PowerTransformerEnd.size() != 2) {
+    SPDLOG_LOGGER_WARN(
+        mSLog,
+        "PowerTransformer {} does not have exactly two windings, ignoring",
+        trans->name);
+    return;
+  }
+
+  // assign transformer ends
+  CIMPP::PowerTransformerEnd *end1 = nullptr, *end2 = nullptr;
+  for (auto end : trans->PowerTransformerEnd) {
+    if (end->Terminal->sequenceNumber == 1)
+      end1 = end;
+    else if (end->Terminal->sequenceNumber == 2)
+      end2 = end;
+  }
+  if (!end1 || !end2) {
+    SPDLOG_LOGGER_WARN(
+        mSLog,
+        "PowerTransformer {} has no ends with sequence numbers 1 and 2, "
+        "ignoring",
+        trans->name);
+    return;
+  }
+
+  // setting default values for non-set resistances and reactances
+  auto extractEnd = [this](CIMPP::PowerTransformerEnd *end,
+                           const String &label) {
+    ModelData::PowerTransformerEnd data;
+    data.name = end->name;
+    data.ratedS = end->ratedS.value;
+    data.ratedU = end->ratedU.value;
+    if (!readValue(end->r.value, data.r)) {
+      data.r = 1e-12;
+      SPDLOG_LOGGER_WARN(mSLog,
+                         "       Uninitialized value for {} setting default "
+                         "value of R={}",
+                         label, (float)data.r);
+    }
+    if (!readValue(end->x.value, data.x)) {
+      data.x = 1e-12;
+      SPDLOG_LOGGER_WARN(mSLog,
+                         "       Uninitialized value for {} setting default "
+                         "value of X={}",
+                         label, (float)data.x);
+    }
+    return data;
+  };
+
+  ModelData::PowerTransformer data;
+  data.mRID = trans->mRID;
+  data.name = trans->name;
+  data.end1 = extractEnd(end1, "PowerTrafoEnd1");
+  data.end2 = extractEnd(end2, "PowerTrafoEnd2");
+
+  if (end1->RatioTapChanger) {
+    data.hasRatioTapChanger = true;
+    data.normalStep = end1->RatioTapChanger->normalStep;
+    data.neutralStep = end1->RatioTapChanger->neutralStep;
+    data.stepVoltageIncrement =
+        end1->RatioTapChanger->stepVoltageIncrement.value;
+
+    auto search = mObjects->tapSteps.find(end1->RatioTapChanger);
+    if (search != mObjects->tapSteps.end()) {
+      data.hasSvTapStep = true;
+      data.position = search->second->position;
+    }
+  }
+  mData.powerTransformers.push_back(data);
+}
+
+void Reader::extractSynchronousMachine(CIMPP::SynchronousMachine *machine) {
+  ModelData::SynchronousMachine data;
+  data.mRID = machine->mRID;
+  data.name = machine->name;
+  // Not needed by all generator types
+  readValue(machine->ratedS.value, data.ratedS);
+  readValue(machine->ratedU.value, data.ratedU);
+
+  auto dynSearch = mObjects->machineDynamics.find(machine->mRID);
+  if (dynSearch != mObjects->machineDynamics.end()) {
+    auto genDyn = dynSearch->second;
+    auto &dyn = data.dynamics;
+    try {
+      dyn.statorResistance = genDyn->statorResistance.value;
+      dyn.statorLeakageReactance = genDyn->statorLeakageReactance.value;
+      dyn.xDirectSync = genDyn->xDirectSync.value;
+      dyn.xQuadSync = genDyn->xQuadSync.value;
+      dyn.xDirectTrans = genDyn->xDirectTrans.value;
+      dyn.xQuadTrans = genDyn->xQuadTrans.value;
+      dyn.xDirectSubtrans = genDyn->xDirectSubtrans.value;
+      dyn.xQuadSubtrans = genDyn->xQuadSubtrans.value;
+      dyn.tpdo = genDyn->tpdo.value;
+      dyn.tpqo = genDyn->tpqo.value;
+      dyn.tppdo = genDyn->tppdo.value;
+      dyn.tppqo = genDyn->tppqo.value;
+      dyn.inertia = genDyn->inertia.value;
+      data.hasDynamics = true;
+    } catch (ReadingUninitializedField *e) {
+      SPDLOG_LOGGER_WARN(mSLog,
+                         "Incomplete SynchronousMachineTimeConstantReactance "
+                         "for {}, ignoring",
+                         machine->name);
+    }
+  }
+
+  auto unitSearch = mObjects->generatingUnits.find(machine->mRID);
+  if (unitSearch != mObjects->generatingUnits.end()) {
+    data.hasGeneratingUnit = true;
+    data.hasInitialP =
+        readValue(unitSearch->second->initialP.value, data.initialP);
+  }
+  if (machine->RegulatingControl)
+    data.hasRegulatingControl = readValue(
+        machine->RegulatingControl->targetValue.value, data.targetValue);
+  data.hasMaxQ = readValue(machine->maxQ.value, data.maxQ);
+  mData.synchronousMachines.push_back(data);
+}
+
+void Reader::extractExternalNetworkInjection(
+    CIMPP::ExternalNetworkInjection *extnet) {
+  ModelData::ExternalNetworkInjection data;
+  data.mRID = extnet->mRID;
+  data.name = extnet->name;
+  data.baseVoltage = determineBaseVoltageAssociatedWithEquipment(extnet);
+  if (extnet->RegulatingControl) {
+    data.hasRegulatingControl = true;
+    data.hasTargetValue =
+        readValue(extnet->RegulatingControl->targetValue, data.targetValue);
+  }
+  mData.externalNetworkInjections.push_back(data);
 }
 
-void Reader::processSvVoltage(CIMPP::SvVoltage *volt) {
-  CIMPP::TopologicalNode *node = volt->TopologicalNode;
-  if (!node) {
+void Reader::extractEquivalentShunt(CIMPP::EquivalentShunt *shunt) {
+  ModelData::EquivalentShunt data;
+  data.mRID = shunt->mRID;
+  data.name = shunt->name;
+  data.baseVoltage = determineBaseVoltageAssociatedWithEquipment(shunt);
+  data.g = shunt->g.value;
+  data.b = shunt->b.value;
+  mData.equivalentShunts.push_back(data);
+}
+
+void Reader::processSvVoltage(const ModelData::SvVoltage &volt) {
+  if (volt.topologicalNode.empty()) {
     SPDLOG_LOGGER_WARN(
         mSLog, "SvVoltage references missing Topological Node, ignoring");
     return;
   }
-  auto search = mPowerflowNodes.find(node->mRID);
+  auto search = mPowerflowNodes.find(volt.topologicalNode);
   if (search == mPowerflowNodes.end()) {
     SPDLOG_LOGGER_WARN(mSLog,
                        "SvVoltage references Topological Node {}"
                        " missing from mTopNodes, ignoring",
-                       node->mRID);
+                       volt.topologicalNode);
     return;
   }
+  auto node = search->second;
 
-  Real voltageAbs = Reader::unitValue(volt->v.value, UnitMultiplier::k);
+  Real voltageAbs = Reader::unitValue(volt.v, UnitMultiplier::k);
+  SPDLOG_LOGGER_INFO(mSLog, "    Angle={}", (float)volt.angle);
+  Real voltagePhase = volt.angle * PI / 180;
+  node->setInitialVoltage(std::polar<Real>(voltageAbs, voltagePhase));
 
-  try {
-    SPDLOG_LOGGER_INFO(mSLog, "    Angle={}", (float)volt->angle.value);
-  } catch (ReadingUninitializedField *e) {
-    volt->angle.value = 0;
-    std::cerr << "Uninitialized Angle for SVVoltage at "
-              << volt->TopologicalNode->name << ".Setting default value of "
-              << volt->angle.value << std::endl;
-  }
-  Real voltagePhase = volt->angle.value * PI / 180;
-  mPowerflowNodes[node->mRID]->setInitialVoltage(
-      std::polar<Real>(voltageAbs, voltagePhase));
-
-  SPDLOG_LOGGER_INFO(
-      mSLog, "Node {} MatrixNodeIndex {}: {} V, {} deg",
-      mPowerflowNodes[node->mRID]->uid(),
-      mPowerflowNodes[node->mRID]->matrixNodeIndex(),
-      std::abs(mPowerflowNodes[node->mRID]->initialSingleVoltage()),
-      std::arg(mPowerflowNodes[node->mRID]->initialSingleVoltage()) * 180 / PI);
+  SPDLOG_LOGGER_INFO(mSLog, "Node {} MatrixNodeIndex {}: {} V, {} deg",
+                     node->uid(), node->matrixNodeIndex(),
+                     std::abs(node->initialSingleVoltage()),
+                     std::arg(node->initialSingleVoltage()) * 180 / PI);
 }
 
-void Reader::processSvPowerFlow(CIMPP::SvPowerFlow *flow) {
-  CIMPP::Terminal *term = flow->Terminal;
+void Reader::processSvPowerFlow(const ModelData::SvPowerFlow &flow) {
+  auto &term = mPowerflowTerminals[flow.terminal];
 
-  mPowerflowTerminals[term->mRID]->setPower(
-      Complex(Reader::unitValue(flow->p.value, UnitMultiplier::M),
-              Reader::unitValue(flow->q.value, UnitMultiplier::M)));
+  term->setPower(Complex(Reader::unitValue(flow.p, UnitMultiplier::M),
+                         Reader::unitValue(flow.q, UnitMultiplier::M)));
 
-  SPDLOG_LOGGER_WARN(mSLog, "Terminal {}: {} W + j {} Var", term->mRID,
-                     mPowerflowTerminals[term->mRID]->singleActivePower(),
-                     mPowerflowTerminals[term->mRID]->singleReactivePower());
+  SPDLOG_LOGGER_WARN(mSLog, "Terminal {}: {} W + j {} Var", flow.terminal,
+                     term->singleActivePower(), term->singleReactivePower());
 }
 
 SystemTopology Reader::systemTopology() {
@@ -326,30 +740,30 @@ Matrix::Index Reader::mapTopologicalNode(String mrid) {
 }
 
 TopologicalPowerComp::Ptr
-Reader::mapEnergyConsumer(CIMPP::EnergyConsumer *consumer) {
-  SPDLOG_LOGGER_INFO(mSLog, "    Found EnergyConsumer {}", consumer->name);
+Reader::mapEnergyConsumer(const ModelData::EnergyConsumer &consumer) {
+  SPDLOG_LOGGER_INFO(mSLog, "    Found EnergyConsumer {}", consumer.name);
   if (mDomain == Domain::EMT) {
     if (mPhase == PhaseType::ABC) {
-      return std::make_shared<EMT::Ph3::RXLoad>(consumer->mRID, consumer->name,
+      return std::make_shared<EMT::Ph3::RXLoad>(consumer.mRID, consumer.name,
                                                 mComponentLogLevel);
     } else {
       SPDLOG_LOGGER_INFO(mSLog, "    RXLoad for EMT not implemented yet");
-      return std::make_shared<DP::Ph1::RXLoad>(consumer->mRID, consumer->name,
+      return std::make_shared<DP::Ph1::RXLoad>(consumer.mRID, consumer.name,
                                                mComponentLogLevel);
     }
   } else if (mDomain == Domain::SP) {
-    auto load = std::make_shared<SP::Ph1::Load>(consumer->mRID, consumer->name,
+    auto load = std::make_shared<SP::Ph1::Load>(consumer.mRID, consumer.name,
                                                 mComponentLogLevel);
 
     // TODO: Use EnergyConsumer.P and EnergyConsumer.Q if available, overwrite if existent SvPowerFlow data
     /*
 		Real p = 0;
 		Real q = 0;
-		if (consumer->p.value){
-			p = unitValue(consumer->p.value,UnitMultiplier::M);
+		if (consumer.p){
+			p = unitValue(consumer.p,UnitMultiplier::M);
 		}
-		if (consumer->q.value){
-			q = unitValue(consumer->q.value,UnitMultiplier::M);
+		if (consumer.q){
+			q = unitValue(consumer.q,UnitMultiplier::M);
 		}
 		load->setParameters(p, q, 0);
 		*/
@@ -362,34 +776,35 @@ Reader::mapEnergyConsumer(CIMPP::EnergyConsumer *consumer) {
   } else {
     if (mUseProtectionSwitches)
       return std::make_shared<DP::Ph1::RXLoadSwitch>(
-          consumer->mRID, consumer->name, mComponentLogLevel);
+          consumer.mRID, consumer.name, mComponentLogLevel);
     else
-      return std::make_shared<DP::Ph1::RXLoad>(consumer->mRID, consumer->name,
+      return std::make_shared<DP::Ph1::RXLoad>(consumer.mRID, consumer.name,
                                                mComponentLogLevel);
   }
 }
 
-TopologicalPowerComp::Ptr Reader::mapACLineSegment(CIMPP::ACLineSegment *line) {
+TopologicalPowerComp::Ptr
+Reader::mapACLineSegment(const ModelData::ACLineSegment &line) {
   SPDLOG_LOGGER_INFO(mSLog,
                      "    Found ACLineSegment {} r={} x={} bch={} gch={}",
-                     line->name, (float)line->r.value, (float)line->x.value,
-                     (float)line->bch.value, (float)line->gch.value);
+                     line.name, (float)line.r, (float)line.x,
+                     (float)line.bch, (float)line.gch);
 
-  Real resistance = line->r.value;
-  Real inductance = line->x.value / mOmega;
+  Real resistance = line.r;
+  Real inductance = line.x / mOmega;
 
   // By default there is always a small conductance to ground to
   // avoid problems with floating nodes.
   Real capacitance = mShuntCapacitorValue;
   Real conductance = mShuntConductanceValue;
 
-  if (line->bch.value > 1e-9 && !mSetShuntCapacitor)
-    capacitance = Real(line->bch.value / mOmega);
+  if (line.bch > 1e-9 && !mSetShuntCapacitor)
+    capacitance = Real(line.bch / mOmega);
 
-  if (line->gch.value > 1e-9 && !mSetShuntConductance)
-    conductance = Real(line->gch.value);
+  if (line.gch > 1e-9 && !mSetShuntConductance)
+    conductance = Real(line.gch);
 
-  Real baseVoltage = determineBaseVoltageAssociatedWithEquipment(line);
+  Real baseVoltage = line.baseVoltage;
 
   if (mDomain == Domain::EMT) {
     if (mPhase == PhaseType::ABC) {
@@ -399,25 +814,25 @@ TopologicalPowerComp::Ptr Reader::mapACLineSegment(CIMPP::ACLineSegment *line) {
       Matrix cond_3ph =
           CPS::Math::singlePhaseParameterToThreePhase(conductance);
 
-      auto cpsLine = std::make_shared<EMT::Ph3::PiLine>(line->mRID, line->name,
+      auto cpsLine = std::make_shared<EMT::Ph3::PiLine>(line.mRID, line.name,
                                                         mComponentLogLevel);
       cpsLine->setParameters(res_3ph, ind_3ph, cap_3ph, cond_3ph);
       return cpsLine;
     } else {
       SPDLOG_LOGGER_INFO(mSLog, "    PiLine for EMT not implemented yet");
-      auto cpsLine = std::make_shared<DP::Ph1::PiLine>(line->mRID, line->name,
+      auto cpsLine = std::make_shared<DP::Ph1::PiLine>(line.mRID, line.name,
                                                        mComponentLogLevel);
       cpsLine->setParameters(resistance, inductance, capacitance, conductance);
       return cpsLine;
     }
   } else if (mDomain == Domain::SP) {
-    auto cpsLine = std::make_shared<SP::Ph1::PiLine>(line->mRID, line->name,
+    auto cpsLine = std::make_shared<SP::Ph1::PiLine>(line.mRID, line.name,
                                                      mComponentLogLevel);
     cpsLine->setParameters(resistance, inductance, capacitance, conductance);
     cpsLine->setBaseVoltage(baseVoltage);
     return cpsLine;
   } else {
-    auto cpsLine = std::make_shared<DP::Ph1::PiLine>(line->mRID, line->name,
+    auto cpsLine = std::make_shared<DP::Ph1::PiLine>(line.mRID, line.name,
                                                      mComponentLogLevel);
     cpsLine->setParameters(resistance, inductance, capacitance, conductance);
     return cpsLine;
@@ -425,105 +840,49 @@ TopologicalPowerComp::Ptr Reader::mapACLineSegment(CIMPP::ACLineSegment *line) {
 }
 
 TopologicalPowerComp::Ptr
-Reader::mapPowerTransformer(CIMPP::PowerTransformer *trans) {
-  if (trans->PowerTransformerEnd.size() != 2) {
-    SPDLOG_LOGGER_WARN(
-        mSLog,
-        "PowerTransformer {} does not have exactly two windings, ignoring",
-        trans->name);
-    return nullptr;
-  }
-  SPDLOG_LOGGER_INFO(mSLog, "Found PowerTransformer {}", trans->name);
-
-  // assign transformer ends
-  CIMPP::PowerTransformerEnd *end1 = nullptr, *end2 = nullptr;
-  for (auto end : trans->PowerTransformerEnd) {
-    if (end->Terminal->sequenceNumber == 1)
-      end1 = end;
-    else if (end->Terminal->sequenceNumber == 2)
-      end2 = end;
-    else
-      return nullptr;
-  }
-
-  // setting default values for non-set resistances and reactances
-  SPDLOG_LOGGER_INFO(mSLog, "    PowerTransformerEnd_1 {}", end1->name);
-  SPDLOG_LOGGER_INFO(mSLog, "    Srated={} Vrated={}",
-                     (float)end1->ratedS.value, (float)end1->ratedU.value);
-  try {
-    SPDLOG_LOGGER_INFO(mSLog, "       R={}", (float)end1->r.value);
-  } catch (ReadingUninitializedField *e1) {
-    end1->r.value = 1e-12;
-    SPDLOG_LOGGER_WARN(mSLog,
-                       "       Uninitialized value for PowerTrafoEnd1 setting "
-                       "default value of R={}",
-                       (float)end1->r.value);
-  }
-  try {
-    SPDLOG_LOGGER_INFO(mSLog, "       X={}", (float)end1->x.value);
-  } catch (ReadingUninitializedField *e1) {
-    end1->x.value = 1e-12;
-    SPDLOG_LOGGER_WARN(mSLog,
-                       "       Uninitialized value for PowerTrafoEnd1 setting "
-                       "default value of X={}",
-                       (float)end1->x.value);
-  }
-  SPDLOG_LOGGER_INFO(mSLog, "    PowerTransformerEnd_2 {}", end2->name);
-  SPDLOG_LOGGER_INFO(mSLog, "    Srated={} Vrated={}",
-                     (float)end2->ratedS.value, (float)end2->ratedU.value);
-  try {
-    SPDLOG_LOGGER_INFO(mSLog, "       R={}", (float)end2->r.value);
-  } catch (ReadingUninitializedField *e1) {
-    end2->r.value = 1e-12;
-    SPDLOG_LOGGER_WARN(mSLog,
-                       "       Uninitialized value for PowerTrafoEnd2 setting "
-                       "default value of R={}",
-                       (float)end2->r.value);
-  }
-  try {
-    SPDLOG_LOGGER_INFO(mSLog, "       X={}", (float)end2->x.value);
-  } catch (ReadingUninitializedField *e1) {
-    end2->x.value = 1e-12;
-    SPDLOG_LOGGER_WARN(mSLog,
-                       "       Uninitialized value for PowerTrafoEnd2 setting "
-                       "default value of X={}",
-                       (float)end2->x.value);
-  }
-
-  if (end1->ratedS.value != end2->ratedS.value) {
+Reader::mapPowerTransformer(const ModelData::PowerTransformer &trans) {
+  SPDLOG_LOGGER_INFO(mSLog, "Found PowerTransformer {}", trans.name);
+
+  // Missing resistances and reactances have been set to default values
+  auto &end1 = trans.end1;
+  auto &end2 = trans.end2;
+  SPDLOG_LOGGER_INFO(mSLog, "    PowerTransformerEnd_1 {}", end1.name);
+  SPDLOG_LOGGER_INFO(mSLog, "    Srated={} Vrated={}", (float)end1.ratedS,
+                     (float)end1.ratedU);
+  SPDLOG_LOGGER_INFO(mSLog, "       R={}", (float)end1.r);
+  SPDLOG_LOGGER_INFO(mSLog, "       X={}", (float)end1.x);
+  SPDLOG_LOGGER_INFO(mSLog, "    PowerTransformerEnd_2 {}", end2.name);
+  SPDLOG_LOGGER_INFO(mSLog, "    Srated={} Vrated={}", (float)end2.ratedS,
+                     (float)end2.ratedU);
+  SPDLOG_LOGGER_INFO(mSLog, "       R={}", (float)end2.r);
+  SPDLOG_LOGGER_INFO(mSLog, "       X={}", (float)end2.x);
+
+  if (end1.ratedS != end2.ratedS) {
     SPDLOG_LOGGER_WARN(
         mSLog,
         "    PowerTransformerEnds of {} come with distinct rated power values. "
         "Using rated power of PowerTransformerEnd_1.",
-        trans->name);
+        trans.name);
   }
-  Real ratedPower = unitValue(end1->ratedS.value, UnitMultiplier::M);
-  Real voltageNode1 = unitValue(end1->ratedU.value, UnitMultiplier::k);
-  Real voltageNode2 = unitValue(end2->ratedU.value, UnitMultiplier::k);
+  Real ratedPower = unitValue(end1.ratedS, UnitMultiplier::M);
+  Real voltageNode1 = unitValue(end1.ratedU, UnitMultiplier::k);
+  Real voltageNode2 = unitValue(end2.ratedU, UnitMultiplier::k);
 
   Real ratioAbsNominal = voltageNode1 / voltageNode2;
   Real ratioAbs = ratioAbsNominal;
 
   // use normalStep from RatioTapChanger
-  if (end1->RatioTapChanger) {
-    ratioAbs =
-        voltageNode1 / voltageNode2 *
-        (1 + (end1->RatioTapChanger->normalStep -
-              end1->RatioTapChanger->neutralStep) *
-                 end1->RatioTapChanger->stepVoltageIncrement.value / 100);
+  if (trans.hasRatioTapChanger) {
+    ratioAbs = voltageNode1 / voltageNode2 *
+               (1 + (trans.normalStep - trans.neutralStep) *
+                        trans.stepVoltageIncrement / 100);
   }
 
   // if corresponding SvTapStep available, use instead tap position from there
-  if (end1->RatioTapChanger) {
-    for (auto obj : mModel->Objects) {
-      auto tapStep = dynamic_cast<CIMPP::SvTapStep *>(obj);
-      if (tapStep && tapStep->TapChanger == end1->RatioTapChanger) {
-        ratioAbs =
-            voltageNode1 / voltageNode2 *
-            (1 + (tapStep->position - end1->RatioTapChanger->neutralStep) *
-                     end1->RatioTapChanger->stepVoltageIncrement.value / 100);
-      }
-    }
+  if (trans.hasRatioTapChanger && trans.hasSvTapStep) {
+    ratioAbs = voltageNode1 / voltageNode2 *
+               (1 + (trans.position - trans.neutralStep) *
+                        trans.stepVoltageIncrement / 100);
   }
 
   // TODO: To be extracted from cim class
@@ -532,18 +891,18 @@ Reader::mapPowerTransformer(CIMPP::PowerTransformer *trans) {
   // Calculate resistance and inductance referred to higher voltage side
   Real resistance = 0;
   Real inductance = 0;
-  if (voltageNode1 >= voltageNode2 && abs(end1->x.value) > 1e-12) {
-    inductance = end1->x.value / mOmega;
-    resistance = end1->r.value;
-  } else if (voltageNode1 >= voltageNode2 && abs(end2->x.value) > 1e-12) {
-    inductance = end2->x.value / mOmega * std::pow(ratioAbsNominal, 2);
-    resistance = end2->r.value * std::pow(ratioAbsNominal, 2);
-  } else if (voltageNode2 > voltageNode1 && abs(end2->x.value) > 1e-12) {
-    inductance = end2->x.value / mOmega;
-    resistance = end2->r.value;
-  } else if (voltageNode2 > voltageNode1 && abs(end1->x.value) > 1e-12) {
-    inductance = end1->x.value / mOmega / std::pow(ratioAbsNominal, 2);
-    resistance = end1->r.value / std::pow(ratioAbsNominal, 2);
+  if (voltageNode1 >= voltageNode2 && abs(end1.x) > 1e-12) {
+    inductance = end1.x / mOmega;
+    resistance = end1.r;
+  } else if (voltageNode1 >= voltageNode2 && abs(end2.x) > 1e-12) {
+    inductance = end2.x / mOmega * std::pow(ratioAbsNominal, 2);
+    resistance = end2.r * std::pow(ratioAbsNominal, 2);
+  } else if (voltageNode2 > voltageNode1 && abs(end2.x) > 1e-12) {
+    inductance = end2.x / mOmega;
+    resistance = end2.r;
+  } else if (voltageNode2 > voltageNode1 && abs(end1.x) > 1e-12) {
+    inductance = end1.x / mOmega / std::pow(ratioAbsNominal, 2);
+    resistance = end1.r / std::pow(ratioAbsNominal, 2);
   }
 
   if (mDomain == Domain::EMT) {
@@ -554,7 +913,7 @@ Reader::mapPowerTransformer(CIMPP::PowerTransformer *trans) {
           CPS::Math::singlePhaseParameterToThreePhase(inductance);
       Bool withResistiveLosses = resistance > 0;
       auto transformer = std::make_shared<EMT::Ph3::Transformer>(
-          trans->mRID, trans->name, mComponentLogLevel, withResistiveLosses);
+          trans.mRID, trans.name, mComponentLogLevel, withResistiveLosses);
       transformer->setParameters(voltageNode1, voltageNode2, ratedPower,
                                  ratioAbs, ratioPhase, resistance_3ph,
                                  inductance_3ph);
@@ -565,7 +924,7 @@ Reader::mapPowerTransformer(CIMPP::PowerTransformer *trans) {
     }
   } else if (mDomain == Domain::SP) {
     auto transformer = std::make_shared<SP::Ph1::Transformer>(
-        trans->mRID, trans->name, mComponentLogLevel);
+        trans.mRID, trans.name, mComponentLogLevel);
     transformer->setParameters(voltageNode1, voltageNode2, ratedPower, ratioAbs,
                                ratioPhase, resistance, inductance);
     Real baseVolt = voltageNode1 >= voltageNode2 ? voltageNode1 : voltageNode2;
@@ -574,7 +933,7 @@ Reader::mapPowerTransformer(CIMPP::PowerTransformer *trans) {
   } else {
     Bool withResistiveLosses = resistance > 0;
     auto transformer = std::make_shared<DP::Ph1::Transformer>(
-        trans->mRID, trans->name, mComponentLogLevel, withResistiveLosses);
+        trans.mRID, trans.name, mComponentLogLevel, withResistiveLosses);
     transformer->setParameters(voltageNode1, voltageNode2, ratedPower, ratioAbs,
                                ratioPhase, resistance, inductance);
     return transformer;
@@ -582,8 +941,8 @@ Reader::mapPowerTransformer(CIMPP::PowerTransformer *trans) {
 }
 
 TopologicalPowerComp::Ptr
-Reader::mapSynchronousMachine(CIMPP::SynchronousMachine *machine) {
-  SPDLOG_LOGGER_INFO(mSLog, "    Found  Synchronous machine {}", machine->name);
+Reader::mapSynchronousMachine(const ModelData::SynchronousMachine &machine) {
+  SPDLOG_LOGGER_INFO(mSLog, "    Found  Synchronous machine {}", machine.name);
 
   if (mDomain == Domain::DP) {
     SPDLOG_LOGGER_INFO(mSLog, "    Create generator in DP domain.");
@@ -596,128 +955,122 @@ Reader::mapSynchronousMachine(CIMPP::SynchronousMachine *machine) {
         mGeneratorType == GeneratorType::SG4OrderTPM ||
         mGeneratorType == GeneratorType::SG6OrderPCM) {
 
-      Real ratedPower = unitValue(machine->ratedS.value, UnitMultiplier::M);
-      Real ratedVoltage = unitValue(machine->ratedU.value, UnitMultiplier::k);
-
-      for (auto obj : mModel->Objects) {
-        // Check if object is not TopologicalNode, SvVoltage or SvPowerFlow
-        if (CIMPP::SynchronousMachineTimeConstantReactance *genDyn =
-                dynamic_cast<CIMPP::SynchronousMachineTimeConstantReactance *>(
-                    obj)) {
-          if (genDyn->SynchronousMachine->mRID == machine->mRID) {
-            // stator
-            Real Rs = genDyn->statorResistance.value;
-            Real Ll = genDyn->statorLeakageReactance.value;
-
-            // reactances
-            Real Ld = genDyn->xDirectSync.value;
-            Real Lq = genDyn->xQuadSync.value;
-            Real Ld_t = genDyn->xDirectTrans.value;
-            Real Lq_t = genDyn->xQuadTrans.value;
-            Real Ld_s = genDyn->xDirectSubtrans.value;
-            Real Lq_s = genDyn->xQuadSubtrans.value;
-
-            // time constants
-            Real Td0_t = genDyn->tpdo.value;
-            Real Tq0_t = genDyn->tpqo.value;
-            Real Td0_s = genDyn->tppdo.value;
-            Real Tq0_s = genDyn->tppqo.value;
-
-            // inertia
-            Real H = genDyn->inertia.value;
-
-            // not available in CIM -> set to 0, as actually no impact on machine equations
-            Int poleNum = 0;
-            Real nomFieldCurr = 0;
-
-            if (mGeneratorType == GeneratorType::TransientStability) {
-              SPDLOG_LOGGER_DEBUG(mSLog,
-                                  "    GeneratorType is TransientStability.");
-              auto gen = DP::Ph1::SynchronGeneratorTrStab::make(
-                  machine->mRID, machine->name, mComponentLogLevel);
-              gen->setStandardParametersPU(ratedPower, ratedVoltage, mFrequency,
-                                           Ld_t, H);
-              return gen;
-            } else if (mGeneratorType == GeneratorType::SG6aOrderVBR) {
-              SPDLOG_LOGGER_DEBUG(
-                  mSLog, "    GeneratorType is SynchronGenerator6aOrderVBR.");
-              auto gen = std::make_shared<DP::Ph1::SynchronGenerator6aOrderVBR>(
-                  machine->mRID, machine->name, mComponentLogLevel);
-              gen->setOperationalParametersPerUnit(
-                  ratedPower, ratedVoltage, mFrequency, H, Ld, Lq, Ll, Ld_t,
-                  Lq_t, Td0_t, Tq0_t, Ld_s, Lq_s, Td0_s, Tq0_s);
-              return gen;
-            } else if (mGeneratorType == GeneratorType::SG6bOrderVBR) {
-              SPDLOG_LOGGER_DEBUG(
-                  mSLog, "    GeneratorType is SynchronGenerator6bOrderVBR.");
-              auto gen = std::make_shared<DP::Ph1::SynchronGenerator6bOrderVBR>(
-                  machine->mRID, machine->name, mComponentLogLevel);
-              gen->setOperationalParametersPerUnit(
-                  ratedPower, ratedVoltage, mFrequency, H, Ld, Lq, Ll, Ld_t,
-                  Lq_t, Td0_t, Tq0_t, Ld_s, Lq_s, Td0_s, Tq0_s);
-              return gen;
-            } else if (mGeneratorType == GeneratorType::SG5OrderVBR) {
-              SPDLOG_LOGGER_DEBUG(
-                  mSLog, "    GeneratorType is SynchronGenerator5OrderVBR.");
-              auto gen = std::make_shared<DP::Ph1::SynchronGenerator5OrderVBR>(
-                  machine->mRID, machine->name, mComponentLogLevel);
-              gen->setOperationalParametersPerUnit(
-                  ratedPower, ratedVoltage, mFrequency, H, Ld, Lq, Ll, Ld_t,
-                  Lq_t, Td0_t, Tq0_t, Ld_s, Lq_s, Td0_s, Tq0_s, 0.0);
-              return gen;
-            } else if (mGeneratorType == GeneratorType::SG4OrderVBR) {
-              SPDLOG_LOGGER_DEBUG(
-                  mSLog, "    GeneratorType is SynchronGenerator4OrderVBR.");
-              auto gen = std::make_shared<DP::Ph1::SynchronGenerator4OrderVBR>(
-                  machine->mRID, machine->name, mComponentLogLevel);
-              gen->setOperationalParametersPerUnit(ratedPower, ratedVoltage,
-                                                   mFrequency, H, Ld, Lq, Ll,
-                                                   Ld_t, Lq_t, Td0_t, Tq0_t);
-              return gen;
-            } else if (mGeneratorType == GeneratorType::SG3OrderVBR) {
-              SPDLOG_LOGGER_DEBUG(
-                  mSLog, "    GeneratorType is SynchronGenerator3OrderVBR.");
-              auto gen = std::make_shared<DP::Ph1::SynchronGenerator3OrderVBR>(
-                  machine->mRID, machine->name, mComponentLogLevel);
-              gen->setOperationalParametersPerUnit(ratedPower, ratedVoltage,
-                                                   mFrequency, H, Ld, Lq, Ll,
-                                                   Ld_t, Td0_t);
-              return gen;
-            } else if (mGeneratorType == GeneratorType::SG4OrderPCM) {
-              SPDLOG_LOGGER_DEBUG(
-                  mSLog, "    GeneratorType is SynchronGenerator4OrderPCM.");
-              auto gen = std::make_shared<DP::Ph1::SynchronGenerator4OrderPCM>(
-                  machine->mRID, machine->name, mComponentLogLevel);
-              gen->setOperationalParametersPerUnit(ratedPower, ratedVoltage,
-                                                   mFrequency, H, Ld, Lq, Ll,
-                                                   Ld_t, Lq_t, Td0_t, Tq0_t);
-              return gen;
-            } else if (mGeneratorType == GeneratorType::SG4OrderTPM) {
-              SPDLOG_LOGGER_DEBUG(
-                  mSLog, "    GeneratorType is SynchronGenerator4OrderTPM.");
-              auto gen = std::make_shared<DP::Ph1::SynchronGenerator4OrderTPM>(
-                  machine->mRID, machine->name, mComponentLogLevel);
-              gen->setOperationalParametersPerUnit(ratedPower, ratedVoltage,
-                                                   mFrequency, H, Ld, Lq, Ll,
-                                                   Ld_t, Lq_t, Td0_t, Tq0_t);
-              return gen;
-            } else if (mGeneratorType == GeneratorType::SG6OrderPCM) {
-              SPDLOG_LOGGER_DEBUG(
-                  mSLog, "    GeneratorType is SynchronGenerator6OrderPCM.");
-              auto gen = std::make_shared<DP::Ph1::SynchronGenerator6OrderPCM>(
-                  machine->mRID, machine->name, mComponentLogLevel);
-              gen->setOperationalParametersPerUnit(
-                  ratedPower, ratedVoltage, mFrequency, H, Ld, Lq, Ll, Ld_t,
-                  Lq_t, Td0_t, Tq0_t, Ld_s, Lq_s, Td0_s, Tq0_s);
-              return gen;
-            }
-          }
+      Real ratedPower = unitValue(machine.ratedS, UnitMultiplier::M);
+      Real ratedVoltage = unitValue(machine.ratedU, UnitMultiplier::k);
+
+      if (machine.hasDynamics) {
+        auto &genDyn = machine.dynamics;
+        // stator
+        Real Rs = genDyn.statorResistance;
+        Real Ll = genDyn.statorLeakageReactance;
+
+        // reactances
+        Real Ld = genDyn.xDirectSync;
+        Real Lq = genDyn.xQuadSync;
+        Real Ld_t = genDyn.xDirectTrans;
+        Real Lq_t = genDyn.xQuadTrans;
+        Real Ld_s = genDyn.xDirectSubtrans;
+        Real Lq_s = genDyn.xQuadSubtrans;
+
+        // time constants
+        Real Td0_t = genDyn.tpdo;
+        Real Tq0_t = genDyn.tpqo;
+        Real Td0_s = genDyn.tppdo;
+        Real Tq0_s = genDyn.tppqo;
+
+        // inertia
+        Real H = genDyn.inertia;
+
+        // not available in CIM -> set to 0, as actually no impact on machine equations
+        Int poleNum = 0;
+        Real nomFieldCurr = 0;
+
+        if (mGeneratorType == GeneratorType::TransientStability) {
+          SPDLOG_LOGGER_DEBUG(mSLog,
+                              "    GeneratorType is TransientStability.");
+          auto gen = DP::Ph1::SynchronGeneratorTrStab::make(
+              machine.mRID, machine.name, mComponentLogLevel);
+          gen->setStandardParametersPU(ratedPower, ratedVoltage, mFrequency,
+                                       Ld_t, H);
+          return gen;
+        } else if (mGeneratorType == GeneratorType::SG6aOrderVBR) {
+          SPDLOG_LOGGER_DEBUG(
+              mSLog, "    GeneratorType is SynchronGenerator6aOrderVBR.");
+          auto gen = std::make_shared<DP::Ph1::SynchronGenerator6aOrderVBR>(
+              machine.mRID, machine.name, mComponentLogLevel);
+          gen->setOperationalParametersPerUnit(
+              ratedPower, ratedVoltage, mFrequency, H, Ld, Lq, Ll, Ld_t,
+              Lq_t, Td0_t, Tq0_t, Ld_s, Lq_s, Td0_s, Tq0_s);
+          return gen;
+        } else if (mGeneratorType == GeneratorType::SG6bOrderVBR) {
+          SPDLOG_LOGGER_DEBUG(
+              mSLog, "    GeneratorType is SynchronGenerator6bOrderVBR.");
+          auto gen = std::make_shared<DP::Ph1::SynchronGenerator6bOrderVBR>(
+              machine.mRID, machine.name, mComponentLogLevel);
+          gen->setOperationalParametersPerUnit(
+              ratedPower, ratedVoltage, mFrequency, H, Ld, Lq, Ll, Ld_t,
+              Lq_t, Td0_t, Tq0_t, Ld_s, Lq_s, Td0_s, Tq0_s);
+          return gen;
+        } else if (mGeneratorType == GeneratorType::SG5OrderVBR) {
+          SPDLOG_LOGGER_DEBUG(
+              mSLog, "    GeneratorType is SynchronGenerator5OrderVBR.");
+          auto gen = std::make_shared<DP::Ph1::SynchronGenerator5OrderVBR>(
+              machine.mRID, machine.name, mComponentLogLevel);
+          gen->setOperationalParametersPerUnit(
+              ratedPower, ratedVoltage, mFrequency, H, Ld, Lq, Ll, Ld_t,
+              Lq_t, Td0_t, Tq0_t, Ld_s, Lq_s, Td0_s, Tq0_s, 0.0);
+          return gen;
+        } else if (mGeneratorType == GeneratorType::SG4OrderVBR) {
+          SPDLOG_LOGGER_DEBUG(
+              mSLog, "    GeneratorType is SynchronGenerator4OrderVBR.");
+          auto gen = std::make_shared<DP::Ph1::SynchronGenerator4OrderVBR>(
+              machine.mRID, machine.name, mComponentLogLevel);
+          gen->setOperationalParametersPerUnit(ratedPower, ratedVoltage,
+                                               mFrequency, H, Ld, Lq, Ll,
+                                               Ld_t, Lq_t, Td0_t, Tq0_t);
+          return gen;
+        } else if (mGeneratorType == GeneratorType::SG3OrderVBR) {
+          SPDLOG_LOGGER_DEBUG(
+              mSLog, "    GeneratorType is SynchronGenerator3OrderVBR.");
+          auto gen = std::make_shared<DP::Ph1::SynchronGenerator3OrderVBR>(
+              machine.mRID, machine.name, mComponentLogLevel);
+          gen->setOperationalParametersPerUnit(ratedPower, ratedVoltage,
+                                               mFrequency, H, Ld, Lq, Ll,
+                                               Ld_t, Td0_t);
+          return gen;
+        } else if (mGeneratorType == GeneratorType::SG4OrderPCM) {
+          SPDLOG_LOGGER_DEBUG(
+              mSLog, "    GeneratorType is SynchronGenerator4OrderPCM.");
+          auto gen = std::make_shared<DP::Ph1::SynchronGenerator4OrderPCM>(
+              machine.mRID, machine.name, mComponentLogLevel);
+          gen->setOperationalParametersPerUnit(ratedPower, ratedVoltage,
+                                               mFrequency, H, Ld, Lq, Ll,
+                                               Ld_t, Lq_t, Td0_t, Tq0_t);
+          return gen;
+        } else if (mGeneratorType == GeneratorType::SG4OrderTPM) {
+          SPDLOG_LOGGER_DEBUG(
+              mSLog, "    GeneratorType is SynchronGenerator4OrderTPM.");
+          auto gen = std::make_shared<DP::Ph1::SynchronGenerator4OrderTPM>(
+              machine.mRID, machine.name, mComponentLogLevel);
+          gen->setOperationalParametersPerUnit(ratedPower, ratedVoltage,
+                                               mFrequency, H, Ld, Lq, Ll,
+                                               Ld_t, Lq_t, Td0_t, Tq0_t);
+          return gen;
+        } else if (mGeneratorType == GeneratorType::SG6OrderPCM) {
+          SPDLOG_LOGGER_DEBUG(
+              mSLog, "    GeneratorType is SynchronGenerator6OrderPCM.");
+          auto gen = std::make_shared<DP::Ph1::SynchronGenerator6OrderPCM>(
+              machine.mRID, machine.name, mComponentLogLevel);
+          gen->setOperationalParametersPerUnit(
+              ratedPower, ratedVoltage, mFrequency, H, Ld, Lq, Ll, Ld_t,
+              Lq_t, Td0_t, Tq0_t, Ld_s, Lq_s, Td0_s, Tq0_s);
+          return gen;
         }
       }
     } else if (mGeneratorType == GeneratorType::IdealVoltageSource) {
       SPDLOG_LOGGER_DEBUG(mSLog, "    GeneratorType is IdealVoltageSource.");
       return std::make_shared<DP::Ph1::SynchronGeneratorIdeal>(
-          machine->mRID, machine->name, mComponentLogLevel);
+          machine.mRID, machine.name, mComponentLogLevel);
     } else if (mGeneratorType == GeneratorType::None) {
       throw SystemError("GeneratorType is None. Specify!");
     } else {
@@ -732,159 +1085,139 @@ Reader::mapSynchronousMachine(CIMPP::SynchronousMachine *machine) {
         mGeneratorType == GeneratorType::SG4OrderVBR ||
         mGeneratorType == GeneratorType::SG3OrderVBR) {
 
-      Real ratedPower = unitValue(machine->ratedS.value, UnitMultiplier::M);
-      Real ratedVoltage = unitValue(machine->ratedU.value, UnitMultiplier::k);
-
-      for (auto obj : mModel->Objects) {
-        // Check if object is not TopologicalNode, SvVoltage or SvPowerFlow
-        if (CIMPP::SynchronousMachineTimeConstantReactance *genDyn =
-                dynamic_cast<CIMPP::SynchronousMachineTimeConstantReactance *>(
-                    obj)) {
-          if (genDyn->SynchronousMachine->mRID == machine->mRID) {
-            // stator
-            Real Rs = genDyn->statorResistance.value;
-            Real Ll = genDyn->statorLeakageReactance.value;
-
-            // reactances
-            Real Ld = genDyn->xDirectSync.value;
-            Real Lq = genDyn->xQuadSync.value;
-            Real Ld_t = genDyn->xDirectTrans.value;
-            Real Lq_t = genDyn->xQuadTrans.value;
-            Real Ld_s = genDyn->xDirectSubtrans.value;
-            Real Lq_s = genDyn->xQuadSubtrans.value;
-
-            // time constants
-            Real Td0_t = genDyn->tpdo.value;
-            Real Tq0_t = genDyn->tpqo.value;
-            Real Td0_s = genDyn->tppdo.value;
-            Real Tq0_s = genDyn->tppqo.value;
-
-            // inertia
-            Real H = genDyn->inertia.value;
-
-            // not available in CIM -> set to 0, as actually no impact on machine equations
-            Int poleNum = 0;
-            Real nomFieldCurr = 0;
-
-            if (mGeneratorType == GeneratorType::TransientStability) {
-              SPDLOG_LOGGER_DEBUG(mSLog,
-                                  "    GeneratorType is TransientStability.");
-              auto gen = SP::Ph1::SynchronGeneratorTrStab::make(
-                  machine->mRID, machine->name, mComponentLogLevel);
-              gen->setStandardParametersPU(ratedPower, ratedVoltage, mFrequency,
-                                           Ld_t, H);
-              return gen;
-            } else if (mGeneratorType == GeneratorType::SG6aOrderVBR) {
-              SPDLOG_LOGGER_DEBUG(
-                  mSLog, "    GeneratorType is SynchronGenerator6aOrderVBR.");
-              auto gen = std::make_shared<SP::Ph1::SynchronGenerator6aOrderVBR>(
-                  machine->mRID, machine->name, mComponentLogLevel);
-              gen->setOperationalParametersPerUnit(
-                  ratedPower, ratedVoltage, mFrequency, H, Ld, Lq, Ll, Ld_t,
-                  Lq_t, Td0_t, Tq0_t, Ld_s, Lq_s, Td0_s, Tq0_s);
-              return gen;
-            } else if (mGeneratorType == GeneratorType::SG6bOrderVBR) {
-              SPDLOG_LOGGER_DEBUG(
-                  mSLog, "    GeneratorType is SynchronGenerator6bOrderVBR.");
-              auto gen = std::make_shared<SP::Ph1::SynchronGenerator6bOrderVBR>(
-                  machine->mRID, machine->name, mComponentLogLevel);
-              gen->setOperationalParametersPerUnit(
-                  ratedPower, ratedVoltage, mFrequency, H, Ld, Lq, Ll, Ld_t,
-                  Lq_t, Td0_t, Tq0_t, Ld_s, Lq_s, Td0_s, Tq0_s);
-              return gen;
-            } else if (mGeneratorType == GeneratorType::SG5OrderVBR) {
-              SPDLOG_LOGGER_DEBUG(
-                  mSLog, "    GeneratorType is SynchronGenerator5OrderVBR.");
-              auto gen = std::make_shared<SP::Ph1::SynchronGenerator5OrderVBR>(
-                  machine->mRID, machine->name, mComponentLogLevel);
-              gen->setOperationalParametersPerUnit(
-                  ratedPower, ratedVoltage, mFrequency, H, Ld, Lq, Ll, Ld_t,
-                  Lq_t, Td0_t, Tq0_t, Ld_s, Lq_s, Td0_s, Tq0_s, 0.0);
-              return gen;
-            } else if (mGeneratorType == GeneratorType::SG4OrderVBR) {
-              SPDLOG_LOGGER_DEBUG(
-                  mSLog, "    GeneratorType is SynchronGenerator4OrderVBR.");
-              auto gen = std::make_shared<SP::Ph1::SynchronGenerator4OrderVBR>(
-                  machine->mRID, machine->name, mComponentLogLevel);
-              gen->setOperationalParametersPerUnit(ratedPower, ratedVoltage,
-                                                   mFrequency, H, Ld, Lq, Ll,
-                                                   Ld_t, Lq_t, Td0_t, Tq0_t);
-              return gen;
-            } else if (mGeneratorType == GeneratorType::SG3OrderVBR) {
-              SPDLOG_LOGGER_DEBUG(
-                  mSLog, "    GeneratorType is SynchronGenerator3OrderVBR.");
-              auto gen = std::make_shared<SP::Ph1::SynchronGenerator3OrderVBR>(
-                  machine->mRID, machine->name, mComponentLogLevel);
-              gen->setOperationalParametersPerUnit(ratedPower, ratedVoltage,
-                                                   mFrequency, H, Ld, Lq, Ll,
-                                                   Ld_t, Td0_t);
-              return gen;
-            }
-          }
+      Real ratedPower = unitValue(machine.ratedS, UnitMultiplier::M);
+      Real ratedVoltage = unitValue(machine.ratedU, UnitMultiplier::k);
+
+      if (machine.hasDynamics) {
+        auto &genDyn = machine.dynamics;
+        // stator
+        Real Rs = genDyn.statorResistance;
+        Real Ll = genDyn.statorLeakageReactance;
+
+        // reactances
+        Real Ld = genDyn.xDirectSync;
+        Real Lq = genDyn.xQuadSync;
+        Real Ld_t = genDyn.xDirectTrans;
+        Real Lq_t = genDyn.xQuadTrans;
+        Real Ld_s = genDyn.xDirectSubtrans;
+        Real Lq_s = genDyn.xQuadSubtrans;
+
+        // time constants
+        Real Td0_t = genDyn.tpdo;
+        Real Tq0_t = genDyn.tpqo;
+        Real Td0_s = genDyn.tppdo;
+        Real Tq0_s = genDyn.tppqo;
+
+        // inertia
+        Real H = genDyn.inertia;
+
+        // not available in CIM -> set to 0, as actually no impact on machine equations
+        Int poleNum = 0;
+        Real nomFieldCurr = 0;
+
+        if (mGeneratorType == GeneratorType::TransientStability) {
+          SPDLOG_LOGGER_DEBUG(mSLog,
+                              "    GeneratorType is TransientStability.");
+          auto gen = SP::Ph1::SynchronGeneratorTrStab::make(
+              machine.mRID, machine.name, mComponentLogLevel);
+          gen->setStandardParametersPU(ratedPower, ratedVoltage, mFrequency,
+                                       Ld_t, H);
+          return gen;
+        } else if (mGeneratorType == GeneratorType::SG6aOrderVBR) {
+          SPDLOG_LOGGER_DEBUG(
+              mSLog, "    GeneratorType is SynchronGenerator6aOrderVBR.");
+          auto gen = std::make_shared<SP::Ph1::SynchronGenerator6aOrderVBR>(
+              machine.mRID, machine.name, mComponentLogLevel);
+          gen->setOperationalParametersPerUnit(
+              ratedPower, ratedVoltage, mFrequency, H, Ld, Lq, Ll, Ld_t,
+              Lq_t, Td0_t, Tq0_t, Ld_s, Lq_s, Td0_s, Tq0_s);
+          return gen;
+        } else if (mGeneratorType == GeneratorType::SG6bOrderVBR) {
+          SPDLOG_LOGGER_DEBUG(
+              mSLog, "    GeneratorType is SynchronGenerator6bOrderVBR.");
+          auto gen = std::make_shared<SP::Ph1::SynchronGenerator6bOrderVBR>(
+              machine.mRID, machine.name, mComponentLogLevel);
+          gen->setOperationalParametersPerUnit(
+              ratedPower, ratedVoltage, mFrequency, H, Ld, Lq, Ll, Ld_t,
+              Lq_t, Td0_t, Tq0_t, Ld_s, Lq_s, Td0_s, Tq0_s);
+          return gen;
+        } else if (mGeneratorType == GeneratorType::SG5OrderVBR) {
+          SPDLOG_LOGGER_DEBUG(
+              mSLog, "    GeneratorType is SynchronGenerator5OrderVBR.");
+          auto gen = std::make_shared<SP::Ph1::SynchronGenerator5OrderVBR>(
+              machine.mRID, machine.name, mComponentLogLevel);
+          gen->setOperationalParametersPerUnit(
+              ratedPower, ratedVoltage, mFrequency, H, Ld, Lq, Ll, Ld_t,
+              Lq_t, Td0_t, Tq0_t, Ld_s, Lq_s, Td0_s, Tq0_s, 0.0);
+          return gen;
+        } else if (mGeneratorType == GeneratorType::SG4OrderVBR) {
+          SPDLOG_LOGGER_DEBUG(
+              mSLog, "    GeneratorType is SynchronGenerator4OrderVBR.");
+          auto gen = std::make_shared<SP::Ph1::SynchronGenerator4OrderVBR>(
+              machine.mRID, machine.name, mComponentLogLevel);
+          gen->setOperationalParametersPerUnit(ratedPower, ratedVoltage,
+                                               mFrequency, H, Ld, Lq, Ll,
+                                               Ld_t, Lq_t, Td0_t, Tq0_t);
+          return gen;
+        } else if (mGeneratorType == GeneratorType::SG3OrderVBR) {
+          SPDLOG_LOGGER_DEBUG(
+              mSLog, "    GeneratorType is SynchronGenerator3OrderVBR.");
+          auto gen = std::make_shared<SP::Ph1::SynchronGenerator3OrderVBR>(
+              machine.mRID, machine.name, mComponentLogLevel);
+          gen->setOperationalParametersPerUnit(ratedPower, ratedVoltage,
+                                               mFrequency, H, Ld, Lq, Ll,
+                                               Ld_t, Td0_t);
+          return gen;
         }
       }
     } else if (mGeneratorType == GeneratorType::PVNode) {
       SPDLOG_LOGGER_DEBUG(mSLog, "    GeneratorType is PVNode.");
-      for (auto obj : mModel->Objects) {
-        if (CIMPP::GeneratingUnit *genUnit =
-                dynamic_cast<CIMPP::GeneratingUnit *>(obj)) {
-          for (auto syncGen : genUnit->RotatingMachine) {
-            if (syncGen->mRID == machine->mRID) {
-              // Check whether relevant input data are set, otherwise set default values
-              Real setPointActivePower = 0;
-              Real setPointVoltage = 0;
-              Real maximumReactivePower = 1e12;
-              try {
-                setPointActivePower =
-                    unitValue(genUnit->initialP.value, UnitMultiplier::M);
-                SPDLOG_LOGGER_INFO(mSLog, "    setPointActivePower={}",
-                                   setPointActivePower);
-              } catch (ReadingUninitializedField *e) {
-                std::cerr
-                    << "Uninitalized setPointActivePower for GeneratingUnit "
-                    << machine->name << ". Using default value of "
+      if (machine.hasGeneratingUnit) {
+        // Check whether relevant input data are set, otherwise set default values
+        Real setPointActivePower = 0;
+        Real setPointVoltage = 0;
+        Real maximumReactivePower = 1e12;
+        if (machine.hasInitialP) {
+          setPointActivePower = unitValue(machine.initialP, UnitMultiplier::M);
+          SPDLOG_LOGGER_INFO(mSLog, "    setPointActivePower={}",
+                             setPointActivePower);
+        } else {
+          std::cerr << "Uninitalized setPointActivePower for GeneratingUnit "
+                    << machine.name << ". Using default value of "
                     << setPointActivePower << std::endl;
-              }
-              if (machine->RegulatingControl) {
-                setPointVoltage =
-                    unitValue(machine->RegulatingControl->targetValue.value,
-                              UnitMultiplier::k);
-                SPDLOG_LOGGER_INFO(mSLog, "    setPointVoltage={}",
-                                   setPointVoltage);
-              } else {
-                std::cerr << "Uninitalized setPointVoltage for GeneratingUnit "
-                          << machine->name << ". Using default value of "
-                          << setPointVoltage << std::endl;
-              }
-              try {
-                maximumReactivePower =
-                    unitValue(machine->maxQ.value, UnitMultiplier::M);
-                SPDLOG_LOGGER_INFO(mSLog, "    maximumReactivePower={}",
-                                   maximumReactivePower);
-              } catch (ReadingUninitializedField *e) {
-                std::cerr
-                    << "Uninitalized maximumReactivePower for GeneratingUnit "
-                    << machine->name << ". Using default value of "
+        }
+        if (machine.hasRegulatingControl) {
+          setPointVoltage = unitValue(machine.targetValue, UnitMultiplier::k);
+          SPDLOG_LOGGER_INFO(mSLog, "    setPointVoltage={}",
+                             setPointVoltage);
+        } else {
+          std::cerr << "Uninitalized setPointVoltage for GeneratingUnit "
+                    << machine.name << ". Using default value of "
+                    << setPointVoltage << std::endl;
+        }
+        if (machine.hasMaxQ) {
+          maximumReactivePower = unitValue(machine.maxQ, UnitMultiplier::M);
+          SPDLOG_LOGGER_INFO(mSLog, "    maximumReactivePower={}",
+                             maximumReactivePower);
+        } else {
+          std::cerr << "Uninitalized maximumReactivePower for GeneratingUnit "
+                    << machine.name << ". Using default value of "
                     << maximumReactivePower << std::endl;
-              }
-
-              auto gen = std::make_shared<SP::Ph1::SynchronGenerator>(
-                  machine->mRID, machine->name, mComponentLogLevel);
-              gen->setParameters(
-                  unitValue(machine->ratedS.value, UnitMultiplier::M),
-                  unitValue(machine->ratedU.value, UnitMultiplier::k),
-                  setPointActivePower, setPointVoltage, PowerflowBusType::PV);
-              gen->setBaseVoltage(
-                  unitValue(machine->ratedU.value, UnitMultiplier::k));
-              return gen;
-            }
-          }
         }
+
+        auto gen = std::make_shared<SP::Ph1::SynchronGenerator>(
+            machine.mRID, machine.name, mComponentLogLevel);
+        gen->setParameters(unitValue(machine.ratedS, UnitMultiplier::M),
+                           unitValue(machine.ratedU, UnitMultiplier::k),
+                           setPointActivePower, setPointVoltage,
+                           PowerflowBusType::PV);
+        gen->setBaseVoltage(unitValue(machine.ratedU, UnitMultiplier::k));
+        return gen;
       }
       SPDLOG_LOGGER_INFO(mSLog, "no corresponding initial power for {}",
-                         machine->name);
+                         machine.name);
       return std::make_shared<SP::Ph1::SynchronGenerator>(
-          machine->mRID, machine->name, mComponentLogLevel);
+          machine.mRID, machine.name, mComponentLogLevel);
     } else if (mGeneratorType == GeneratorType::None) {
       throw SystemError("GeneratorType is None. Specify!");
     } else {
@@ -899,119 +1232,112 @@ Reader::mapSynchronousMachine(CIMPP::SynchronousMachine *machine) {
         mGeneratorType == GeneratorType::SG6aOrderVBR ||
         mGeneratorType == GeneratorType::SG6bOrderVBR) {
 
-      Real ratedPower = unitValue(machine->ratedS.value, UnitMultiplier::M);
-      Real ratedVoltage = unitValue(machine->ratedU.value, UnitMultiplier::k);
-
-      for (auto obj : mModel->Objects) {
-        // Check if object is not TopologicalNode, SvVoltage or SvPowerFlow
-        if (CIMPP::SynchronousMachineTimeConstantReactance *genDyn =
-                dynamic_cast<CIMPP::SynchronousMachineTimeConstantReactance *>(
-                    obj)) {
-          if (genDyn->SynchronousMachine->mRID == machine->mRID) {
-
-            // stator
-            Real Rs = genDyn->statorResistance.value;
-            Real Ll = genDyn->statorLeakageReactance.value;
-
-            // reactances
-            Real Ld = genDyn->xDirectSync.value;
-            Real Lq = genDyn->xQuadSync.value;
-            Real Ld_t = genDyn->xDirectTrans.value;
-            Real Lq_t = genDyn->xQuadTrans.value;
-            Real Ld_s = genDyn->xDirectSubtrans.value;
-            Real Lq_s = genDyn->xQuadSubtrans.value;
-
-            // time constants
-            Real Td0_t = genDyn->tpdo.value;
-            Real Tq0_t = genDyn->tpqo.value;
-            Real Td0_s = genDyn->tppdo.value;
-            Real Tq0_s = genDyn->tppqo.value;
-
-            // inertia
-            Real H = genDyn->inertia.value;
-
-            // not available in CIM -> set to 0, as actually no impact on machine equations
-            Int poleNum = 0;
-            Real nomFieldCurr = 0;
-
-            if (mGeneratorType == GeneratorType::FullOrder) {
-              SPDLOG_LOGGER_DEBUG(mSLog, "    GeneratorType is FullOrder.");
-              auto gen = std::make_shared<EMT::Ph3::SynchronGeneratorDQTrapez>(
-                  machine->mRID, machine->name, mComponentLogLevel);
-              gen->setParametersOperationalPerUnit(
-                  ratedPower, ratedVoltage, mFrequency, poleNum, nomFieldCurr,
-                  Rs, Ld, Lq, Ld_t, Lq_t, Ld_s, Lq_s, Ll, Td0_t, Tq0_t, Td0_s,
-                  Tq0_s, H);
-              return gen;
-            } else if (mGeneratorType == GeneratorType::FullOrderVBR) {
-              SPDLOG_LOGGER_DEBUG(mSLog, "    GeneratorType is FullOrderVBR.");
-              auto gen = std::make_shared<EMT::Ph3::SynchronGeneratorVBR>(
-                  machine->mRID, machine->name, mComponentLogLevel);
-              gen->setBaseAndOperationalPerUnitParameters(
-                  ratedPower, ratedVoltage, mFrequency, poleNum, nomFieldCurr,
-                  Rs, Ld, Lq, Ld_t, Lq_t, Ld_s, Lq_s, Ll, Td0_t, Tq0_t, Td0_s,
-                  Tq0_s, H);
-              return gen;
-            } else if (mGeneratorType == GeneratorType::SG6aOrderVBR) {
-              SPDLOG_LOGGER_DEBUG(
-                  mSLog, "    GeneratorType is SynchronGenerator6aOrderVBR.");
-              auto gen =
-                  std::make_shared<EMT::Ph3::SynchronGenerator6aOrderVBR>(
-                      machine->mRID, machine->name, mComponentLogLevel);
-              gen->setOperationalParametersPerUnit(
-                  ratedPower, ratedVoltage, mFrequency, H, Ld, Lq, Ll, Ld_t,
-                  Lq_t, Td0_t, Tq0_t, Ld_s, Lq_s, Td0_s, Tq0_s);
-              return gen;
-            } else if (mGeneratorType == GeneratorType::SG6bOrderVBR) {
-              SPDLOG_LOGGER_DEBUG(
-                  mSLog, "    GeneratorType is SynchronGenerator6bOrderVBR.");
-              auto gen =
-                  std::make_shared<EMT::Ph3::SynchronGenerator6bOrderVBR>(
-                      machine->mRID, machine->name, mComponentLogLevel);
-              gen->setOperationalParametersPerUnit(
-                  ratedPower, ratedVoltage, mFrequency, H, Ld, Lq, Ll, Ld_t,
-                  Lq_t, Td0_t, Tq0_t, Ld_s, Lq_s, Td0_s, Tq0_s);
-              return gen;
-            } else if (mGeneratorType == GeneratorType::SG5OrderVBR) {
-              SPDLOG_LOGGER_DEBUG(
-                  mSLog, "    GeneratorType is SynchronGenerator5OrderVBR.");
-              auto gen = std::make_shared<EMT::Ph3::SynchronGenerator5OrderVBR>(
-                  machine->mRID, machine->name, mComponentLogLevel);
-              gen->setOperationalParametersPerUnit(
-                  ratedPower, ratedVoltage, mFrequency, H, Ld, Lq, Ll, Ld_t,
-                  Lq_t, Td0_t, Tq0_t, Ld_s, Lq_s, Td0_s, Tq0_s, 0.0);
-              return gen;
-            } else if (mGeneratorType == GeneratorType::SG4OrderVBR) {
-              SPDLOG_LOGGER_DEBUG(
-                  mSLog, "    GeneratorType is SynchronGenerator4OrderVBR.");
-              auto gen = std::make_shared<EMT::Ph3::SynchronGenerator4OrderVBR>(
-                  machine->mRID, machine->name, mComponentLogLevel);
-              gen->setOperationalParametersPerUnit(ratedPower, ratedVoltage,
-                                                   mFrequency, H, Ld, Lq, Ll,
-                                                   Ld_t, Lq_t, Td0_t, Tq0_t);
-              return gen;
-            } else if (mGeneratorType == GeneratorType::SG3OrderVBR) {
-              SPDLOG_LOGGER_DEBUG(
-                  mSLog, "    GeneratorType is SynchronGenerator3OrderVBR.");
-              auto gen = std::make_shared<EMT::Ph3::SynchronGenerator3OrderVBR>(
-                  machine->mRID, machine->name, mComponentLogLevel);
-              gen->setOperationalParametersPerUnit(ratedPower, ratedVoltage,
-                                                   mFrequency, H, Ld, Lq, Ll,
-                                                   Ld_t, Td0_t);
-              return gen;
-            }
-          }
+      Real ratedPower = unitValue(machine.ratedS, UnitMultiplier::M);
+      Real ratedVoltage = unitValue(machine.ratedU, UnitMultiplier::k);
+
+      if (machine.hasDynamics) {
+        auto &genDyn = machine.dynamics;
+        // stator
+        Real Rs = genDyn.statorResistance;
+        Real Ll = genDyn.statorLeakageReactance;
+
+        // reactances
+        Real Ld = genDyn.xDirectSync;
+        Real Lq = genDyn.xQuadSync;
+        Real Ld_t = genDyn.xDirectTrans;
+        Real Lq_t = genDyn.xQuadTrans;
+        Real Ld_s = genDyn.xDirectSubtrans;
+        Real Lq_s = genDyn.xQuadSubtrans;
+
+        // time constants
+        Real Td0_t = genDyn.tpdo;
+        Real Tq0_t = genDyn.tpqo;
+        Real Td0_s = genDyn.tppdo;
+        Real Tq0_s = genDyn.tppqo;
+
+        // inertia
+        Real H = genDyn.inertia;
+
+        // not available in CIM -> set to 0, as actually no impact on machine equations
+        Int poleNum = 0;
+        Real nomFieldCurr = 0;
+
+        if (mGeneratorType == GeneratorType::FullOrder) {
+          SPDLOG_LOGGER_DEBUG(mSLog, "    GeneratorType is FullOrder.");
+          auto gen = std::make_shared<EMT::Ph3::SynchronGeneratorDQTrapez>(
+              machine.mRID, machine.name, mComponentLogLevel);
+          gen->setParametersOperationalPerUnit(
+              ratedPower, ratedVoltage, mFrequency, poleNum, nomFieldCurr,
+              Rs, Ld, Lq, Ld_t, Lq_t, Ld_s, Lq_s, Ll, Td0_t, Tq0_t, Td0_s,
+              Tq0_s, H);
+          return gen;
+        } else if (mGeneratorType == GeneratorType::FullOrderVBR) {
+          SPDLOG_LOGGER_DEBUG(mSLog, "    GeneratorType is FullOrderVBR.");
+          auto gen = std::make_shared<EMT::Ph3::SynchronGeneratorVBR>(
+              machine.mRID, machine.name, mComponentLogLevel);
+          gen->setBaseAndOperationalPerUnitParameters(
+              ratedPower, ratedVoltage, mFrequency, poleNum, nomFieldCurr,
+              Rs, Ld, Lq, Ld_t, Lq_t, Ld_s, Lq_s, Ll, Td0_t, Tq0_t, Td0_s,
+              Tq0_s, H);
+          return gen;
+        } else if (mGeneratorType == GeneratorType::SG6aOrderVBR) {
+          SPDLOG_LOGGER_DEBUG(
+              mSLog, "    GeneratorType is SynchronGenerator6aOrderVBR.");
+          auto gen =
+              std::make_shared<EMT::Ph3::SynchronGenerator6aOrderVBR>(
+                  machine.mRID, machine.name, mComponentLogLevel);
+          gen->setOperationalParametersPerUnit(
+              ratedPower, ratedVoltage, mFrequency, H, Ld, Lq, Ll, Ld_t,
+              Lq_t, Td0_t, Tq0_t, Ld_s, Lq_s, Td0_s, Tq0_s);
+          return gen;
+        } else if (mGeneratorType == GeneratorType::SG6bOrderVBR) {
+          SPDLOG_LOGGER_DEBUG(
+              mSLog, "    GeneratorType is SynchronGenerator6bOrderVBR.");
+          auto gen =
+              std::make_shared<EMT::Ph3::SynchronGenerator6bOrderVBR>(
+                  machine.mRID, machine.name, mComponentLogLevel);
+          gen->setOperationalParametersPerUnit(
+              ratedPower, ratedVoltage, mFrequency, H, Ld, Lq, Ll, Ld_t,
+              Lq_t, Td0_t, Tq0_t, Ld_s, Lq_s, Td0_s, Tq0_s);
+          return gen;
+        } else if (mGeneratorType == GeneratorType::SG5OrderVBR) {
+          SPDLOG_LOGGER_DEBUG(
+              mSLog, "    GeneratorType is SynchronGenerator5OrderVBR.");
+          auto gen = std::make_shared<EMT::Ph3::SynchronGenerator5OrderVBR>(
+              machine.mRID, machine.name, mComponentLogLevel);
+          gen->setOperationalParametersPerUnit(
+              ratedPower, ratedVoltage, mFrequency, H, Ld, Lq, Ll, Ld_t,
+              Lq_t, Td0_t, Tq0_t, Ld_s, Lq_s, Td0_s, Tq0_s, 0.0);
+          return gen;
+        } else if (mGeneratorType == GeneratorType::SG4OrderVBR) {
+          SPDLOG_LOGGER_DEBUG(
+              mSLog, "    GeneratorType is SynchronGenerator4OrderVBR.");
+          auto gen = std::make_shared<EMT::Ph3::SynchronGenerator4OrderVBR>(
+              machine.mRID, machine.name, mComponentLogLevel);
+          gen->setOperationalParametersPerUnit(ratedPower, ratedVoltage,
+                                               mFrequency, H, Ld, Lq, Ll,
+                                               Ld_t, Lq_t, Td0_t, Tq0_t);
+          return gen;
+        } else if (mGeneratorType == GeneratorType::SG3OrderVBR) {
+          SPDLOG_LOGGER_DEBUG(
+              mSLog, "    GeneratorType is SynchronGenerator3OrderVBR.");
+          auto gen = std::make_shared<EMT::Ph3::SynchronGenerator3OrderVBR>(
+              machine.mRID, machine.name, mComponentLogLevel);
+          gen->setOperationalParametersPerUnit(ratedPower, ratedVoltage,
+                                               mFrequency, H, Ld, Lq, Ll,
+                                               Ld_t, Td0_t);
+          return gen;
         }
       }
     } else if (mGeneratorType == GeneratorType::IdealVoltageSource) {
       SPDLOG_LOGGER_DEBUG(mSLog, "    GeneratorType is IdealVoltageSource.");
       return std::make_shared<EMT::Ph3::SynchronGeneratorIdeal>(
-          machine->mRID, machine->name, mComponentLogLevel,
+          machine.mRID, machine.name, mComponentLogLevel,
           GeneratorType::IdealVoltageSource);
     } else if (mGeneratorType == GeneratorType::IdealCurrentSource) {
       SPDLOG_LOGGER_DEBUG(mSLog, "    GeneratorType is IdealCurrentSource.");
       return std::make_shared<EMT::Ph3::SynchronGeneratorIdeal>(
-          machine->mRID, machine->name, mComponentLogLevel,
+          machine.mRID, machine.name, mComponentLogLevel,
           GeneratorType::IdealCurrentSource);
     } else if (mGeneratorType == GeneratorType::None) {
       throw SystemError("GeneratorType is None. Specify!");
@@ -1023,16 +1349,17 @@ Reader::mapSynchronousMachine(CIMPP::SynchronousMachine *machine) {
 }
 
 TopologicalPowerComp::Ptr
-Reader::mapExternalNetworkInjection(CIMPP::ExternalNetworkInjection *extnet) {
+Reader::mapExternalNetworkInjection(
+    const ModelData::ExternalNetworkInjection &extnet) {
   SPDLOG_LOGGER_INFO(mSLog, "Found External Network Injection {}",
-                     extnet->name);
+                     extnet.name);
 
-  Real baseVoltage = determineBaseVoltageAssociatedWithEquipment(extnet);
+  Real baseVoltage = extnet.baseVoltage;
 
   if (mDomain == Domain::EMT) {
     if (mPhase == PhaseType::ABC) {
       return std::make_shared<EMT::Ph3::NetworkInjection>(
-          extnet->mRID, extnet->name, mComponentLogLevel);
+          extnet.mRID, extnet.name, mComponentLogLevel);
     } else {
       throw SystemError(
           "Mapping of ExternalNetworkInjection for EMT::Ph1 not existent!");
@@ -1041,26 +1368,24 @@ Reader::mapExternalNetworkInjection(CIMPP::ExternalNetworkInjection *extnet) {
   } else if (mDomain == Domain::SP) {
     if (mPhase == PhaseType::Single) {
       auto cpsextnet = std::make_shared<SP::Ph1::NetworkInjection>(
-          extnet->mRID, extnet->name, mComponentLogLevel);
+          extnet.mRID, extnet.name, mComponentLogLevel);
       cpsextnet->modifyPowerFlowBusType(
           PowerflowBusType::
               VD); // for powerflow solver set as VD component as default
       cpsextnet->setBaseVoltage(baseVoltage);
 
-      try {
-        if (extnet->RegulatingControl) {
-          SPDLOG_LOGGER_INFO(mSLog, "       Voltage set-point={}",
-                             (float)extnet->RegulatingControl->targetValue);
-          cpsextnet->setParameters(
-              extnet->RegulatingControl->targetValue *
-              baseVoltage); // assumes that value is specified in CIM data in per unit
-        } else {
-          SPDLOG_LOGGER_INFO(
-              mSLog, "       No voltage set-point defined. Using 1 per unit.");
-          cpsextnet->setParameters(1. * baseVoltage);
-        }
-      } catch (ReadingUninitializedField *e) {
+      if (extnet.hasRegulatingControl && !extnet.hasTargetValue) {
         std::cerr << "Ignore incomplete RegulatingControl" << std::endl;
+      } else if (extnet.hasRegulatingControl) {
+        SPDLOG_LOGGER_INFO(mSLog, "       Voltage set-point={}",
+                           (float)extnet.targetValue);
+        cpsextnet->setParameters(
+            extnet.targetValue *
+            baseVoltage); // assumes that value is specified in CIM data in per unit
+      } else {
+        SPDLOG_LOGGER_INFO(
+            mSLog, "       No voltage set-point defined. Using 1 per unit.");
+        cpsextnet->setParameters(1. * baseVoltage);
       }
 
       return cpsextnet;
@@ -1072,7 +1397,7 @@ Reader::mapExternalNetworkInjection(CIMPP::ExternalNetworkInjection *extnet) {
   } else {
     if (mPhase == PhaseType::Single) {
       return std::make_shared<DP::Ph1::NetworkInjection>(
-          extnet->mRID, extnet->name, mComponentLogLevel);
+          extnet.mRID, extnet.name, mComponentLogLevel);
     } else {
       throw SystemError(
           "Mapping of ExternalNetworkInjection for DP::Ph3 not existent!");
@@ -1082,14 +1407,14 @@ Reader::mapExternalNetworkInjection(CIMPP::ExternalNetworkInjection *extnet) {
 }
 
 TopologicalPowerComp::Ptr
-Reader::mapEquivalentShunt(CIMPP::EquivalentShunt *shunt) {
-  SPDLOG_LOGGER_INFO(mSLog, "Found shunt {}", shunt->name);
+Reader::mapEquivalentShunt(const ModelData::EquivalentShunt &shunt) {
+  SPDLOG_LOGGER_INFO(mSLog, "Found shunt {}", shunt.name);
 
-  Real baseVoltage = determineBaseVoltageAssociatedWithEquipment(shunt);
+  Real baseVoltage = shunt.baseVoltage;
 
-  auto cpsShunt = std::make_shared<SP::Ph1::Shunt>(shunt->mRID, shunt->name,
+  auto cpsShunt = std::make_shared<SP::Ph1::Shunt>(shunt.mRID, shunt.name,
                                                    mComponentLogLevel);
-  cpsShunt->setParameters(shunt->g.value, shunt->b.value);
+  cpsShunt->setParameters(shunt.g, shunt.b);
   cpsShunt->setBaseVoltage(baseVoltage);
   return cpsShunt;
 }
@@ -1099,112 +1424,90 @@ Real Reader::determineBaseVoltageAssociatedWithEquipment(
   Real baseVoltage = 0;
 
   // first look for baseVolt object to determine baseVoltage
-  for (auto obj : mModel->Objects) {
-    if (CIMPP::BaseVoltage *baseVolt =
-            dynamic_cast<CIMPP::BaseVoltage *>(obj)) {
-      for (auto comp : baseVolt->ConductingEquipment) {
-        if (comp->name == equipment->name) {
-          baseVoltage =
-              unitValue(baseVolt->nominalVoltage.value, UnitMultiplier::k);
-        }
-      }
-    }
-  }
+  auto search = mObjects->equipmentBaseVoltages.find(equipment->name);
+  if (search != mObjects->equipmentBaseVoltages.end())
+    baseVoltage =
+        unitValue(search->second->nominalVoltage.value, UnitMultiplier::k);
   // as second option take baseVoltage of topologicalNode where equipment is connected to
   if (baseVoltage == 0) {
-    for (auto obj : mModel->Objects) {
-      if (CIMPP::TopologicalNode *topNode =
-              dynamic_cast<CIMPP::TopologicalNode *>(obj)) {
-        for (auto term : topNode->Terminal) {
-          if (term->ConductingEquipment->name == equipment->name) {
-            baseVoltage = unitValue(topNode->BaseVoltage->nominalVoltage.value,
-                                    UnitMultiplier::k);
-          }
-        }
-      }
-    }
+    search = mObjects->nodeBaseVoltages.find(equipment->name);
+    if (search != mObjects->nodeBaseVoltages.end())
+      baseVoltage =
+          unitValue(search->second->nominalVoltage.value, UnitMultiplier::k);
   }
 
   return baseVoltage;
 }
 
 template <typename VarType>
-void Reader::processTopologicalNode(CIMPP::TopologicalNode *topNode) {
+void Reader::processTopologicalNode(const ModelData::TopologicalNode &topNode) {
   // Add this node to global node list and assign simulation node incrementally.
   int matrixNodeIndex = Int(mPowerflowNodes.size());
-  mPowerflowNodes[topNode->mRID] = SimNode<VarType>::make(
-      topNode->mRID, topNode->name, matrixNodeIndex, mPhase);
+  mPowerflowNodes[topNode.mRID] = SimNode<VarType>::make(
+      topNode.mRID, topNode.name, matrixNodeIndex, mPhase);
 
   if (mPhase == PhaseType::ABC) {
     SPDLOG_LOGGER_INFO(
         mSLog, "TopologicalNode {} phase A as simulation node {} ",
-        topNode->mRID,
-        mPowerflowNodes[topNode->mRID]->matrixNodeIndex(PhaseType::A));
+        topNode.mRID,
+        mPowerflowNodes[topNode.mRID]->matrixNodeIndex(PhaseType::A));
     SPDLOG_LOGGER_INFO(
         mSLog, "TopologicalNode {} phase B as simulation node {}",
-        topNode->mRID,
-        mPowerflowNodes[topNode->mRID]->matrixNodeIndex(PhaseType::B));
+        topNode.mRID,
+        mPowerflowNodes[topNode.mRID]->matrixNodeIndex(PhaseType::B));
     SPDLOG_LOGGER_INFO(
         mSLog, "TopologicalNode {} phase C as simulation node {}",
-        topNode->mRID,
-        mPowerflowNodes[topNode->mRID]->matrixNodeIndex(PhaseType::C));
+        topNode.mRID,
+        mPowerflowNodes[topNode.mRID]->matrixNodeIndex(PhaseType::C));
   } else
     SPDLOG_LOGGER_INFO(mSLog,
                        "TopologicalNode id: {}, name: {} as simulation node {}",
-                       topNode->mRID, topNode->name,
-                       mPowerflowNodes[topNode->mRID]->matrixNodeIndex());
+                       topNode.mRID, topNode.name,
+                       mPowerflowNodes[topNode.mRID]->matrixNodeIndex());
 
-  for (auto term : topNode->Terminal) {
+  for (auto &term : topNode.terminals) {
     // Insert Terminal if it does not exist in the map and add reference to node.
     // This could be optimized because the Terminal is searched twice.
-    auto cpsTerm = SimTerminal<VarType>::make(term->mRID);
-    mPowerflowTerminals.insert(std::make_pair(term->mRID, cpsTerm));
+    auto cpsTerm = SimTerminal<VarType>::make(term.mRID);
+    mPowerflowTerminals.insert(std::make_pair(term.mRID, cpsTerm));
     cpsTerm->setNode(std::dynamic_pointer_cast<SimNode<VarType>>(
-        mPowerflowNodes[topNode->mRID]));
-
-    if (!term->sequenceNumber.initialized)
-      term->sequenceNumber = 1;
+        mPowerflowNodes[topNode.mRID]));
 
-    SPDLOG_LOGGER_INFO(mSLog, "    Terminal {}, sequenceNumber {}", term->mRID,
-                       (int)term->sequenceNumber);
+    SPDLOG_LOGGER_INFO(mSLog, "    Terminal {}, sequenceNumber {}", term.mRID,
+                       term.sequenceNumber);
 
     // Try to process Equipment connected to Terminal.
-    CIMPP::ConductingEquipment *equipment = term->ConductingEquipment;
-    if (!equipment) {
+    if (term.equipment.empty()) {
       SPDLOG_LOGGER_WARN(mSLog, "Terminal {} has no Equipment, ignoring!",
-                         term->mRID);
+                         term.mRID);
     } else {
-      // Insert Equipment if it does not exist in the map and add reference to Terminal.
-      // This could be optimized because the Equipment is searched twice.
-      if (mPowerflowEquipment.find(equipment->mRID) ==
-          mPowerflowEquipment.end()) {
-        TopologicalPowerComp::Ptr comp = mapComponent(equipment);
-        if (comp) {
-          mPowerflowEquipment.insert(std::make_pair(equipment->mRID, comp));
-        } else {
-          SPDLOG_LOGGER_WARN(mSLog, "Could not map equipment {}",
-                             equipment->mRID);
-          continue;
-        }
+      // The equipment has already been mapped by mapEquipment, add the
+      // reference to the Terminal.
+      auto search = mPowerflowEquipment.find(term.equipment);
+      if (search == mPowerflowEquipment.end()) {
+        SPDLOG_LOGGER_WARN(mSLog, "Could not map equipment {}",
+                           term.equipment);
+        continue;
       }
 
-      auto pfEquipment = mPowerflowEquipment.at(equipment->mRID);
+      auto pfEquipment = search->second;
       if (pfEquipment == nullptr) {
-        SPDLOG_LOGGER_ERROR(mSLog, "Equipment {} is null in equipment list", equipment->mRID);
+        SPDLOG_LOGGER_ERROR(mSLog, "Equipment {} is null in equipment list",
+                            term.equipment);
         throw SystemError("Equipment is null in equipment list.");
       }
       std::dynamic_pointer_cast<SimPowerComp<VarType>>(pfEquipment)
           ->setTerminalAt(std::dynamic_pointer_cast<SimTerminal<VarType>>(
-                              mPowerflowTerminals[term->mRID]),
-                          term->sequenceNumber - 1);
+                              mPowerflowTerminals[term.mRID]),
+                          term.sequenceNumber - 1);
 
       SPDLOG_LOGGER_INFO(mSLog, "        Added Terminal {} to Equipment {}",
-                         term->mRID, equipment->mRID);
+                         term.mRID, term.equipment);
     }
   }
 }
 
-template void
-Reader::processTopologicalNode<Real>(CIMPP::TopologicalNode *topNode);
-template void
-Reader::processTopologicalNode<Complex>(CIMPP::TopologicalNode *topNode);
+template void Reader::processTopologicalNode<Real>(
+    const ModelData::TopologicalNode &topNode);
+template void Reader::processTopologicalNode<Complex>(
+    const ModelData::TopologicalNode &topNode);
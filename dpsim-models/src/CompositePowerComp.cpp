@@ -59,6 +59,16 @@ void CompositePowerComp<VarType>::mnaCompInitialize(
   mnaParentInitialize(omega, timeStep, leftVector);
 }
 
+template <typename VarType>
+void CompositePowerComp<VarType>::mnaUpdateSubcomponentsTimeStep(
+    Real omega, Real timeStep) {
+  for (auto subComp : mSubcomponentsMNA) {
+    if (auto varStepComp =
+            std::dynamic_pointer_cast<MNAVariableTimeStepInterface>(subComp))
+      varStepComp->mnaUpdateTimeStep(omega, timeStep);
+  }
+}
+
 template <typename VarType>
 void CompositePowerComp<VarType>::mnaCompApplySystemMatrixStamp(
     SparseMatrixRow &systemMatrix) {
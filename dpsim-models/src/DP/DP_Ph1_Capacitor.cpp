@@ -63,16 +63,9 @@ void DP::Ph1::Capacitor::initializeFromNodesAndTerminals(Real frequency) {
 void DP::Ph1::Capacitor::mnaCompInitialize(Real omega, Real timeStep,
                                            Attribute<Matrix>::Ptr leftVector) {
   updateMatrixNodeIndices();
-
-  Real equivCondReal = 2.0 * **mCapacitance / timeStep;
-  Real prevVoltCoeffReal = 2.0 * **mCapacitance / timeStep;
+  mnaUpdateTimeStep(omega, timeStep);
 
   for (UInt freq = 0; freq < mNumFreqs; freq++) {
-    Real equivCondImag = 2. * PI * mFrequencies(freq, 0) * **mCapacitance;
-    mEquivCond(freq, 0) = {equivCondReal, equivCondImag};
-    Real prevVoltCoeffImag = -2. * PI * mFrequencies(freq, 0) * **mCapacitance;
-    mPrevVoltCoeff(freq, 0) = {prevVoltCoeffReal, prevVoltCoeffImag};
-
     mEquivCurrent(freq, 0) =
         -(**mIntfCurrent)(0, freq) +
         -mPrevVoltCoeff(freq, 0) * (**mIntfVoltage)(0, freq);
@@ -93,6 +86,19 @@ void DP::Ph1::Capacitor::mnaCompInitialize(Real omega, Real timeStep,
   mSLog->flush();
 }
 
+void DP::Ph1::Capacitor::mnaUpdateTimeStep(Real omega, Real timeStep) {
+  // The coefficients of all harmonics follow from the component frequencies
+  Real equivCondReal = 2.0 * **mCapacitance / timeStep;
+  Real prevVoltCoeffReal = 2.0 * **mCapacitance / timeStep;
+
+  for (UInt freq = 0; freq < mNumFreqs; freq++) {
+    Real equivCondImag = 2. * PI * mFrequencies(freq, 0) * **mCapacitance;
+    mEquivCond(freq, 0) = {equivCondReal, equivCondImag};
+    Real prevVoltCoeffImag = -2. * PI * mFrequencies(freq, 0) * **mCapacitance;
+    mPrevVoltCoeff(freq, 0) = {prevVoltCoeffReal, prevVoltCoeffImag};
+  }
+}
+
 void DP::Ph1::Capacitor::mnaCompInitializeHarm(
     Real omega, Real timeStep,
     std::vector<Attribute<Matrix>::Ptr> leftVectors) {
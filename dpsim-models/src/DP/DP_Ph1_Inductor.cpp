@@ -60,7 +60,20 @@ void DP::Ph1::Inductor::initializeFromNodesAndTerminals(Real frequency) {
 
 // #### MNA functions ####
 
-void DP::Ph1::Inductor::initVars(Real timeStep) {
+void DP::Ph1::Inductor::initVars(Real omega, Real timeStep) {
+  mnaUpdateTimeStep(omega, timeStep);
+  for (UInt freq = 0; freq < mNumFreqs; freq++) {
+    // In steady-state, these variables should not change
+    mEquivCurrent(freq, 0) = mEquivCond(freq, 0) * (**mIntfVoltage)(0, freq) +
+                             mPrevCurrFac(freq, 0) * (**mIntfCurrent)(0, freq);
+    (**mIntfCurrent)(0, freq) =
+        mEquivCond(freq, 0) * (**mIntfVoltage)(0, freq) +
+        mEquivCurrent(freq, 0);
+  }
+}
+
+void DP::Ph1::Inductor::mnaUpdateTimeStep(Real omega, Real timeStep) {
+  // The coefficients of all harmonics follow from the component frequencies
   for (UInt freq = 0; freq < mNumFreqs; freq++) {
     Real a = timeStep / (2. * **mInductance);
     Real b = timeStep * 2. * PI * mFrequencies(freq, 0) / 2.;
@@ -71,20 +84,13 @@ void DP::Ph1::Inductor::initVars(Real timeStep) {
     Real preCurrFracReal = (1. - b * b) / (1. + b * b);
     Real preCurrFracImag = (-2. * b) / (1. + b * b);
     mPrevCurrFac(freq, 0) = {preCurrFracReal, preCurrFracImag};
-
-    // In steady-state, these variables should not change
-    mEquivCurrent(freq, 0) = mEquivCond(freq, 0) * (**mIntfVoltage)(0, freq) +
-                             mPrevCurrFac(freq, 0) * (**mIntfCurrent)(0, freq);
-    (**mIntfCurrent)(0, freq) =
-        mEquivCond(freq, 0) * (**mIntfVoltage)(0, freq) +
-        mEquivCurrent(freq, 0);
   }
 }
 
 void DP::Ph1::Inductor::mnaCompInitialize(Real omega, Real timeStep,
                                           Attribute<Matrix>::Ptr leftVector) {
   updateMatrixNodeIndices();
-  initVars(timeStep);
+  initVars(omega, timeStep);
 
   SPDLOG_LOGGER_INFO(mSLog,
                      "\n--- MNA initialization ---"
@@ -102,7 +108,7 @@ void DP::Ph1::Inductor::mnaCompInitializeHarm(
     std::vector<Attribute<Matrix>::Ptr> leftVectors) {
   updateMatrixNodeIndices();
 
-  initVars(timeStep);
+  initVars(omega, timeStep);
 
   mMnaTasks.push_back(std::make_shared<MnaPreStepHarm>(*this));
   mMnaTasks.push_back(std::make_shared<MnaPostStepHarm>(*this, leftVectors));
@@ -265,7 +271,7 @@ void DP::Ph1::Inductor::mnaCompUpdateCurrentHarm() {
 
 // #### Tear Methods ####
 void DP::Ph1::Inductor::mnaTearInitialize(Real omega, Real timeStep) {
-  initVars(timeStep);
+  initVars(omega, timeStep);
 }
 
 void DP::Ph1::Inductor::mnaTearApplyMatrixStamp(SparseMatrixRow &tearMatrix) {
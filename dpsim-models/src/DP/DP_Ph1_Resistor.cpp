@@ -205,3 +205,21 @@ void DP::Ph1::Resistor::daeResidual(double ttime, const double state[],
 }
 
 Complex DP::Ph1::Resistor::daeInitialize() { return (**mIntfVoltage)(0, 0); }
+
+void DP::Ph1::Resistor::daeJacobian(double ttime, const double state[],
+                                    const double dstate_dt[], double cj,
+                                    SparseMatrix &jacobian,
+                                    std::vector<int> &off) {
+  // Same equations and offsets as in daeResidual
+  int Pos1 = matrixNodeIndex(0);
+  int Pos2 = matrixNodeIndex(1);
+  int c_offset = off[0] + off[1];
+  int n_offset_1 = c_offset + Pos1 + 1;
+  int n_offset_2 = c_offset + Pos2 + 1;
+  jacobian.coeffRef(c_offset, Pos2) += 1.;
+  jacobian.coeffRef(c_offset, Pos1) -= 1.;
+  jacobian.coeffRef(c_offset, c_offset) -= 1.;
+  jacobian.coeffRef(n_offset_1, c_offset) += 1.0 / **mResistance;
+  jacobian.coeffRef(n_offset_2, c_offset) += 1.0 / **mResistance;
+  off[1] += 1;
+}
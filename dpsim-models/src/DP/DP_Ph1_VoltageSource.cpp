@@ -317,3 +317,18 @@ Complex DP::Ph1::VoltageSource::daeInitialize() {
   (**mIntfVoltage)(0, 0) = mSrcSig->getSignal();
   return mSrcSig->getSignal();
 }
+
+void DP::Ph1::VoltageSource::daeJacobian(double ttime, const double state[],
+                                         const double dstate_dt[], double cj,
+                                         SparseMatrix &jacobian,
+                                         std::vector<int> &off) {
+  // Same equations and offsets as in daeResidual. The nodal equations only
+  // depend on the interface current, which is not part of the state.
+  int Pos1 = matrixNodeIndex(0);
+  int Pos2 = matrixNodeIndex(1);
+  int c_offset = off[0] + off[1];
+  jacobian.coeffRef(c_offset, Pos2) += 1.;
+  jacobian.coeffRef(c_offset, Pos1) -= 1.;
+  jacobian.coeffRef(c_offset, c_offset) -= 1.;
+  off[1] += 1;
+}
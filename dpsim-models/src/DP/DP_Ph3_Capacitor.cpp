@@ -104,6 +104,10 @@ void DP::Ph3::Capacitor::initVars(Real omega, Real timeStep) {
   mEquivCurrent = -mPrevVoltCoeff * **mIntfVoltage - **mIntfCurrent;
 }
 
+void DP::Ph3::Capacitor::mnaUpdateTimeStep(Real omega, Real timeStep) {
+  initVars(omega, timeStep);
+}
+
 void DP::Ph3::Capacitor::mnaCompInitialize(Real omega, Real timeStep,
                                            Attribute<Matrix>::Ptr leftVector) {
   updateMatrixNodeIndices();
@@ -147,7 +151,8 @@ void DP::Ph3::Capacitor::mnaCompApplyRightSideVectorStamp(Matrix &rightVector) {
   //mCureqr = mCurrr + mGcr * mDeltavr + mGci * mDeltavi;
   //mCureqi = mCurri + mGcr * mDeltavi - mGci * mDeltavr;
 
-  mEquivCurrent = -**mIntfCurrent + -mPrevVoltCoeff * **mIntfVoltage;
+  const MatrixFixedSizeComp<3, 1> voltage = **mIntfVoltage;
+  mEquivCurrent = -**mIntfCurrent + -mPrevVoltCoeff * voltage;
 
   if (terminalNotGrounded(0)) {
     Math::setVectorElement(rightVector, matrixNodeIndex(0, 0),
@@ -222,5 +227,6 @@ void DP::Ph3::Capacitor::mnaCompUpdateVoltage(const Matrix &leftVector) {
 }
 
 void DP::Ph3::Capacitor::mnaCompUpdateCurrent(const Matrix &leftVector) {
-  **mIntfCurrent = mEquivCond * **mIntfVoltage + mEquivCurrent;
+  const MatrixFixedSizeComp<3, 1> voltage = **mIntfVoltage;
+  **mIntfCurrent = mEquivCond * voltage + mEquivCurrent;
 }
@@ -93,6 +93,10 @@ void DP::Ph3::Inductor::initVars(Real omega, Real timeStep) {
   //**mIntfCurrent = mEquivCond.cwiseProduct(**mIntfVoltage) + mEquivCurrent;
 }
 
+void DP::Ph3::Inductor::mnaUpdateTimeStep(Real omega, Real timeStep) {
+  initVars(omega, timeStep);
+}
+
 void DP::Ph3::Inductor::mnaCompInitialize(Real omega, Real timeStep,
                                           Attribute<Matrix>::Ptr leftVector) {
   updateMatrixNodeIndices();
@@ -115,7 +119,8 @@ void DP::Ph3::Inductor::mnaCompApplySystemMatrixStamp(
 void DP::Ph3::Inductor::mnaCompApplyRightSideVectorStamp(Matrix &rightVector) {
 
   // Calculate equivalent current source for next time step
-  mEquivCurrent = mEquivCond * **mIntfVoltage + mPrevCurrFac * **mIntfCurrent;
+  const MatrixFixedSizeComp<3, 1> voltage = **mIntfVoltage;
+  mEquivCurrent = mEquivCond * voltage + mPrevCurrFac * **mIntfCurrent;
 
   if (terminalNotGrounded(0)) {
     Math::setVectorElement(rightVector, matrixNodeIndex(0, 0),
@@ -190,7 +195,8 @@ void DP::Ph3::Inductor::mnaCompUpdateVoltage(const Matrix &leftVector) {
 }
 
 void DP::Ph3::Inductor::mnaCompUpdateCurrent(const Matrix &leftVector) {
-  **mIntfCurrent = mEquivCond * **mIntfVoltage + mEquivCurrent;
+  const MatrixFixedSizeComp<3, 1> voltage = **mIntfVoltage;
+  **mIntfCurrent = mEquivCond * voltage + mEquivCurrent;
 }
 
 void DP::Ph3::Inductor::mnaTearInitialize(Real omega, Real timeStep) {
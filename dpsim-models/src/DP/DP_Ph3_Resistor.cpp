@@ -109,7 +109,9 @@ void DP::Ph3::Resistor::mnaCompUpdateVoltage(const Matrix &leftVector) {
 }
 
 void DP::Ph3::Resistor::mnaCompUpdateCurrent(const Matrix &leftVector) {
-  **mIntfCurrent = (**mResistance).inverse() * **mIntfVoltage;
+  const MatrixFixedSize<3, 3> resistance = **mResistance;
+  const MatrixFixedSizeComp<3, 1> voltage = **mIntfVoltage;
+  **mIntfCurrent = resistance.inverse() * voltage;
 
   SPDLOG_LOGGER_DEBUG(mSLog, "Current A: {} < {}",
                       std::abs((**mIntfCurrent)(0, 0)),
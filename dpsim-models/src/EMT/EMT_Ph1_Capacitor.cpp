@@ -51,12 +51,16 @@ void EMT::Ph1::Capacitor::mnaCompInitialize(Real omega, Real timeStep,
                                             Attribute<Matrix>::Ptr leftVector) {
   updateMatrixNodeIndices();
 
-  mEquivCond = (2.0 * **mCapacitance) / timeStep;
+  mnaUpdateTimeStep(omega, timeStep);
   // Update internal state
   mEquivCurrent =
       -(**mIntfCurrent)(0, 0) + -mEquivCond * (**mIntfVoltage)(0, 0);
 }
 
+void EMT::Ph1::Capacitor::mnaUpdateTimeStep(Real omega, Real timeStep) {
+  mEquivCond = (2.0 * **mCapacitance) / timeStep;
+}
+
 void EMT::Ph1::Capacitor::mnaCompApplySystemMatrixStamp(
     SparseMatrixRow &systemMatrix) {
   MNAStampUtils::stampConductance(mEquivCond, systemMatrix, matrixNodeIndex(0),
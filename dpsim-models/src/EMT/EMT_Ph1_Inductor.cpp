@@ -50,11 +50,15 @@ void EMT::Ph1::Inductor::mnaCompInitialize(Real omega, Real timeStep,
                                            Attribute<Matrix>::Ptr leftVector) {
   updateMatrixNodeIndices();
 
-  mEquivCond = timeStep / (2.0 * **mInductance);
+  mnaUpdateTimeStep(omega, timeStep);
   // Update internal state
   mEquivCurrent = mEquivCond * (**mIntfVoltage)(0, 0) + (**mIntfCurrent)(0, 0);
 }
 
+void EMT::Ph1::Inductor::mnaUpdateTimeStep(Real omega, Real timeStep) {
+  mEquivCond = timeStep / (2.0 * **mInductance);
+}
+
 void EMT::Ph1::Inductor::mnaCompApplySystemMatrixStamp(
     SparseMatrixRow &systemMatrix) {
   MNAStampUtils::stampConductance(mEquivCond, systemMatrix, matrixNodeIndex(0),
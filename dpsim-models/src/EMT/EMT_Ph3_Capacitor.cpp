@@ -69,11 +69,15 @@ void EMT::Ph3::Capacitor::initializeFromNodesAndTerminals(Real frequency) {
 void EMT::Ph3::Capacitor::mnaCompInitialize(Real omega, Real timeStep,
                                             Attribute<Matrix>::Ptr leftVector) {
   updateMatrixNodeIndices();
-  mEquivCond = (2.0 * **mCapacitance) / timeStep;
+  mnaUpdateTimeStep(omega, timeStep);
   // Update internal state
   mEquivCurrent = -**mIntfCurrent + -mEquivCond * **mIntfVoltage;
 }
 
+void EMT::Ph3::Capacitor::mnaUpdateTimeStep(Real omega, Real timeStep) {
+  mEquivCond = (2.0 * **mCapacitance) / timeStep;
+}
+
 void EMT::Ph3::Capacitor::mnaCompApplySystemMatrixStamp(
     SparseMatrixRow &systemMatrix) {
   MNAStampUtils::stampConductanceMatrix(
@@ -86,7 +90,8 @@ void EMT::Ph3::Capacitor::mnaCompApplySystemMatrixStamp(
 
 void EMT::Ph3::Capacitor::mnaCompApplyRightSideVectorStamp(
     Matrix &rightVector) {
-  mEquivCurrent = -**mIntfCurrent + -mEquivCond * **mIntfVoltage;
+  const MatrixFixedSize<3, 1> voltage = **mIntfVoltage;
+  mEquivCurrent = -**mIntfCurrent + -mEquivCond * voltage;
   if (terminalNotGrounded(0)) {
     Math::setVectorElement(rightVector, matrixNodeIndex(0, 0),
                            mEquivCurrent(0, 0));
@@ -162,7 +167,8 @@ void EMT::Ph3::Capacitor::mnaCompUpdateVoltage(const Matrix &leftVector) {
 }
 
 void EMT::Ph3::Capacitor::mnaCompUpdateCurrent(const Matrix &leftVector) {
-  **mIntfCurrent = mEquivCond * **mIntfVoltage + mEquivCurrent;
+  const MatrixFixedSize<3, 1> voltage = **mIntfVoltage;
+  **mIntfCurrent = mEquivCond * voltage + mEquivCurrent;
   SPDLOG_LOGGER_DEBUG(mSLog, "\nCurrent: {:s}",
                       Logger::matrixToString(**mIntfCurrent));
 }
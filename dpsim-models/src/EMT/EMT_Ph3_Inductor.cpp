@@ -72,7 +72,7 @@ void EMT::Ph3::Inductor::mnaCompInitialize(Real omega, Real timeStep,
                                            Attribute<Matrix>::Ptr leftVector) {
 
   updateMatrixNodeIndices();
-  mEquivCond = timeStep / 2. * (**mInductance).inverse();
+  mnaUpdateTimeStep(omega, timeStep);
   // Update internal state
   mEquivCurrent = mEquivCond * **mIntfVoltage + **mIntfCurrent;
 
@@ -88,6 +88,10 @@ void EMT::Ph3::Inductor::mnaCompInitialize(Real omega, Real timeStep,
   mSLog->flush();
 }
 
+void EMT::Ph3::Inductor::mnaUpdateTimeStep(Real omega, Real timeStep) {
+  mEquivCond = timeStep / 2. * (**mInductance).inverse();
+}
+
 void EMT::Ph3::Inductor::mnaCompApplySystemMatrixStamp(
     SparseMatrixRow &systemMatrix) {
   MNAStampUtils::stampConductanceMatrix(
@@ -100,7 +104,8 @@ void EMT::Ph3::Inductor::mnaCompApplySystemMatrixStamp(
 
 void EMT::Ph3::Inductor::mnaCompApplyRightSideVectorStamp(Matrix &rightVector) {
   // Update internal state
-  mEquivCurrent = mEquivCond * **mIntfVoltage + **mIntfCurrent;
+  const MatrixFixedSize<3, 1> voltage = **mIntfVoltage;
+  mEquivCurrent = mEquivCond * voltage + **mIntfCurrent;
   if (terminalNotGrounded(0)) {
     Math::setVectorElement(rightVector, matrixNodeIndex(0, 0),
                            mEquivCurrent(0, 0));
@@ -180,7 +185,8 @@ void EMT::Ph3::Inductor::mnaCompUpdateVoltage(const Matrix &leftVector) {
 }
 
 void EMT::Ph3::Inductor::mnaCompUpdateCurrent(const Matrix &leftVector) {
-  **mIntfCurrent = mEquivCond * **mIntfVoltage + mEquivCurrent;
+  const MatrixFixedSize<3, 1> voltage = **mIntfVoltage;
+  **mIntfCurrent = mEquivCond * voltage + mEquivCurrent;
   SPDLOG_LOGGER_DEBUG(mSLog, "\nUpdate Current: {:s}",
                       Logger::matrixToString(**mIntfCurrent));
   mSLog->flush();
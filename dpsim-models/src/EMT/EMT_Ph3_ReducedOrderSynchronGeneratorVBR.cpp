@@ -20,6 +20,8 @@ EMT::Ph3::ReducedOrderSynchronGeneratorVBR::ReducedOrderSynchronGeneratorVBR(
   // model variable
   **mIntfVoltage = Matrix::Zero(3, 1);
   **mIntfCurrent = Matrix::Zero(3, 1);
+  mEvbr = MatrixFixedSize<3, 1>::Zero();
+  mIvbr = MatrixFixedSize<3, 1>::Zero();
 }
 
 EMT::Ph3::ReducedOrderSynchronGeneratorVBR::ReducedOrderSynchronGeneratorVBR(
@@ -240,19 +242,18 @@ void EMT::Ph3::ReducedOrderSynchronGeneratorVBR::
 void EMT::Ph3::ReducedOrderSynchronGeneratorVBR::mnaCompPostStep(
     const Matrix &leftVector) {
   // update armature voltage
-  (**mIntfVoltage)(0, 0) =
-      Math::realFromVectorElement(leftVector, matrixNodeIndex(0, 0));
-  (**mIntfVoltage)(1, 0) =
-      Math::realFromVectorElement(leftVector, matrixNodeIndex(0, 1));
-  (**mIntfVoltage)(2, 0) =
+  MatrixFixedSize<3, 1> vabc;
+  vabc << Math::realFromVectorElement(leftVector, matrixNodeIndex(0, 0)),
+      Math::realFromVectorElement(leftVector, matrixNodeIndex(0, 1)),
       Math::realFromVectorElement(leftVector, matrixNodeIndex(0, 2));
+  **mIntfVoltage = vabc;
 
   // convert terminal voltage into dq reference frame
-  **mVdq0 = mAbcToDq0 * **mIntfVoltage / mBase_V;
+  **mVdq0 = mAbcToDq0 * vabc / mBase_V;
 
   // update armature current
   if (mModelAsNortonSource) {
-    Matrix Iconductance = mConductanceMatrix * **mIntfVoltage;
+    MatrixFixedSize<3, 1> Iconductance = mConductanceMatrix * vabc;
     (**mIntfCurrent) = mIvbr - Iconductance;
   } else {
     (**mIntfCurrent)(0, 0) = Math::realFromVectorElement(
@@ -264,12 +265,13 @@ void EMT::Ph3::ReducedOrderSynchronGeneratorVBR::mnaCompPostStep(
   }
 
   // convert armature current into dq reference frame
-  **mIdq0 = mAbcToDq0 * **mIntfCurrent / mBase_I;
+  MatrixFixedSize<3, 1> iabc = **mIntfCurrent;
+  **mIdq0 = mAbcToDq0 * iabc / mBase_I;
 }
 
-Matrix
+MatrixFixedSize<3, 3>
 EMT::Ph3::ReducedOrderSynchronGeneratorVBR::get_parkTransformMatrix() const {
-  Matrix abcToDq0(3, 3);
+  MatrixFixedSize<3, 3> abcToDq0;
 
   abcToDq0 << 2. / 3. * cos(**mThetaMech),
       2. / 3. * cos(**mThetaMech - 2. * PI / 3.),
@@ -280,10 +282,10 @@ EMT::Ph3::ReducedOrderSynchronGeneratorVBR::get_parkTransformMatrix() const {
   return abcToDq0;
 }
 
-Matrix
+MatrixFixedSize<3, 3>
 EMT::Ph3::ReducedOrderSynchronGeneratorVBR::get_inverseParkTransformMatrix()
     const {
-  Matrix dq0ToAbc(3, 3);
+  MatrixFixedSize<3, 3> dq0ToAbc;
 
   dq0ToAbc << cos(**mThetaMech), -sin(**mThetaMech), 1.,
       cos(**mThetaMech - 2. * PI / 3.), -sin(**mThetaMech - 2. * PI / 3.), 1.,
@@ -124,9 +124,9 @@ void EMT::Ph3::Resistor::mnaCompUpdateVoltage(const Matrix &leftVector) {
 }
 
 void EMT::Ph3::Resistor::mnaCompUpdateCurrent(const Matrix &leftVector) {
-  Matrix resistanceInv = Matrix::Zero(3, 3);
-  Math::invertMatrix(**mResistance, resistanceInv);
-  **mIntfCurrent = resistanceInv * **mIntfVoltage;
+  const MatrixFixedSize<3, 3> resistance = **mResistance;
+  const MatrixFixedSize<3, 1> voltage = **mIntfVoltage;
+  **mIntfCurrent = resistance.inverse() * voltage;
   SPDLOG_LOGGER_DEBUG(mSLog, "\nCurrent: {:s}",
                       Logger::matrixToString(**mIntfCurrent));
   mSLog->flush();
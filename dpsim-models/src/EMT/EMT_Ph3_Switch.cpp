@@ -129,9 +129,9 @@ void EMT::Ph3::Switch::mnaCompUpdateVoltage(const Matrix &leftVector) {
 }
 
 void EMT::Ph3::Switch::mnaCompUpdateCurrent(const Matrix &leftVector) {
-  Matrix conductance = Matrix::Zero(3, 3);
-  (**mSwitchClosed) ? Math::invertMatrix(**mClosedResistance, conductance)
-                    : Math::invertMatrix(**mOpenResistance, conductance);
+  const MatrixFixedSize<3, 3> resistance =
+      (**mSwitchClosed) ? **mClosedResistance : **mOpenResistance;
+  const MatrixFixedSize<3, 1> voltage = **mIntfVoltage;
 
-  **mIntfCurrent = conductance * **mIntfVoltage;
+  **mIntfCurrent = resistance.inverse() * voltage;
 }
@@ -160,8 +160,6 @@ void EMT::Ph3::SynchronGeneratorVBR::mnaCompInitialize(
     mDLmq = 1. / (1. / mLmq + 1. / mLlkq1 + 1. / mLlkq2);
   else {
     mDLmq = 1. / (1. / mLmq + 1. / mLlkq1);
-    K1a = Matrix::Zero(2, 1);
-    K1 = Matrix::Zero(2, 1);
   }
 
   mLa = (mDLmq + mDLmd) / 3.;
@@ -218,19 +216,20 @@ void EMT::Ph3::SynchronGeneratorVBR::mnaCompInitialize(
   mDVq = mDVqd(0);
   mDVd = mDVqd(1);
 
-  mDVa = inverseParkTransform(mThetaMech, mDVq, mDVd, 0)(0);
-  mDVb = inverseParkTransform(mThetaMech, mDVq, mDVd, 0)(1);
-  mDVc = inverseParkTransform(mThetaMech, mDVq, mDVd, 0)(2);
+  mDVabc = inverseParkTransform(mThetaMech, mDVq, mDVd, 0);
+  mDVa = mDVabc(0);
+  mDVb = mDVabc(1);
+  mDVc = mDVabc(2);
 
-  mDVabc << mDVa, mDVb, mDVc;
+  MatrixFixedSize<3, 1> vabc = inverseParkTransform(mThetaMech, mVq, mVd, mV0);
+  mVa = vabc(0);
+  mVb = vabc(1);
+  mVc = vabc(2);
 
-  mVa = inverseParkTransform(mThetaMech, mVq, mVd, mV0)(0);
-  mVb = inverseParkTransform(mThetaMech, mVq, mVd, mV0)(1);
-  mVc = inverseParkTransform(mThetaMech, mVq, mVd, mV0)(2);
-
-  mIa = inverseParkTransform(mThetaMech, mIq, mId, mI0)(0);
-  mIb = inverseParkTransform(mThetaMech, mIq, mId, mI0)(1);
-  mIc = inverseParkTransform(mThetaMech, mIq, mId, mI0)(2);
+  MatrixFixedSize<3, 1> iabc = inverseParkTransform(mThetaMech, mIq, mId, mI0);
+  mIa = iabc(0);
+  mIb = iabc(1);
+  mIc = iabc(2);
 
   CalculateL();
 
@@ -300,10 +299,9 @@ void EMT::Ph3::SynchronGeneratorVBR::stepInPerUnit() {
 
   mIabc << mIa, mIb, mIc;
 
-  mEsh_vbr =
-      (mResistanceMat - (2 / (mTimeStep * mBase_OmElec)) * mDInductanceMat) *
-          mIabc +
-      mDVabc - mVabc;
+  MatrixFixedSize<3, 3> R_hist_vbr =
+      mResistanceMat - (2 / (mTimeStep * mBase_OmElec)) * mDInductanceMat;
+  mEsh_vbr = R_hist_vbr * mIabc + mDVabc - mVabc;
 
   CalculateL();
 
@@ -316,10 +314,10 @@ void EMT::Ph3::SynchronGeneratorVBR::stepInPerUnit() {
       mResistanceMat + (2 / (mTimeStep * mBase_OmElec)) * mDInductanceMat + K;
   E_eq_vbr = mEsh_vbr + E_r_vbr;
 
-  MatrixFixedSize<3, 3> R_eq_vbr_mBase_Z = R_eq_vbr * mBase_Z;
-
-  mConductanceMat = R_eq_vbr_mBase_Z.inverse();
-  mISourceEq = R_eq_vbr.inverse() * E_eq_vbr * mBase_I;
+  // Fixed-size inverse in closed form, reused in the post-step
+  R_eq_vbr_inv = R_eq_vbr.inverse();
+  mConductanceMat = R_eq_vbr_inv / mBase_Z;
+  mISourceEq = R_eq_vbr_inv * E_eq_vbr * mBase_I;
 }
 
 void EMT::Ph3::SynchronGeneratorVBR::mnaCompPostStep(
@@ -340,9 +338,10 @@ void EMT::Ph3::SynchronGeneratorVBR::mnaCompPostStep(
   // ################ Update machine stator and rotor variables ############################
   mVabc << mVa, mVb, mVc;
 
-  mVq = parkTransform(mThetaMech, mVa, mVb, mVc)(0);
-  mVd = parkTransform(mThetaMech, mVa, mVb, mVc)(1);
-  mV0 = parkTransform(mThetaMech, mVa, mVb, mVc)(2);
+  MatrixFixedSize<3, 1> vdq0 = parkTransform(mThetaMech, mVa, mVb, mVc);
+  mVq = vdq0(0);
+  mVd = vdq0(1);
+  mV0 = vdq0(2);
 
   if (mHasExciter) {
     // Get exciter output voltage
@@ -350,7 +349,7 @@ void EMT::Ph3::SynchronGeneratorVBR::mnaCompPostStep(
     // to the synchronous generator pu system
     mVfd = (mRfd / mLmd) * mExciter->step(mVd, mVq, mTimeStep);
   }
-  mIabc = R_eq_vbr.inverse() * (mVabc - E_eq_vbr);
+  mIabc = R_eq_vbr_inv * (mVabc - E_eq_vbr);
 
   mIa = mIabc(0);
   mIb = mIabc(1);
@@ -359,9 +358,10 @@ void EMT::Ph3::SynchronGeneratorVBR::mnaCompPostStep(
   mIq_hist = mIq;
   mId_hist = mId;
 
-  mIq = parkTransform(mThetaMech, mIa, mIb, mIc)(0);
-  mId = parkTransform(mThetaMech, mIa, mIb, mIc)(1);
-  mI0 = parkTransform(mThetaMech, mIa, mIb, mIc)(2);
+  MatrixFixedSize<3, 1> idq0 = parkTransform(mThetaMech, mIa, mIb, mIc);
+  mIq = idq0(0);
+  mId = idq0(1);
+  mI0 = idq0(2);
 
   // Calculate rotor flux likanges
   if (mNumDampingWindings == 2) {
@@ -400,10 +400,10 @@ void EMT::Ph3::SynchronGeneratorVBR::mnaCompPostStep(
   mDVq = mDVqd(0);
   mDVd = mDVqd(1);
 
-  mDVa = inverseParkTransform(mThetaMech, mDVq, mDVd, 0)(0);
-  mDVb = inverseParkTransform(mThetaMech, mDVq, mDVd, 0)(1);
-  mDVc = inverseParkTransform(mThetaMech, mDVq, mDVd, 0)(2);
-  mDVabc << mDVa, mDVb, mDVc;
+  mDVabc = inverseParkTransform(mThetaMech, mDVq, mDVd, 0);
+  mDVa = mDVabc(0);
+  mDVb = mDVabc(1);
+  mDVc = mDVabc(2);
 
   **mIntfVoltage = mVabc * mBase_V;
   **mIntfCurrent = mIabc * mBase_I;
@@ -465,7 +465,7 @@ void EMT::Ph3::SynchronGeneratorVBR::CalculateAuxiliarConstants(Real dt) {
     Ea << 2 - dt * b11, -dt * b12, -dt * b21, 2 - dt * b22;
     E1b << dt * b13, dt * b23;
 
-    Matrix Ea_inv = Ea.inverse();
+    MatrixFixedSize<2, 2> Ea_inv = Ea.inverse();
 
     E1 = Ea_inv * E1b;
 
@@ -481,15 +481,17 @@ void EMT::Ph3::SynchronGeneratorVBR::CalculateAuxiliarConstants(Real dt) {
 
   Fa << 2 - dt * b31, -dt * b32, -dt * b41, 2 - dt * b42;
 
+  MatrixFixedSize<2, 2> Fa_inv = Fa.inverse();
+
   F1b << dt * b33, dt * b43;
-  F1 = Fa.inverse() * F1b;
+  F1 = Fa_inv * F1b;
 
   F2b << 2 + dt * b31, dt * b32, dt * b41, 2 + dt * b42;
 
-  F2 = Fa.inverse() * F2b;
+  F2 = Fa_inv * F2b;
 
   F3b << 2 * dt, 0;
-  F3 = Fa.inverse() * F3b;
+  F3 = Fa_inv * F3b;
 
   C26 << 0, c26;
 }
@@ -510,16 +512,16 @@ void EMT::Ph3::SynchronGeneratorVBR::CalculateAuxiliarVariables() {
     c13_omega = **mOmMech * mDLmd / mLlfd;
     c14_omega = **mOmMech * mDLmd / mLlkd;
 
-    K1a << c11, c21_omega;
+    K1a_1d << c11, c21_omega;
     K1b << c15, 0;
-    K1 = K1a * E1_1d + K1b;
+    K1 = K1a_1d * E1_1d + K1b;
   }
 
   K2a << c13_omega, c14_omega, c23, c24;
   K2b << 0, c25;
   K2 = K2a * F1 + K2b;
 
-  K << K1, K2, Matrix::Zero(2, 1), 0, 0, 0;
+  K << K1, K2, MatrixFixedSize<2, 1>::Zero(), 0, 0, 0;
 
   mKrs_teta << 2. / 3. * cos(mThetaMech),
       2. / 3. * cos(mThetaMech - 2. * M_PI / 3.),
@@ -537,18 +539,19 @@ void EMT::Ph3::SynchronGeneratorVBR::CalculateAuxiliarVariables() {
     h_qdr = K1a * E2 * mPsikq1kq2 + K1a * E1 * mIq + K2a * F2 * mPsifdkd +
             K2a * F1 * mId + (K2a * F3 + C26) * mVfd;
   else
-    h_qdr = K1a * E2_1d * mPsikq1 + K1a * E1_1d * mIq + K2a * F2 * mPsifdkd +
-            K2a * F1 * mId + (K2a * F3 + C26) * mVfd;
+    h_qdr = K1a_1d * E2_1d * mPsikq1 + K1a_1d * E1_1d * mIq +
+            K2a * F2 * mPsifdkd + K2a * F1 * mId + (K2a * F3 + C26) * mVfd;
 
   H_qdr << h_qdr, 0;
 
   E_r_vbr = mKrs_teta_inv * H_qdr;
 }
 
-Matrix EMT::Ph3::SynchronGeneratorVBR::parkTransform(Real theta, Real a, Real b,
-                                                     Real c) {
+MatrixFixedSize<3, 1>
+EMT::Ph3::SynchronGeneratorVBR::parkTransform(Real theta, Real a, Real b,
+                                              Real c) {
 
-  Matrix dq0vector(3, 1);
+  MatrixFixedSize<3, 1> dq0vector;
 
   Real q, d, zero;
 
@@ -563,10 +566,11 @@ Matrix EMT::Ph3::SynchronGeneratorVBR::parkTransform(Real theta, Real a, Real b,
   return dq0vector;
 }
 
-Matrix EMT::Ph3::SynchronGeneratorVBR::inverseParkTransform(Real theta, Real q,
-                                                            Real d, Real zero) {
+MatrixFixedSize<3, 1>
+EMT::Ph3::SynchronGeneratorVBR::inverseParkTransform(Real theta, Real q, Real d,
+                                                     Real zero) {
 
-  Matrix abcVector(3, 1);
+  MatrixFixedSize<3, 1> abcVector;
 
   Real a, b, c;
 
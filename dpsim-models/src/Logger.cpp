@@ -8,6 +8,7 @@
 
 #include <iomanip>
 #include <memory>
+#include <mutex>
 
 #include <spdlog/sinks/null_sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
@@ -78,7 +79,15 @@ String Logger::prefix() {
   return p ? p : "";
 }
 
+namespace {
+/// Log directory of the current thread, overrides CPS_LOG_DIR if set
+thread_local String threadLogDir;
+} // namespace
+
 String Logger::logDir() {
+  if (!threadLogDir.empty())
+    return threadLogDir;
+
   char *p = getenv("CPS_LOG_DIR");
 
   return p ? p : "logs";
@@ -94,6 +103,8 @@ void Logger::setLogDir(String path) {
 #endif
 }
 
+void Logger::setThreadLogDir(String path) { threadLogDir = path; }
+
 String Logger::getCSVColumnNames(std::vector<String> names) {
   std::stringstream ss;
   ss << std::right << std::setw(14) << "time";
@@ -138,6 +149,12 @@ String Logger::getCSVLineFromData(Real time, const MatrixComp &data) {
 
 Logger::Log Logger::get(const std::string &name, Level filelevel,
                         Level clilevel) {
+  // Components may be created concurrently, e.g. by the scenarios of a
+  // BatchSimulation or the CIM reader. Without the lock, two threads can
+  // both miss the logger and the second registration throws.
+  static std::mutex mutex;
+  std::lock_guard<std::mutex> lock(mutex);
+
   Logger::Log logger = spdlog::get(name);
 
   if (!logger) {
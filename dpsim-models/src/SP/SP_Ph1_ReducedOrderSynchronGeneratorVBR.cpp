@@ -36,9 +36,9 @@ void SP::Ph1::ReducedOrderSynchronGeneratorVBR::initializeResistanceMatrix() {
 }
 
 void SP::Ph1::ReducedOrderSynchronGeneratorVBR::calculateResistanceMatrix() {
-  Matrix resistanceMatrix = mDqToComplexA * mResistanceMatrixDq * mComplexAToDq;
-  resistanceMatrix = resistanceMatrix * mBase_Z;
-  mConductanceMatrix = resistanceMatrix.inverse();
+  conductanceMatrix(mDqToComplexA(0, 0), mDqToComplexA(1, 0), mA, mB, mBase_Z,
+                    mConductanceMatrix(0, 0), mConductanceMatrix(0, 1),
+                    mConductanceMatrix(1, 0), mConductanceMatrix(1, 1));
 }
 
 void SP::Ph1::ReducedOrderSynchronGeneratorVBR::mnaCompInitialize(
@@ -130,9 +130,12 @@ void SP::Ph1::ReducedOrderSynchronGeneratorVBR::mnaCompPostStep(
       Math::complexFromVectorElement(leftVector, matrixNodeIndex(0));
 
   // convert armature voltage into dq reference frame
-  Matrix Vabc = Matrix::Zero(2, 1);
-  Vabc << (**mIntfVoltage)(0, 0).real(), (**mIntfVoltage)(0, 0).imag();
-  **mVdq = mComplexAToDq * Vabc / mBase_V_RMS;
+  Real vd, vq;
+  complexAToDq(mDqToComplexA(0, 0), mDqToComplexA(1, 0),
+               (**mIntfVoltage)(0, 0).real(), (**mIntfVoltage)(0, 0).imag(), vd,
+               vq);
+  (**mVdq)(0, 0) = vd / mBase_V_RMS;
+  (**mVdq)(1, 0) = vq / mBase_V_RMS;
 
   // update armature current
   if (mModelAsNortonSource) {
@@ -148,9 +151,12 @@ void SP::Ph1::ReducedOrderSynchronGeneratorVBR::mnaCompPostStep(
   }
 
   // convert armature current into dq reference frame
-  Matrix Iabc = Matrix::Zero(2, 1);
-  Iabc << (**mIntfCurrent)(0, 0).real(), (**mIntfCurrent)(0, 0).imag();
-  **mIdq = mComplexAToDq * Iabc / mBase_I_RMS;
+  Real id, iq;
+  complexAToDq(mDqToComplexA(0, 0), mDqToComplexA(1, 0),
+               (**mIntfCurrent)(0, 0).real(), (**mIntfCurrent)(0, 0).imag(), id,
+               iq);
+  (**mIdq)(0, 0) = id / mBase_I_RMS;
+  (**mIdq)(1, 0) = iq / mBase_I_RMS;
 }
 
 Matrix
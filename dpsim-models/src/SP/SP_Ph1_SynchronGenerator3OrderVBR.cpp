@@ -61,6 +61,10 @@ void SP::Ph1::SynchronGenerator3OrderVBR::stepInPerUnit() {
                   mDq_t * mEf_prev + mDq_t * (**mEf);
 
   // convert Edq_t into the abc reference frame
-  mEh_vbr = mDqToComplexA * mEh_vbr;
-  mEvbr = Complex(mEh_vbr(0, 0), mEh_vbr(1, 0)) * mBase_V_RMS;
+  Real ehRe, ehIm;
+  dqToComplexA(mDqToComplexA(0, 0), mDqToComplexA(1, 0), mEh_vbr(0, 0),
+               mEh_vbr(1, 0), ehRe, ehIm);
+  mEh_vbr(0, 0) = ehRe;
+  mEh_vbr(1, 0) = ehIm;
+  mEvbr = Complex(ehRe, ehIm) * mBase_V_RMS;
 }
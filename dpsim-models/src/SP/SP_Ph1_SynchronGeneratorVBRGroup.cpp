@@ -0,0 +1,283 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <cmath>
+
+#include <dpsim-models/SP/SP_Ph1_SynchronGeneratorVBRGroup.h>
+
+using namespace CPS;
+
+using Group = SP::Ph1::SynchronGeneratorVBRGroup;
+
+Group::SynchronGeneratorVBRGroup(
+    const String &name,
+    const std::vector<std::shared_ptr<ReducedOrderSynchronGeneratorVBR>>
+        &members,
+    Attribute<Matrix>::Ptr leftVector)
+    : mName(name), mMembers(members), mLeftVector(leftVector) {
+
+  if (mMembers.empty())
+    throw SystemError("Generator group " + mName + " has no members");
+  mOrder = mMembers[0]->mSGOrder;
+  mTimeStep = mMembers[0]->mTimeStep;
+
+  for (auto &gen : mMembers) {
+    if (!isSupported(gen) || gen->mSGOrder != mOrder)
+      throw SystemError("Generator " + gen->name() +
+                        " does not match the model type of group " + mName);
+    mMemberSet.insert(gen.get());
+
+    if (auto gen3 =
+            std::dynamic_pointer_cast<SynchronGenerator3OrderVBR>(gen)) {
+      mEdq_t.push_back(gen3->mEdq_t);
+      mEh_vbr.push_back(&gen3->mEh_vbr);
+    } else {
+      auto gen4 = std::dynamic_pointer_cast<SynchronGenerator4OrderVBR>(gen);
+      mEdq_t.push_back(gen4->mEdq_t);
+      mEh_vbr.push_back(&gen4->mEh_vbr);
+    }
+
+    mH.push_back(gen->mH);
+    mLd_t.push_back(gen->mLd_t);
+    mLq_t.push_back(gen->mLq_t);
+    mAd_t.push_back(gen->mAd_t);
+    mBd_t.push_back(gen->mBd_t);
+    mAq_t.push_back(gen->mAq_t);
+    mBq_t.push_back(gen->mBq_t);
+    mDq_t.push_back(gen->mDq_t);
+    mA.push_back(gen->mA);
+    mB.push_back(gen->mB);
+    mBase_Z.push_back(gen->mBase_Z);
+    mBase_V_RMS.push_back(gen->mBase_V_RMS);
+    mBase_I_RMS.push_back(gen->mBase_I_RMS);
+    mBase_OmMech.push_back(gen->mBase_OmMech);
+    mNodeIndex.push_back(gen->matrixNodeIndex(0, 0));
+    mVirtualNodeIndex.push_back(
+        gen->mModelAsNortonSource ? 0
+                                  : gen->mVirtualNodes[1]->matrixNodeIndex());
+
+    // The group writes the transformation matrices of the members with the
+    // comma initializer in every step, which requires them to be 2x2
+    gen->mDqToComplexA.resize(2, 2);
+    gen->mComplexAToDq.resize(2, 2);
+  }
+
+  for (auto array :
+       {&mVd, &mVq, &mId, &mIq, &mEd_t, &mEq_t, &mEf, &mEf_prev,
+        &mMechTorque_prev, &mElecTorque, &mOmMech, &mThetaMech, &mDelta,
+        &mCosTheta, &mSinTheta, &mG00, &mG01, &mG10, &mG11, &mEhD, &mEhQ,
+        &mEhRe, &mEhIm, &mVRe, &mVIm, &mIRe, &mIIm})
+    array->resize(mMembers.size());
+
+  mMnaTasks.push_back(std::make_shared<MnaPreStep>(*this));
+  mMnaTasks.push_back(std::make_shared<MnaPostStep>(*this));
+}
+
+Bool Group::isSupported(const MNAInterface::Ptr &comp) {
+  return std::dynamic_pointer_cast<SynchronGenerator3OrderVBR>(comp) ||
+         std::dynamic_pointer_cast<SynchronGenerator4OrderVBR>(comp);
+}
+
+Group::List Group::createGroups(const String &name,
+                                const MNAInterface::List &components,
+                                Attribute<Matrix>::Ptr leftVector) {
+  std::vector<std::shared_ptr<ReducedOrderSynchronGeneratorVBR>> gens3, gens4;
+  for (auto &comp : components) {
+    if (auto gen = std::dynamic_pointer_cast<SynchronGenerator3OrderVBR>(comp))
+      gens3.push_back(gen);
+    else if (auto gen =
+                 std::dynamic_pointer_cast<SynchronGenerator4OrderVBR>(comp))
+      gens4.push_back(gen);
+  }
+
+  List groups;
+  if (gens3.size() > 1)
+    groups.push_back(std::make_shared<SynchronGeneratorVBRGroup>(
+        name + "_SG3OrderVBR", gens3, leftVector));
+  if (gens4.size() > 1)
+    groups.push_back(std::make_shared<SynchronGeneratorVBRGroup>(
+        name + "_SG4OrderVBR", gens4, leftVector));
+  return groups;
+}
+
+Bool Group::contains(const MNAInterface::Ptr &comp) const {
+  return mMemberSet.count(comp.get()) > 0;
+}
+
+void Group::gatherStates() {
+  for (std::size_t i = 0; i < mMembers.size(); ++i) {
+    auto &gen = *mMembers[i];
+    mVd[i] = (**gen.mVdq)(0, 0);
+    mVq[i] = (**gen.mVdq)(1, 0);
+    mId[i] = (**gen.mIdq)(0, 0);
+    mIq[i] = (**gen.mIdq)(1, 0);
+    mEd_t[i] = (**mEdq_t[i])(0, 0);
+    mEq_t[i] = (**mEdq_t[i])(1, 0);
+    mEf[i] = **gen.mEf;
+    mEf_prev[i] = gen.mEf_prev;
+    mMechTorque_prev[i] = gen.mMechTorque_prev;
+    mOmMech[i] = **gen.mOmMech;
+    mThetaMech[i] = **gen.mThetaMech;
+    mDelta[i] = **gen.mDelta;
+  }
+}
+
+void Group::mnaPreStep(Real time, Int timeStepCount) {
+  const std::size_t n = mMembers.size();
+
+  // update controller variables, the controllers are separate objects
+  for (std::size_t i = 0; i < n; ++i) {
+    auto &gen = *mMembers[i];
+    gen.mSimTime = time;
+    if (gen.mHasExciter) {
+      gen.mEf_prev = **gen.mEf;
+      **gen.mEf =
+          gen.mExciter->step((**gen.mVdq)(0, 0), (**gen.mVdq)(1, 0), mTimeStep);
+    }
+    if (gen.mHasTurbineGovernor) {
+      gen.mMechTorque_prev = **gen.mMechTorque;
+      **gen.mMechTorque = gen.mTurbineGovernor->step(**gen.mOmMech, mTimeStep);
+    }
+  }
+  gatherStates();
+
+  // calculate mechanical variables at t=k+1 with forward euler
+  for (std::size_t i = 0; i < n; ++i) {
+    mElecTorque[i] = mVd[i] * mId[i] + mVq[i] * mIq[i];
+    mOmMech[i] =
+        mOmMech[i] + mTimeStep * (1. / (2. * mH[i]) *
+                                  (mMechTorque_prev[i] - mElecTorque[i]));
+    mThetaMech[i] = mThetaMech[i] + mTimeStep * (mOmMech[i] * mBase_OmMech[i]);
+    mDelta[i] = mDelta[i] + mTimeStep * (mOmMech[i] - 1.) * mBase_OmMech[i];
+  }
+
+  // calculate Edq_t at t=k
+  if (time > 0.0) {
+    if (mOrder == SGOrder::SG4Order) {
+      for (std::size_t i = 0; i < n; ++i)
+        mEd_t[i] = -mIq[i] * mLq_t[i] + mVd[i];
+    }
+    for (std::size_t i = 0; i < n; ++i)
+      mEq_t[i] = mId[i] * mLd_t[i] + mVq[i];
+  }
+
+  // transformation and resistance matrix at t=k+1
+  for (std::size_t i = 0; i < n; ++i) {
+    Real theta = mThetaMech[i] - mBase_OmMech[i] * time;
+    mCosTheta[i] = cos(theta);
+    mSinTheta[i] = sin(theta);
+  }
+  for (std::size_t i = 0; i < n; ++i)
+    ReducedOrderSynchronGeneratorVBR::conductanceMatrix(
+        mCosTheta[i], mSinTheta[i], mA[i], mB[i], mBase_Z[i], mG00[i], mG01[i],
+        mG10[i], mG11[i]);
+
+  // VBR history voltage in the abc reference frame
+  for (std::size_t i = 0; i < n; ++i) {
+    mEhD[i] = mOrder == SGOrder::SG4Order
+                  ? mAd_t[i] * mIq[i] + mBd_t[i] * mEd_t[i]
+                  : 0.0;
+    mEhQ[i] = mAq_t[i] * mId[i] + mBq_t[i] * mEq_t[i] +
+              mDq_t[i] * mEf_prev[i] + mDq_t[i] * mEf[i];
+    ReducedOrderSynchronGeneratorVBR::dqToComplexA(
+        mCosTheta[i], mSinTheta[i], mEhD[i], mEhQ[i], mEhRe[i], mEhIm[i]);
+  }
+
+  // write back the states and stamp the right side vectors
+  for (std::size_t i = 0; i < n; ++i) {
+    auto &gen = *mMembers[i];
+    **gen.mElecTorque = mElecTorque[i];
+    **gen.mOmMech = mOmMech[i];
+    **gen.mThetaMech = mThetaMech[i];
+    **gen.mDelta = mDelta[i];
+    (**mEdq_t[i])(0, 0) = mEd_t[i];
+    (**mEdq_t[i])(1, 0) = mEq_t[i];
+
+    gen.mDqToComplexA << mCosTheta[i], -mSinTheta[i], mSinTheta[i],
+        mCosTheta[i];
+    gen.mComplexAToDq << mCosTheta[i], mSinTheta[i], -mSinTheta[i],
+        mCosTheta[i];
+    gen.mConductanceMatrix << mG00[i], mG01[i], mG10[i], mG11[i];
+    (*mEh_vbr[i])(0, 0) = mEhRe[i];
+    (*mEh_vbr[i])(1, 0) = mEhIm[i];
+    gen.mEvbr = Complex(mEhRe[i], mEhIm[i]) * mBase_V_RMS[i];
+
+    // The members only stamp these entries, so they are overwritten instead
+    // of clearing the whole vector
+    if (gen.mModelAsNortonSource) {
+      gen.mIvbr =
+          Complex(mG00[i] * gen.mEvbr.real() + mG01[i] * gen.mEvbr.imag(),
+                  mG10[i] * gen.mEvbr.real() + mG11[i] * gen.mEvbr.imag());
+      Math::setVectorElement(**gen.mRightVector, mNodeIndex[i], gen.mIvbr);
+    } else {
+      Math::setVectorElement(**gen.mRightVector, mVirtualNodeIndex[i],
+                             gen.mEvbr);
+    }
+  }
+}
+
+void Group::mnaPostStep(const Matrix &leftVector) {
+  const std::size_t n = mMembers.size();
+
+  // update armature voltage and current
+  for (std::size_t i = 0; i < n; ++i) {
+    auto &gen = *mMembers[i];
+    Complex voltage = Math::complexFromVectorElement(leftVector, mNodeIndex[i]);
+    Complex current;
+    if (gen.mModelAsNortonSource) {
+      current = gen.mIvbr - Complex(mG00[i] * voltage.real() +
+                                        mG01[i] * voltage.imag(),
+                                    mG10[i] * voltage.real() +
+                                        mG11[i] * voltage.imag());
+    } else {
+      current =
+          Math::complexFromVectorElement(leftVector, mVirtualNodeIndex[i]);
+    }
+    (**gen.mIntfVoltage)(0, 0) = voltage;
+    (**gen.mIntfCurrent)(0, 0) = current;
+    mVRe[i] = voltage.real();
+    mVIm[i] = voltage.imag();
+    mIRe[i] = current.real();
+    mIIm[i] = current.imag();
+  }
+
+  // convert armature voltage and current into dq reference frame
+  for (std::size_t i = 0; i < n; ++i) {
+    ReducedOrderSynchronGeneratorVBR::complexAToDq(
+        mCosTheta[i], mSinTheta[i], mVRe[i], mVIm[i], mVd[i], mVq[i]);
+    ReducedOrderSynchronGeneratorVBR::complexAToDq(
+        mCosTheta[i], mSinTheta[i], mIRe[i], mIIm[i], mId[i], mIq[i]);
+    mVd[i] = mVd[i] / mBase_V_RMS[i];
+    mVq[i] = mVq[i] / mBase_V_RMS[i];
+    mId[i] = mId[i] / mBase_I_RMS[i];
+    mIq[i] = mIq[i] / mBase_I_RMS[i];
+  }
+
+  for (std::size_t i = 0; i < n; ++i) {
+    auto &gen = *mMembers[i];
+    (**gen.mVdq)(0, 0) = mVd[i];
+    (**gen.mVdq)(1, 0) = mVq[i];
+    (**gen.mIdq)(0, 0) = mId[i];
+    (**gen.mIdq)(1, 0) = mIq[i];
+  }
+}
+
+Group::MnaPreStep::MnaPreStep(SynchronGeneratorVBRGroup &group)
+    : Task(group.mName + ".MnaPreStep"), mGroup(group) {
+  for (auto &gen : mGroup.mMembers)
+    static_cast<MNAInterface &>(*gen).mnaAddPreStepDependencies(
+        mPrevStepDependencies, mAttributeDependencies, mModifiedAttributes);
+}
+
+Group::MnaPostStep::MnaPostStep(SynchronGeneratorVBRGroup &group)
+    : Task(group.mName + ".MnaPostStep"), mGroup(group) {
+  for (auto &gen : mGroup.mMembers)
+    static_cast<MNAInterface &>(*gen).mnaAddPostStepDependencies(
+        mPrevStepDependencies, mAttributeDependencies, mModifiedAttributes,
+        mGroup.mLeftVector);
+}
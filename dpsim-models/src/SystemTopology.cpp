@@ -16,6 +16,46 @@
 
 using namespace CPS;
 
+namespace {
+/// Adds the object at the given list position to the index, keeping the
+/// first position of each name like a linear search
+template <typename Index, typename List>
+void indexObject(Index &index, const List &list, UInt pos) {
+  if (!list[pos])
+    return;
+  auto it = index.positions.emplace(**list[pos]->mName, pos).first;
+  if (pos < it->second)
+    it->second = pos;
+}
+
+template <typename Index, typename List>
+void rebuildIndex(Index &index, const List &list) {
+  index.positions.clear();
+  index.positions.reserve(list.size());
+  for (UInt pos = 0; pos < list.size(); ++pos)
+    indexObject(index, list, pos);
+}
+
+template <typename Index, typename List>
+typename List::value_type findByName(Index &index, const List &list,
+                                     const String &name) {
+  auto it = index.positions.find(name);
+  if (it != index.positions.end() && it->second < list.size() &&
+      list[it->second] && **list[it->second]->mName == name)
+    return list[it->second];
+
+  // The public lists may have been modified without the add methods, so the
+  // index is only rebuilt if a linear search finds the name after all
+  for (auto &obj : list) {
+    if (obj && **obj->mName == name) {
+      rebuildIndex(index, list);
+      return obj;
+    }
+  }
+  return nullptr;
+}
+} // namespace
+
 Matrix SystemTopology::initFrequency(Real frequency) const {
   Matrix frequencies(1, 1);
   frequencies << frequency;
@@ -29,6 +69,7 @@ void SystemTopology::addNode(TopologicalNode::Ptr topNode) {
     nodeReal->initialize(mFrequencies);
 
   mNodes.push_back(topNode);
+  indexObject(mNodeIndex, mNodes, static_cast<UInt>(mNodes.size() - 1));
 }
 
 void SystemTopology::addNodeAt(TopologicalNode::Ptr topNode, UInt index) {
@@ -40,7 +81,14 @@ void SystemTopology::addNodeAt(TopologicalNode::Ptr topNode, UInt index) {
   if (index > mNodes.capacity())
     mNodes.resize(index + 1);
 
+  // Drop the name of a replaced node from the index
+  if (mNodes[index]) {
+    auto it = mNodeIndex.positions.find(**mNodes[index]->mName);
+    if (it != mNodeIndex.positions.end() && it->second == index)
+      mNodeIndex.positions.erase(it);
+  }
   mNodes[index] = topNode;
+  indexObject(mNodeIndex, mNodes, index);
 }
 
 void SystemTopology::addNodes(const TopologicalNode::List &topNodes) {
@@ -57,6 +105,8 @@ void SystemTopology::addComponent(IdentifiedObject::Ptr component) {
     powerCompReal->initialize(mFrequencies);
 
   mComponents.push_back(component);
+  indexObject(mComponentIndex, mComponents,
+              static_cast<UInt>(mComponents.size() - 1));
 }
 
 template <typename VarType>
@@ -146,16 +196,15 @@ typename std::shared_ptr<Type> SystemTopology::node(UInt index) {
 
 template <typename Type>
 typename std::shared_ptr<Type> SystemTopology::node(std::string_view name) {
-  for (auto topoNode : mNodes) {
-    if (topoNode->name() == name) {
-      auto node = std::dynamic_pointer_cast<Type>(topoNode);
-      if (node)
-        return node;
-      else
-        return nullptr;
-    }
-  }
-  return nullptr;
+  return std::dynamic_pointer_cast<Type>(findNode(String(name)));
+}
+
+TopologicalNode::Ptr SystemTopology::findNode(const String &name) {
+  return findByName(mNodeIndex, mNodes, name);
+}
+
+IdentifiedObject::Ptr SystemTopology::findComponent(const String &name) {
+  return findByName(mComponentIndex, mComponents, name);
 }
 
 std::map<String, String, std::less<>> SystemTopology::listIdObjects() const {
@@ -244,11 +293,16 @@ void SystemTopology::reset() {
 }
 
 void SystemTopology::removeComponent(const String &name) {
-  for (auto it = mComponents.begin(); it != mComponents.end(); ++it) {
-    if ((*it)->name() == name) {
-      mComponents.erase(it);
-    }
-  }
+  if (!findComponent(name))
+    return;
+
+  mComponents.erase(std::remove_if(mComponents.begin(), mComponents.end(),
+                                   [&name](const IdentifiedObject::Ptr &comp) {
+                                     return **comp->mName == name;
+                                   }),
+                    mComponents.end());
+  // Positions behind the removed components have changed
+  rebuildIndex(mComponentIndex, mComponents);
 }
 
 template <typename VarType>
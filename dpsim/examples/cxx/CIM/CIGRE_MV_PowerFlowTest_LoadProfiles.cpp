@@ -141,6 +141,10 @@ int main(int argc, char **argv) {
   sim.setSolverType(Solver::Type::NRP);
   sim.setSolverAndComponentBehaviour(Solver::Behaviour::Simulation);
   sim.doInitFromNodesAndTerminals(true);
+  // Start each time step from the previous solution and keep it
+  // if the load profiles did not change
+  sim.doPowerflowWarmStart(true);
+  sim.setPowerflowSkipTolerance(1e-9);
   sim.addLogger(logger);
 
   sim.run();
@@ -0,0 +1,186 @@
+/* Copyright 2017-2021 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <list>
+
+#include <DPsim.h>
+#include <dpsim/SequentialScheduler.h>
+#include <dpsim/ThreadLevelScheduler.h>
+#include <dpsim/ThreadListScheduler.h>
+#include <dpsim/ThreadWorkStealingScheduler.h>
+
+using namespace DPsim;
+using namespace CPS;
+
+// Compares the step times of the available schedulers on multiple copies
+// of the WSCC 9-bus system. The copies are either connected by decoupling
+// lines, which results in one solver per copy, or by pi-lines forming a
+// single large system.
+
+void multiply_decoupled(SystemTopology &sys, int copies, Real resistance,
+                        Real inductance, Real capacitance) {
+  sys.multiply(copies);
+  std::vector<String> nodes = {"BUS5", "BUS8", "BUS6"};
+
+  for (auto orig_node : nodes) {
+    std::vector<String> nodeNames{orig_node};
+    for (int i = 2; i <= copies + 1; i++) {
+      nodeNames.push_back(orig_node + "_" + std::to_string(i));
+    }
+    nodeNames.push_back(orig_node);
+    int nlines = copies == 1 ? 1 : copies + 1;
+
+    for (int i = 0; i < nlines; i++) {
+      auto line = Signal::DecouplingLine::make(
+          "dline_" + orig_node + "_" + std::to_string(i),
+          sys.node<DP::SimNode>(nodeNames[i]),
+          sys.node<DP::SimNode>(nodeNames[i + 1]), resistance, inductance,
+          capacitance, Logger::Level::off);
+      sys.addComponent(line);
+      sys.addComponents(line->getLineComponents());
+    }
+  }
+}
+
+void multiply_connected(SystemTopology &sys, int copies, Real resistance,
+                        Real inductance, Real capacitance) {
+  sys.multiply(copies);
+  int counter = 0;
+  std::vector<String> nodes = {"BUS5", "BUS8", "BUS6"};
+
+  for (auto orig_node : nodes) {
+    std::vector<String> nodeNames{orig_node};
+    for (int i = 2; i <= copies + 1; i++) {
+      nodeNames.push_back(orig_node + "_" + std::to_string(i));
+    }
+    nodeNames.push_back(orig_node);
+    int nlines = copies == 1 ? 1 : copies + 1;
+
+    for (int i = 0; i < nlines; i++) {
+      auto line = DP::Ph1::PiLine::make("line_" + std::to_string(counter),
+                                        Logger::Level::off);
+      line->setParameters(resistance, inductance, capacitance);
+      line->connect({sys.node<DP::SimNode>(nodeNames[i]),
+                     sys.node<DP::SimNode>(nodeNames[i + 1])});
+      sys.addComponent(line);
+      counter += 1;
+    }
+  }
+}
+
+std::shared_ptr<Scheduler> createScheduler(const String &name, Int threads) {
+  if (name == "sequential")
+    return std::make_shared<SequentialScheduler>();
+  if (name == "thread_level")
+    return std::make_shared<ThreadLevelScheduler>(threads);
+  if (name == "thread_list")
+    return std::make_shared<ThreadListScheduler>(threads);
+#ifdef WITH_OPENMP
+  if (name == "openmp_level")
+    return std::make_shared<OpenMPLevelScheduler>(threads);
+#endif
+  if (name == "work_stealing")
+    return std::make_shared<ThreadWorkStealingScheduler>(threads);
+  throw SystemError("Unknown scheduler " + name);
+}
+
+void simulate(std::list<fs::path> filenames, const String &schedulerName,
+              Int copies, Int threads, Bool decoupled, Real timeStep,
+              Real finalTime) {
+  String simName = "WSCC_9bus_schedulers_" + schedulerName + "_" +
+                   std::to_string(copies) + "_" + std::to_string(threads);
+  Logger::setLogDir("logs/" + simName);
+
+  CIM::Reader reader(simName, Logger::Level::off, Logger::Level::off);
+  SystemTopology sys =
+      reader.loadCIM(60, filenames, Domain::DP, PhaseType::Single,
+                     CPS::GeneratorType::IdealVoltageSource);
+
+  if (copies > 0) {
+    if (decoupled)
+      multiply_decoupled(sys, copies, 12.5, 0.16, 1e-6);
+    else
+      multiply_connected(sys, copies, 12.5, 0.16, 1e-6);
+  }
+
+  Simulation sim(simName, Logger::Level::off);
+  sim.setSystem(sys);
+  sim.setTimeStep(timeStep);
+  sim.setFinalTime(finalTime);
+  sim.setDomain(Domain::DP);
+  sim.setScheduler(createScheduler(schedulerName, threads));
+
+  sim.run();
+
+  auto stepTimes = sim.stepTimes();
+  if (stepTimes.empty())
+    return;
+
+  Real sum = 0;
+  for (auto time : stepTimes)
+    sum += time;
+  std::sort(stepTimes.begin(), stepTimes.end());
+  Real median = stepTimes[stepTimes.size() / 2];
+  Real p99 = stepTimes[static_cast<size_t>(0.99 * (stepTimes.size() - 1))];
+
+  std::cout << std::left << std::setw(16) << schedulerName << std::right
+            << std::setw(8) << copies << std::setw(8) << threads
+            << std::setw(14) << sum / stepTimes.size() * 1e6 << std::setw(14)
+            << median * 1e6 << std::setw(14) << p99 * 1e6 << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+  CommandLineArgs args(argc, argv);
+
+  std::list<fs::path> filenames;
+  filenames = DPsim::Utils::findFiles(
+      {"WSCC-09_RX_DI.xml", "WSCC-09_RX_EQ.xml", "WSCC-09_RX_SV.xml",
+       "WSCC-09_RX_TP.xml"},
+      "build/_deps/cim-data-src/WSCC-09/WSCC-09_RX", "CIMPATH");
+
+  Int numCopies = 10;
+  Int numThreads = 4;
+  Bool decoupled = true;
+  Real timeStep = 0.0001;
+  Real finalTime = 0.1;
+
+  if (args.options.find("copies") != args.options.end())
+    numCopies = args.getOptionInt("copies");
+  if (args.options.find("threads") != args.options.end())
+    numThreads = args.getOptionInt("threads");
+  if (args.options.find("decoupled") != args.options.end())
+    decoupled = args.getOptionBool("decoupled");
+  if (args.options.find("timestep") != args.options.end())
+    timeStep = args.getOptionReal("timestep");
+  if (args.options.find("duration") != args.options.end())
+    finalTime = args.getOptionReal("duration");
+
+  std::vector<String> schedulers = {"sequential", "thread_level",
+                                    "thread_list",
+#ifdef WITH_OPENMP
+                                    "openmp_level",
+#endif
+                                    "work_stealing"};
+  if (args.options.find("scheduler") != args.options.end())
+    schedulers = {args.getOptionString("scheduler")};
+
+  std::cout << "Step times in us for " << numCopies << " "
+            << (decoupled ? "decoupled" : "coupled") << " copies"
+            << std::endl;
+  std::cout << std::left << std::setw(16) << "scheduler" << std::right
+            << std::setw(8) << "copies" << std::setw(8) << "threads"
+            << std::setw(14) << "mean" << std::setw(14) << "median"
+            << std::setw(14) << "p99" << std::endl;
+
+  for (auto &scheduler : schedulers)
+    simulate(filenames, scheduler, numCopies, numThreads, decoupled, timeStep,
+             finalTime);
+}
@@ -0,0 +1,116 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <DPsim.h>
+#include <dpsim/ArrayDataLogger.h>
+
+using namespace DPsim;
+using namespace CPS::DP;
+using namespace CPS::DP::Ph1;
+
+// N-1 screening of a double-circuit feeder: scenario k trips one circuit of
+// section k. All scenarios share the matrix pattern, so the symbolic analysis
+// of the system matrix is only computed once and reused by all threads.
+
+const Real timeStep = 0.0001;
+const Real finalTime = 0.2;
+const Real tripTime = 0.1;
+
+Simulation::Ptr createScenario(UInt sections, UInt scenario) {
+  String simName = "DP_PiLine_Batch_N1_" + std::to_string(scenario);
+
+  auto n0 = SimNode::make("n0");
+  auto vs = VoltageSource::make("vs", Logger::Level::off);
+  vs->setParameters(CPS::Math::polar(20e3, 0));
+  vs->connect({SimNode::GND, n0});
+
+  SystemNodeList nodes{n0};
+  SystemComponentList components{vs};
+  std::vector<std::shared_ptr<Switch>> breakers;
+
+  auto prev = n0;
+  for (UInt idx = 0; idx < sections; ++idx) {
+    String suffix = "_" + std::to_string(idx);
+    auto node = SimNode::make("n" + std::to_string(idx + 1));
+    auto breakerNode = SimNode::make("nb" + suffix);
+
+    // First circuit directly, second circuit behind a breaker
+    auto line1 = PiLine::make("line1" + suffix, Logger::Level::off);
+    line1->setParameters(0.5, 1.5e-3, 2e-7);
+    line1->connect({prev, node});
+    auto breaker = Switch::make("breaker" + suffix, Logger::Level::off);
+    breaker->setParameters(1e9, 1e-3, true);
+    breaker->connect({prev, breakerNode});
+    auto line2 = PiLine::make("line2" + suffix, Logger::Level::off);
+    line2->setParameters(0.5, 1.5e-3, 2e-7);
+    line2->connect({breakerNode, node});
+
+    auto load = Resistor::make("load" + suffix, Logger::Level::off);
+    load->setParameters(400. * sections);
+    load->connect({node, SimNode::GND});
+
+    nodes.push_back(node);
+    nodes.push_back(breakerNode);
+    components.insert(components.end(), {line1, breaker, line2, load});
+    breakers.push_back(breaker);
+    prev = node;
+  }
+
+  auto logger = ArrayDataLogger::make(
+      simName, static_cast<UInt>(finalTime / timeStep) + 2);
+  logger->logAttribute("v_end", prev->mVoltage->deriveCoeff<Complex>(0, 0)
+                                    ->deriveMag());
+
+  auto sim = std::make_shared<Simulation>(simName, Logger::Level::off);
+  sim->setSystem(SystemTopology(50, nodes, components));
+  sim->setDomain(Domain::DP);
+  sim->setTimeStep(timeStep);
+  sim->setFinalTime(finalTime);
+  sim->doSplitSubnets(false);
+  // Only the two switch states occurring in the scenario are factorized
+  sim->doLazySwitchedMatrices(true);
+  sim->setLogStepTimes(false);
+  sim->addEvent(SwitchEvent::make(tripTime, breakers[scenario], false));
+  sim->addLogger(logger);
+  return sim;
+}
+
+int main(int argc, char *argv[]) {
+  CommandLineArgs args(argc, argv, "DP_PiLine_Batch_N1");
+  Logger::setLogDir("logs/DP_PiLine_Batch_N1");
+
+  UInt sections = 10;
+  if (args.options.find("sections") != args.options.end())
+    sections = args.getOptionInt("sections");
+
+  BatchSimulation batch(
+      "DP_PiLine_Batch_N1",
+      [sections](UInt scenario) { return createScenario(sections, scenario); });
+  if (args.options.find("threads") != args.options.end())
+    batch.setThreads(args.getOptionInt("threads"));
+
+  auto results = batch.run(sections);
+
+  for (auto &result : results) {
+    if (!result.success) {
+      std::cout << "section " << result.scenario << ": " << result.error
+                << std::endl;
+      continue;
+    }
+    auto logger =
+        std::dynamic_pointer_cast<ArrayDataLogger>(result.loggers.front());
+    Real minVoltage =
+        logger->data().col(1).head(logger->rows()).minCoeff();
+    std::cout << "section " << result.scenario << ": min. end voltage "
+              << minVoltage << " V, " << result.duration << " s" << std::endl;
+  }
+  std::cout << "Symbolic analyses computed: "
+            << batch.symbolicAnalysisCache()->misses()
+            << ", reused: " << batch.symbolicAnalysisCache()->hits()
+            << std::endl;
+}
@@ -0,0 +1,123 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <DPsim.h>
+#include <iostream>
+#include <map>
+
+using namespace DPsim;
+using namespace CPS::EMT;
+using namespace CPS::EMT::Ph3;
+
+/// Simulates a pi line with a switched load and returns the phase A voltage
+/// at the load node for each simulated step, indexed by the number of
+/// fixed time steps from the start
+std::map<Int, Real> simPiLineLoadStep(String simName, Real timeStep,
+                                      Real finalTime, Bool variableTimeStep,
+                                      Int &numSteps) {
+  Logger::setLogDir("logs/" + simName);
+
+  // Nodes
+  auto n1 = SimNode::make("n1", PhaseType::ABC);
+  auto n2 = SimNode::make("n2", PhaseType::ABC);
+
+  // Components
+  auto vs = VoltageSource::make("v_1");
+  vs->setParameters(
+      CPS::Math::singlePhaseVariableToThreePhase(CPS::Math::polar(100000, 0)),
+      50);
+
+  auto line = PiLine::make("Line");
+  line->setParameters(CPS::Math::singlePhaseParameterToThreePhase(5),
+                      CPS::Math::singlePhaseParameterToThreePhase(0.16),
+                      CPS::Math::singlePhaseParameterToThreePhase(1.0e-6),
+                      CPS::Math::singlePhaseParameterToThreePhase(1.0e-6));
+
+  auto load = Resistor::make("R_load");
+  load->setParameters(CPS::Math::singlePhaseParameterToThreePhase(10000));
+
+  auto loadStep = Switch::make("Sw_load");
+  loadStep->setParameters(CPS::Math::singlePhaseParameterToThreePhase(1e9),
+                          CPS::Math::singlePhaseParameterToThreePhase(1000));
+  loadStep->openSwitch();
+
+  // Topology
+  vs->connect({SimNode::GND, n1});
+  line->connect({n1, n2});
+  load->connect({n2, SimNode::GND});
+  loadStep->connect({n2, SimNode::GND});
+
+  auto sys = SystemTopology(50, SystemNodeList{n1, n2},
+                            SystemComponentList{vs, line, load, loadStep});
+
+  // Logging
+  auto logger = DataLogger::make(simName);
+  logger->logAttribute("v1", n1->attribute("v"));
+  logger->logAttribute("v2", n2->attribute("v"));
+  logger->logAttribute("iline", line->attribute("i_intf"));
+
+  Simulation sim(simName);
+  sim.setSystem(sys);
+  sim.setDomain(Domain::EMT);
+  sim.setTimeStep(timeStep);
+  sim.setFinalTime(finalTime);
+  sim.addLogger(logger);
+  if (variableTimeStep) {
+    sim.doVariableTimeStep();
+    sim.setMaxTimeStep(8 * timeStep);
+    sim.setTimeStepTolerance(1e-2);
+  }
+
+  sim.addEvent(SwitchEvent3Ph::make(0.1, loadStep, true));
+  sim.addEvent(SwitchEvent3Ph::make(0.2, loadStep, false));
+
+  std::map<Int, Real> voltages;
+  numSteps = 0;
+  sim.start();
+  while (sim.time() < finalTime + DOUBLE_EPSILON) {
+    Real time = sim.time();
+    sim.step();
+    voltages[static_cast<Int>(std::round(time / timeStep))] =
+        (**n2->mVoltage)(0, 0);
+    ++numSteps;
+  }
+  sim.stop();
+
+  return voltages;
+}
+
+int main(int argc, char *argv[]) {
+  Real timeStep = 0.00005;
+  Real finalTime = 0.3;
+
+  Int fixedSteps, variableSteps;
+  auto fixed = simPiLineLoadStep("EMT_PiLine_FixedTimeStep", timeStep,
+                                 finalTime, false, fixedSteps);
+  auto variable = simPiLineLoadStep("EMT_PiLine_VariableTimeStep", timeStep,
+                                    finalTime, true, variableSteps);
+
+  // Compare the solutions at the times both simulations have computed
+  Real peak = 0;
+  for (auto &sample : fixed)
+    peak = std::max(peak, std::abs(sample.second));
+  Real maxDeviation = 0;
+  for (auto &sample : variable) {
+    auto fixedSample = fixed.find(sample.first);
+    if (fixedSample != fixed.end())
+      maxDeviation = std::max(maxDeviation,
+                              std::abs(sample.second - fixedSample->second));
+  }
+
+  std::cout << "Fixed time step: " << fixedSteps << " steps" << std::endl;
+  std::cout << "Variable time step: " << variableSteps << " steps"
+            << std::endl;
+  std::cout << "Max. deviation of the load voltage: " << maxDeviation << " V ("
+            << maxDeviation / peak * 100 << " % of the peak)" << std::endl;
+
+  return maxDeviation < 0.05 * peak ? 0 : 1;
+}
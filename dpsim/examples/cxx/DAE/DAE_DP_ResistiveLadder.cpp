@@ -0,0 +1,68 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <DPsim.h>
+
+using namespace DPsim;
+using namespace CPS::DP;
+using namespace CPS::DP::Ph1;
+
+/// Resistive ladder network solved by the DAE solver. All components provide
+/// analytic Jacobians, so the solver uses their sparse Jacobian directly
+/// instead of finite differences.
+int main(int argc, char *argv[]) {
+  Real timeStep = 0.00005;
+  Int numSections = 20;
+
+  String simName = "DAE_DP_ResistiveLadder";
+  Logger::setLogDir("logs/" + simName);
+
+  // Nodes
+  SystemNodeList nodes = {SimNode::GND};
+  for (Int section = 0; section <= numSections; ++section)
+    nodes.push_back(SimNode::make("n" + std::to_string(section)));
+
+  // Components
+  auto vs = VoltageSource::make("v_s");
+  vs->setParameters(Complex(10000, 0));
+  vs->connect({SimNode::GND, std::dynamic_pointer_cast<SimNode>(nodes[1])});
+  SystemComponentList comps = {vs};
+
+  for (Int section = 1; section <= numSections; ++section) {
+    auto from = std::dynamic_pointer_cast<SimNode>(nodes[section]);
+    auto to = std::dynamic_pointer_cast<SimNode>(nodes[section + 1]);
+
+    auto line = Resistor::make("r_line_" + std::to_string(section));
+    line->setParameters(1);
+    line->connect({from, to});
+
+    auto load = Resistor::make("r_load_" + std::to_string(section));
+    load->setParameters(1000);
+    load->connect({SimNode::GND, to});
+
+    comps.push_back(line);
+    comps.push_back(load);
+  }
+
+  auto sys = SystemTopology(50, nodes, comps);
+
+  auto logger = DataLogger::make(simName);
+  logger->logAttribute("v_end", nodes.back()->attribute("v"));
+
+  Simulation sim(simName);
+  sim.setSystem(sys);
+  sim.setTimeStep(timeStep);
+  sim.setFinalTime(0.01);
+  sim.setDomain(Domain::DP);
+  sim.setSolverType(Solver::Type::DAE);
+  sim.addLogger(logger);
+
+  sim.run();
+
+  return 0;
+}
@@ -0,0 +1,208 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <regex>
+#include <sstream>
+#include <thread>
+
+#include <DPsim.h>
+
+#include "Benchmark.h"
+
+using namespace DPsim;
+using namespace DPsim::Benchmark;
+
+// Runs all benchmarks registered with DPSIM_BENCHMARK and writes the
+// results in the JSON format of Google Benchmark, so that its tools
+// (e.g. compare.py) can be used to track regressions between releases.
+//
+// Options:
+//   -o filter=REGEX    only run benchmarks whose name matches
+//   -o out=FILE        JSON output file (default: benchmarks.json)
+//   -o min_time=SEC    minimum measured time per benchmark (default: 0.5)
+
+std::deque<Registration> &DPsim::Benchmark::registry() {
+  static std::deque<Registration> benchmarks;
+  return benchmarks;
+}
+
+Registration &DPsim::Benchmark::registerBenchmark(const String &name,
+                                                  Function function) {
+  registry().emplace_back(name, function);
+  return registry().back();
+}
+
+namespace {
+struct Result {
+  String name;
+  UInt iterations;
+  Real realTime;
+  Real cpuTime;
+  Real itemsProcessed;
+  String label;
+  std::map<String, Real> counters;
+  String error;
+};
+
+Result runInstance(const Registration &benchmark, const String &name,
+                   const std::vector<Int> &args, Real minTime) {
+  UInt iterations =
+      benchmark.fixedIterations() > 0 ? benchmark.fixedIterations() : 1;
+
+  while (true) {
+    State state(iterations, args);
+    benchmark.function()(state);
+
+    Bool done = !state.error().empty() || benchmark.fixedIterations() > 0 ||
+                state.realTime() >= minTime || iterations >= 1e9;
+    if (done)
+      return {name,
+              state.iterations(),
+              state.realTime(),
+              state.cpuTime(),
+              state.itemsProcessed(),
+              state.label(),
+              state.counters(),
+              state.error()};
+
+    // Predict the iterations needed for the minimum time like Google
+    // Benchmark, but grow by at most a factor of ten per attempt
+    Real multiplier = minTime * 1.4 / std::max(state.realTime(), 1e-9);
+    multiplier = std::min(std::max(multiplier, 2.), 10.);
+    iterations = static_cast<UInt>(
+        std::min(std::ceil(iterations * multiplier), 1e9));
+  }
+}
+
+json toJson(const Result &result) {
+  json entry;
+  entry["name"] = result.name;
+  entry["run_name"] = result.name;
+  entry["run_type"] = "iteration";
+  entry["repetitions"] = 1;
+  entry["threads"] = 1;
+  entry["iterations"] = result.iterations;
+  if (!result.error.empty()) {
+    entry["error_occurred"] = true;
+    entry["error_message"] = result.error;
+    return entry;
+  }
+
+  Real iterations = std::max<Real>(result.iterations, 1);
+  entry["real_time"] = result.realTime / iterations * 1e9;
+  entry["cpu_time"] = result.cpuTime / iterations * 1e9;
+  entry["time_unit"] = "ns";
+  if (result.itemsProcessed > 0 && result.realTime > 0)
+    entry["items_per_second"] = result.itemsProcessed / result.realTime;
+  if (!result.label.empty())
+    entry["label"] = result.label;
+  for (auto &counter : result.counters)
+    entry[counter.first] = counter.second;
+  return entry;
+}
+
+void printResult(const Result &result) {
+  std::cout << std::left << std::setw(56) << result.name << std::right;
+  if (!result.error.empty()) {
+    std::cout << " ERROR: " << result.error << std::endl;
+    return;
+  }
+
+  Real iterations = std::max<Real>(result.iterations, 1);
+  std::cout << std::setw(14) << std::setprecision(4)
+            << result.realTime / iterations * 1e9 << " ns" << std::setw(14)
+            << result.cpuTime / iterations * 1e9 << " ns" << std::setw(12)
+            << result.iterations;
+  if (result.itemsProcessed > 0 && result.realTime > 0)
+    std::cout << std::setw(14) << result.itemsProcessed / result.realTime
+              << " items/s";
+  if (!result.label.empty())
+    std::cout << " " << result.label;
+  std::cout << std::endl;
+}
+
+json context(const String &executable) {
+  json ctx;
+  auto now = std::time(nullptr);
+  std::stringstream date;
+  date << std::put_time(std::localtime(&now), "%FT%T%z");
+  ctx["date"] = date.str();
+  ctx["executable"] = executable;
+  ctx["num_cpus"] = std::thread::hardware_concurrency();
+#ifdef NDEBUG
+  ctx["library_build_type"] = "release";
+#else
+  ctx["library_build_type"] = "debug";
+#endif
+  ctx["dpsim_version"] = DPSIM_VERSION;
+  return ctx;
+}
+} // namespace
+
+int main(int argc, char *argv[]) {
+  CommandLineArgs args(argc, argv, "dpsim-benchmarks");
+
+  std::regex filter(".*");
+  String outFile = "benchmarks.json";
+  Real minTime = 0.5;
+  if (args.options.find("filter") != args.options.end())
+    filter = std::regex(args.getOptionString("filter"));
+  if (args.options.find("out") != args.options.end())
+    outFile = args.getOptionString("out");
+  if (args.options.find("min_time") != args.options.end())
+    minTime = args.getOptionReal("min_time");
+
+  // Keep the log files of components and solvers together
+  CPS::Logger::setLogDir("logs/dpsim-benchmarks");
+
+  std::cout << std::left << std::setw(56) << "benchmark" << std::right
+            << std::setw(17) << "time" << std::setw(17) << "cpu"
+            << std::setw(12) << "iterations" << std::endl;
+
+  json results = json::array();
+  for (auto &benchmark : registry()) {
+    auto argLists = benchmark.argLists();
+    if (argLists.empty())
+      argLists.push_back({});
+
+    for (auto &argList : argLists) {
+      String name = benchmark.name();
+      for (auto arg : argList)
+        name += "/" + std::to_string(arg);
+      if (!std::regex_search(name, filter))
+        continue;
+
+      Result result;
+      try {
+        result = runInstance(benchmark, name, argList, minTime);
+      } catch (std::exception &e) {
+        result = {name, 0, 0, 0, 0, "", {}, e.what()};
+      }
+      printResult(result);
+      results.push_back(toJson(result));
+    }
+  }
+
+  json output;
+  output["context"] = context(argv[0]);
+  output["benchmarks"] = results;
+
+  std::ofstream out(outFile);
+  if (!out.is_open()) {
+    std::cerr << "Cannot open " << outFile << std::endl;
+    return 1;
+  }
+  out << std::setw(2) << output << std::endl;
+  std::cout << "Results written to " << outFile << std::endl;
+  return 0;
+}
@@ -0,0 +1,151 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <ctime>
+#include <deque>
+#include <functional>
+#include <map>
+#include <vector>
+
+#include <dpsim/Definitions.h>
+
+namespace DPsim {
+namespace Benchmark {
+
+/// Timing state of a single benchmark run, modelled after Google Benchmark.
+/// The benchmark function repeats its measured code while keepRunning()
+/// returns true and can exclude setup code with pauseTiming/resumeTiming.
+class State {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  State(UInt iterations, const std::vector<Int> &args)
+      : mMaxIterations(iterations), mArgs(args) {}
+
+  /// Starts the timer on the first call and stops it after the last iteration
+  Bool keepRunning() {
+    if (mIterations == 0 && !mRunning)
+      resumeTiming();
+    if (mIterations < mMaxIterations && mError.empty()) {
+      ++mIterations;
+      return true;
+    }
+    pauseTiming();
+    return false;
+  }
+
+  void pauseTiming() {
+    if (!mRunning)
+      return;
+    mRealTime += Clock::now() - mRealStart;
+    mCpuTime += static_cast<Real>(std::clock() - mCpuStart) / CLOCKS_PER_SEC;
+    mRunning = false;
+  }
+
+  void resumeTiming() {
+    if (mRunning)
+      return;
+    mRunning = true;
+    mCpuStart = std::clock();
+    mRealStart = Clock::now();
+  }
+
+  /// Argument of the benchmark instance
+  Int arg(UInt index = 0) const { return mArgs.at(index); }
+  /// Completed iterations
+  UInt iterations() const { return mIterations; }
+  /// Iterations of this run, e.g. to preallocate buffers
+  UInt maxIterations() const { return mMaxIterations; }
+
+  /// Processed items, e.g. time steps or tasks, reported as rate per second
+  void setItemsProcessed(Real items) { mItemsProcessed = items; }
+  void setLabel(const String &label) { mLabel = label; }
+  /// Additional value reported in the output, e.g. a problem size
+  void setCounter(const String &name, Real value) { mCounters[name] = value; }
+  /// Aborts the benchmark, e.g. if required input files are missing
+  void skipWithError(const String &message) {
+    mError = message;
+    pauseTiming();
+  }
+
+  Real realTime() const {
+    return std::chrono::duration<Real>(mRealTime).count();
+  }
+  Real cpuTime() const { return mCpuTime; }
+  Real itemsProcessed() const { return mItemsProcessed; }
+  const String &label() const { return mLabel; }
+  const std::map<String, Real> &counters() const { return mCounters; }
+  const String &error() const { return mError; }
+
+private:
+  UInt mMaxIterations;
+  UInt mIterations = 0;
+  std::vector<Int> mArgs;
+
+  Bool mRunning = false;
+  Clock::time_point mRealStart;
+  Clock::duration mRealTime = Clock::duration::zero();
+  std::clock_t mCpuStart = 0;
+  Real mCpuTime = 0;
+
+  Real mItemsProcessed = 0;
+  String mLabel;
+  std::map<String, Real> mCounters;
+  String mError;
+};
+
+using Function = std::function<void(State &)>;
+
+/// Registered benchmark with one instance per argument list
+class Registration {
+public:
+  Registration(const String &name, Function function)
+      : mName(name), mFunction(function) {}
+
+  /// Adds an instance with the given arguments, named name/arg0/arg1...
+  Registration &args(const std::vector<Int> &args) {
+    mArgs.push_back(args);
+    return *this;
+  }
+  /// Number of iterations for expensive benchmarks instead of a minimum time
+  Registration &iterations(UInt iterations) {
+    mIterations = iterations;
+    return *this;
+  }
+
+  const String &name() const { return mName; }
+  const Function &function() const { return mFunction; }
+  const std::vector<std::vector<Int>> &argLists() const { return mArgs; }
+  UInt fixedIterations() const { return mIterations; }
+
+private:
+  String mName;
+  Function mFunction;
+  std::vector<std::vector<Int>> mArgs;
+  UInt mIterations = 0;
+};
+
+/// Global list of benchmarks, filled by DPSIM_BENCHMARK
+std::deque<Registration> &registry();
+
+Registration &registerBenchmark(const String &name, Function function);
+
+} // namespace Benchmark
+} // namespace DPsim
+
+#define DPSIM_BENCHMARK_CONCAT_(a, b) a##b
+#define DPSIM_BENCHMARK_CONCAT(a, b) DPSIM_BENCHMARK_CONCAT_(a, b)
+
+/// Registers a function void(DPsim::Benchmark::State &) as benchmark
+#define DPSIM_BENCHMARK(function)                                              \
+  static DPsim::Benchmark::Registration &DPSIM_BENCHMARK_CONCAT(               \
+      benchmarkRegistration, __LINE__) =                                       \
+      DPsim::Benchmark::registerBenchmark(#function, function)
@@ -0,0 +1,242 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <functional>
+#include <type_traits>
+
+#include <DPsim.h>
+
+#include "../Examples.h"
+#include "Benchmark.h"
+
+using namespace DPsim;
+using namespace DPsim::Benchmark;
+
+namespace {
+
+template <typename VarType>
+using ComponentFactory = std::function<
+    typename CPS::SimPowerComp<VarType>::Ptr(const String &name)>;
+
+const Real nomVoltage = 24e3;
+
+std::vector<Complex> threePhaseVoltage(Complex voltage) {
+  return {voltage, voltage * SHIFT_TO_PHASE_B, voltage * SHIFT_TO_PHASE_C};
+}
+
+/// Three-phase voltage source of the domain
+CPS::SimPowerComp<Real>::Ptr makeSource(const String &name, Real) {
+  auto vs = CPS::EMT::Ph3::VoltageSource::make(name);
+  vs->setParameters(CPS::Math::singlePhaseVariableToThreePhase(
+                        RMS3PH_TO_PEAK1PH * nomVoltage),
+                    60);
+  return vs;
+}
+
+CPS::SimPowerComp<Complex>::Ptr makeSource(const String &name, Complex) {
+  auto vs = CPS::DP::Ph3::VoltageSource::make(name);
+  vs->setParameters(RMS3PH_TO_PEAK1PH * nomVoltage);
+  return vs;
+}
+
+/// Three-phase resistive load of the domain
+CPS::SimPowerComp<Real>::Ptr makeLoad(const String &name, Real) {
+  auto load = CPS::EMT::Ph3::Resistor::make(name);
+  load->setParameters(CPS::Math::singlePhaseParameterToThreePhase(10.));
+  return load;
+}
+
+CPS::SimPowerComp<Complex>::Ptr makeLoad(const String &name, Complex) {
+  auto load = CPS::DP::Ph3::Resistor::make(name);
+  load->setParameters(CPS::Math::singlePhaseParameterToThreePhase(10.));
+  return load;
+}
+
+/// EMT or DP three-phase components of one type, initialized for MNA. Each
+/// one is connected to its own node with a resistive load. Components with
+/// two terminals are fed by a common voltage source, the others are sources
+/// themselves.
+template <typename VarType> struct ComponentSetup {
+  using SimNode = CPS::SimNode<VarType>;
+
+  SystemComponentList measured;
+  std::shared_ptr<MnaSolver<VarType>> solver;
+  CPS::MNAInterface::List components;
+  CPS::Attribute<Matrix>::Ptr leftVector;
+
+  ComponentSetup(UInt count, UInt terminals,
+                 const ComponentFactory<VarType> &factory,
+                 Real timeStep = 5e-5) {
+    SystemNodeList nodes;
+    SystemComponentList components;
+
+    auto n0 =
+        SimNode::make("n0", PhaseType::ABC,
+                      threePhaseVoltage(RMS3PH_TO_PEAK1PH * nomVoltage));
+    auto vs = makeSource("vs", VarType());
+    vs->connect({SimNode::GND, n0});
+    nodes.push_back(n0);
+    components.push_back(vs);
+
+    Complex voltage = CPS::Math::polar(RMS3PH_TO_PEAK1PH * nomVoltage, -0.05);
+    for (UInt idx = 1; idx <= count; ++idx) {
+      auto node = SimNode::make("n" + std::to_string(idx), PhaseType::ABC,
+                                threePhaseVoltage(voltage));
+
+      auto comp = factory("comp" + std::to_string(idx));
+      if (terminals == 2)
+        comp->connect({n0, node});
+      else
+        comp->connect({node});
+
+      auto load = makeLoad("load" + std::to_string(idx), VarType());
+      load->connect({node, SimNode::GND});
+
+      nodes.push_back(node);
+      components.push_back(comp);
+      components.push_back(load);
+      measured.push_back(comp);
+    }
+
+    Domain domain =
+        std::is_same<VarType, Real>::value ? Domain::EMT : Domain::DP;
+    solver = MnaSolverFactory::factory<VarType>("benchmark_components", domain,
+                                               Logger::Level::off);
+    solver->setTimeStep(timeStep);
+    solver->doSystemMatrixRecomputation(true);
+    solver->setSystem(SystemTopology(60, nodes, components));
+    solver->initialize();
+
+    for (auto comp : measured)
+      this->components.push_back(
+          std::dynamic_pointer_cast<CPS::MNAInterface>(comp));
+    leftVector = CPS::AttributeStatic<Matrix>::make(solver->leftSideVector());
+  }
+};
+
+/// Measures the MNA pre- and post-step of the components, without solving the
+/// system in between. The time per component follows from the items.
+template <typename VarType>
+void componentSteps(State &state, UInt terminals,
+                    const ComponentFactory<VarType> &factory) {
+  ComponentSetup<VarType> setup(state.arg(), terminals, factory);
+  Real time = 0;
+  Int timeStepCount = 0;
+  while (state.keepRunning()) {
+    for (auto comp : setup.components)
+      comp->mnaPreStep(time, timeStepCount);
+    for (auto comp : setup.components)
+      comp->mnaPostStep(time, timeStepCount, setup.leftVector);
+    time += 5e-5;
+    ++timeStepCount;
+  }
+  state.setItemsProcessed(static_cast<Real>(state.iterations()) *
+                          setup.components.size());
+  state.setCounter("components", static_cast<Real>(setup.components.size()));
+}
+
+void emtPh3ResistorSteps(State &state) {
+  componentSteps<Real>(state, 2, [](const String &name) {
+    auto comp = CPS::EMT::Ph3::Resistor::make(name);
+    comp->setParameters(CPS::Math::singlePhaseParameterToThreePhase(1.));
+    return comp;
+  });
+}
+DPSIM_BENCHMARK(emtPh3ResistorSteps).args({100});
+
+void emtPh3InductorSteps(State &state) {
+  componentSteps<Real>(state, 2, [](const String &name) {
+    auto comp = CPS::EMT::Ph3::Inductor::make(name);
+    comp->setParameters(CPS::Math::singlePhaseParameterToThreePhase(1e-3));
+    return comp;
+  });
+}
+DPSIM_BENCHMARK(emtPh3InductorSteps).args({100});
+
+void emtPh3CapacitorSteps(State &state) {
+  componentSteps<Real>(state, 2, [](const String &name) {
+    auto comp = CPS::EMT::Ph3::Capacitor::make(name);
+    comp->setParameters(CPS::Math::singlePhaseParameterToThreePhase(1e-6));
+    return comp;
+  });
+}
+DPSIM_BENCHMARK(emtPh3CapacitorSteps).args({100});
+
+void emtPh3PiLineSteps(State &state) {
+  componentSteps<Real>(state, 2, [](const String &name) {
+    auto comp = CPS::EMT::Ph3::PiLine::make(name);
+    comp->setParameters(CPS::Math::singlePhaseParameterToThreePhase(0.5),
+                        CPS::Math::singlePhaseParameterToThreePhase(1.5e-3),
+                        CPS::Math::singlePhaseParameterToThreePhase(2e-7));
+    return comp;
+  });
+}
+DPSIM_BENCHMARK(emtPh3PiLineSteps).args({100});
+
+void dpPh3ResistorSteps(State &state) {
+  componentSteps<Complex>(state, 2, [](const String &name) {
+    auto comp = CPS::DP::Ph3::Resistor::make(name);
+    comp->setParameters(CPS::Math::singlePhaseParameterToThreePhase(1.));
+    return comp;
+  });
+}
+DPSIM_BENCHMARK(dpPh3ResistorSteps).args({100});
+
+void dpPh3InductorSteps(State &state) {
+  componentSteps<Complex>(state, 2, [](const String &name) {
+    auto comp = CPS::DP::Ph3::Inductor::make(name);
+    comp->setParameters(CPS::Math::singlePhaseParameterToThreePhase(1e-3));
+    return comp;
+  });
+}
+DPSIM_BENCHMARK(dpPh3InductorSteps).args({100});
+
+void dpPh3CapacitorSteps(State &state) {
+  componentSteps<Complex>(state, 2, [](const String &name) {
+    auto comp = CPS::DP::Ph3::Capacitor::make(name);
+    comp->setParameters(CPS::Math::singlePhaseParameterToThreePhase(1e-6));
+    return comp;
+  });
+}
+DPSIM_BENCHMARK(dpPh3CapacitorSteps).args({100});
+
+void emtPh3SynchronGenerator4OrderVBRSteps(State &state) {
+  CPS::CIM::Examples::Components::SynchronousGeneratorKundur::MachineParameters
+      kundur;
+  componentSteps<Real>(state, 1, [&kundur](const String &name) {
+    auto comp = CPS::EMT::Ph3::SynchronGenerator4OrderVBR::make(name);
+    comp->setOperationalParametersPerUnit(
+        kundur.nomPower, kundur.nomVoltage, kundur.nomFreq, kundur.H,
+        kundur.Ld, kundur.Lq, kundur.Ll, kundur.Ld_t, kundur.Lq_t,
+        kundur.Td0_t, kundur.Tq0_t);
+    comp->setInitialValues(Complex(300e6, 50e6), 300e6,
+                           CPS::Math::polar(nomVoltage, -0.05));
+    comp->setModelAsNortonSource(true);
+    return comp;
+  });
+}
+DPSIM_BENCHMARK(emtPh3SynchronGenerator4OrderVBRSteps).args({100});
+
+void emtPh3SynchronGeneratorVBRSteps(State &state) {
+  CPS::CIM::Examples::Components::SynchronousGeneratorKundur::MachineParameters
+      kundur;
+  componentSteps<Real>(state, 1, [&kundur](const String &name) {
+    auto comp = CPS::EMT::Ph3::SynchronGeneratorVBR::make(name);
+    comp->setBaseAndOperationalPerUnitParameters(
+        kundur.nomPower, kundur.nomVoltage, kundur.nomFreq, kundur.poleNum,
+        kundur.nomFieldCurr, kundur.Rs, kundur.Ld, kundur.Lq, kundur.Ld_t,
+        kundur.Lq_t, kundur.Ld_s, kundur.Lq_s, kundur.Ll, kundur.Td0_t,
+        kundur.Tq0_t, kundur.Td0_s, kundur.Tq0_s, kundur.H);
+    comp->setInitialValues(300e6, 50e6, RMS3PH_TO_PEAK1PH * nomVoltage, -0.05,
+                           300e6);
+    return comp;
+  });
+}
+DPSIM_BENCHMARK(emtPh3SynchronGeneratorVBRSteps).args({100});
+
+} // namespace
@@ -0,0 +1,92 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <DPsim.h>
+
+#include "Benchmark.h"
+#include "Grids.h"
+
+using namespace DPsim;
+using namespace DPsim::Benchmark;
+
+namespace {
+
+using Generator = CPS::SP::Ph1::ReducedOrderSynchronGeneratorVBR;
+
+void setupFleetSimulation(Simulation &sim, const SystemTopology &system,
+                          Bool grouping) {
+  sim.setSystem(system);
+  sim.setDomain(Domain::SP);
+  sim.setTimeStep(1e-4);
+  sim.setFinalTime(1e6);
+  sim.setLogStepTimes(false);
+  sim.doSystemMatrixRecomputation(true);
+  sim.doGeneratorGrouping(grouping);
+}
+
+std::vector<std::shared_ptr<Generator>>
+fleetGenerators(const SystemTopology &system) {
+  std::vector<std::shared_ptr<Generator>> generators;
+  for (auto comp : system.mComponents) {
+    if (auto gen = std::dynamic_pointer_cast<Generator>(comp))
+      generators.push_back(gen);
+  }
+  return generators;
+}
+
+/// Measures simulation steps of a generator fleet with the generators stepped
+/// one by one or as group. The grouped run is repeated without grouping for
+/// the same number of steps afterwards to report the largest deviation of the
+/// rotor speed and load angle between both.
+void fleetSimulationSteps(State &state, Bool grouping) {
+  auto system = Grids::generatorFleet(state.arg());
+  Simulation sim("benchmark_generator_fleet", Logger::Level::off);
+  setupFleetSimulation(sim, system, grouping);
+  sim.start();
+
+  while (state.keepRunning())
+    sim.step();
+
+  sim.stop();
+  state.setItemsProcessed(state.iterations());
+  state.setCounter("generators", static_cast<Real>(state.arg()));
+  if (!grouping)
+    return;
+
+  auto reference = Grids::generatorFleet(state.arg());
+  Simulation refSim("benchmark_generator_fleet_ref", Logger::Level::off);
+  setupFleetSimulation(refSim, reference, false);
+  refSim.start();
+  for (UInt step = 0; step < state.iterations(); ++step)
+    refSim.step();
+  refSim.stop();
+
+  auto generators = fleetGenerators(system);
+  auto refGenerators = fleetGenerators(reference);
+  Real deviation = 0;
+  for (size_t idx = 0; idx < generators.size(); ++idx) {
+    deviation = std::max(deviation, std::abs(**generators[idx]->mOmMech -
+                                             **refGenerators[idx]->mOmMech));
+    deviation = std::max(deviation, std::abs(**generators[idx]->mDelta -
+                                             **refGenerators[idx]->mDelta));
+  }
+  state.setCounter("maxDeviation", deviation);
+}
+
+void generatorFleetSteps(State &state) { fleetSimulationSteps(state, false); }
+DPSIM_BENCHMARK(generatorFleetSteps).args({10}).args({100}).args({300});
+
+void generatorFleetGroupedSteps(State &state) {
+  fleetSimulationSteps(state, true);
+}
+DPSIM_BENCHMARK(generatorFleetGroupedSteps)
+    .args({10})
+    .args({100})
+    .args({300});
+
+} // namespace
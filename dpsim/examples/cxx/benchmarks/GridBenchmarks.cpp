@@ -0,0 +1,83 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <DPsim.h>
+
+#include "Benchmark.h"
+#include "Grids.h"
+
+using namespace DPsim;
+using namespace DPsim::Benchmark;
+
+namespace {
+
+/// Measures whole simulation steps including scheduling. The setup and
+/// initialization of the simulation are excluded.
+void simulationSteps(State &state, const String &name,
+                     const SystemTopology &system) {
+  Simulation sim(name, Logger::Level::off);
+  sim.setSystem(system);
+  sim.setDomain(Domain::DP);
+  sim.setTimeStep(1e-4);
+  sim.setFinalTime(1e6);
+  sim.setLogStepTimes(false);
+  sim.start();
+
+  while (state.keepRunning())
+    sim.step();
+
+  sim.stop();
+  state.setItemsProcessed(state.iterations());
+  state.setCounter("nodes", static_cast<Real>(system.mNodes.size()));
+  state.setCounter("components",
+                   static_cast<Real>(system.mComponents.size()));
+}
+
+void ladderSimulationSteps(State &state) {
+  simulationSteps(state, "benchmark_ladder", Grids::ladder(state.arg()));
+}
+DPSIM_BENCHMARK(ladderSimulationSteps).args({10}).args({100}).args({1000});
+
+#ifdef WITH_CIM
+void cimLoad(State &state, const String &name, Real frequency,
+             const std::list<fs::path> &files) {
+  while (state.keepRunning())
+    Grids::loadCIM(name, frequency, files);
+}
+
+void wsccCIMLoad(State &state) {
+  cimLoad(state, "benchmark_wscc", 60, Grids::wsccFiles());
+}
+DPSIM_BENCHMARK(wsccCIMLoad);
+
+void cigreCIMLoad(State &state) {
+  cimLoad(state, "benchmark_cigre", 50, Grids::cigreFiles());
+}
+DPSIM_BENCHMARK(cigreCIMLoad);
+
+// Argument: number of copies of the grid from SystemTopology::multiply, which
+// are independent subnets as in the WSCC_9bus_mult examples without lines
+
+void wsccSimulationSteps(State &state) {
+  auto system = Grids::loadCIM("benchmark_wscc", 60, Grids::wsccFiles());
+  if (state.arg() > 1)
+    system.multiply(state.arg() - 1);
+  simulationSteps(state, "benchmark_wscc", system);
+}
+DPSIM_BENCHMARK(wsccSimulationSteps).args({1}).args({4}).args({16});
+
+void cigreSimulationSteps(State &state) {
+  auto system = Grids::loadCIM("benchmark_cigre", 50, Grids::cigreFiles());
+  if (state.arg() > 1)
+    system.multiply(state.arg() - 1);
+  simulationSteps(state, "benchmark_cigre", system);
+}
+DPSIM_BENCHMARK(cigreSimulationSteps).args({1}).args({4}).args({16});
+#endif
+
+} // namespace
@@ -0,0 +1,139 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#pragma once
+
+#include <DPsim.h>
+
+namespace DPsim {
+namespace Benchmark {
+namespace Grids {
+
+/// Radial DP feeder with the given number of pi-line sections, each with a
+/// resistive load to ground. The system size grows linearly with the
+/// number of sections, which does not require any grid data files.
+inline SystemTopology ladder(UInt sections) {
+  using namespace CPS::DP;
+
+  SystemNodeList nodes;
+  SystemComponentList components;
+
+  auto n0 = SimNode::make("n0");
+  auto vs = Ph1::VoltageSource::make("vs");
+  vs->setParameters(CPS::Math::polar(20e3, 0));
+  vs->connect({SimNode::GND, n0});
+  nodes.push_back(n0);
+  components.push_back(vs);
+
+  auto prev = n0;
+  for (UInt idx = 1; idx <= sections; ++idx) {
+    auto node = SimNode::make("n" + std::to_string(idx));
+
+    auto line = Ph1::PiLine::make("line" + std::to_string(idx));
+    line->setParameters(0.5, 1.5e-3, 2e-7);
+    line->connect({prev, node});
+
+    auto load = Ph1::Resistor::make("load" + std::to_string(idx));
+    load->setParameters(400. * sections);
+    load->connect({node, SimNode::GND});
+
+    nodes.push_back(node);
+    components.push_back(line);
+    components.push_back(load);
+    prev = node;
+  }
+
+  return SystemTopology(50, nodes, components);
+}
+
+/// Reduced-order SP generators, each connected by its own line to a slack
+/// node. The initial values follow from the line currents at the slack
+/// voltage, so the generators start close to steady state.
+inline SystemTopology generatorFleet(UInt generators) {
+  using namespace CPS::SP;
+
+  const Real nomVoltage = 24e3;
+  const Complex genPower(300e6, 50e6);
+  const Complex lineImpedance(0.05, 2 * PI * 60 * 5e-4);
+
+  SystemNodeList nodes;
+  SystemComponentList components;
+
+  auto n0 = SimNode::make("n0", PhaseType::Single,
+                          std::vector<Complex>{nomVoltage});
+  auto slack = Ph1::NetworkInjection::make("slack");
+  slack->setParameters(nomVoltage);
+  slack->connect({n0});
+  nodes.push_back(n0);
+  components.push_back(slack);
+
+  Complex current = std::conj(genPower / Complex(nomVoltage, 0));
+  Complex voltage = nomVoltage + lineImpedance * current;
+  Complex power = voltage * std::conj(current);
+
+  for (UInt idx = 1; idx <= generators; ++idx) {
+    auto node = SimNode::make("n" + std::to_string(idx), PhaseType::Single,
+                              std::vector<Complex>{voltage});
+
+    auto gen = Ph1::SynchronGenerator4OrderVBR::make("gen" +
+                                                     std::to_string(idx));
+    // Kundur machine with an inertia spread over the fleet
+    gen->setOperationalParametersPerUnit(555e6, nomVoltage, 60,
+                                         3.0 + 0.01 * idx, 1.8, 1.7, 0.2, 0.3,
+                                         0.55, 8.0, 0.4);
+    gen->setInitialValues(power, power.real(), voltage);
+    gen->setModelAsNortonSource(true);
+    gen->connect({node});
+
+    auto line = Ph1::PiLine::make("line" + std::to_string(idx));
+    line->setParameters(lineImpedance.real(),
+                        lineImpedance.imag() / (2 * PI * 60));
+    line->connect({node, n0});
+
+    nodes.push_back(node);
+    components.push_back(gen);
+    components.push_back(line);
+  }
+
+  return SystemTopology(60, nodes, components);
+}
+
+#ifdef WITH_CIM
+/// CIM files of the WSCC 9-bus system, searched like in the CIM examples
+inline std::list<fs::path> wsccFiles() {
+  std::list<fs::path> filenames = {"WSCC-09_RX_DI.xml", "WSCC-09_RX_EQ.xml",
+                                   "WSCC-09_RX_SV.xml", "WSCC-09_RX_TP.xml"};
+  return Utils::findFiles(filenames,
+                          "build/_deps/cim-data-src/WSCC-09/WSCC-09_RX",
+                          "CIMPATH");
+}
+
+/// CIM files of the CIGRE MV benchmark grid without DG
+inline std::list<fs::path> cigreFiles() {
+  std::list<fs::path> filenames = {
+      "Rootnet_FULL_NE_28J17h_DI.xml", "Rootnet_FULL_NE_28J17h_EQ.xml",
+      "Rootnet_FULL_NE_28J17h_SV.xml", "Rootnet_FULL_NE_28J17h_TP.xml"};
+  return Utils::findFiles(
+      filenames,
+      "dpsim/Examples/CIM/grid-data/CIGRE_MV/NEPLAN/"
+      "CIGRE_MV_no_tapchanger_noLoad1_LeftFeeder_With_LoadFlow_Results",
+      "CIMPATH");
+}
+
+/// Loads a DP grid with ideal voltage sources as generators
+inline SystemTopology loadCIM(const String &name, Real frequency,
+                              const std::list<fs::path> &files) {
+  CIMReader reader(name, Logger::Level::off, Logger::Level::off);
+  return reader.loadCIM(frequency, files, Domain::DP, PhaseType::Single,
+                        CPS::GeneratorType::IdealVoltageSource);
+}
+#endif
+
+} // namespace Grids
+} // namespace Benchmark
+} // namespace DPsim
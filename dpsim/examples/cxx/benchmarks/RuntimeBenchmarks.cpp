@@ -0,0 +1,153 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <DPsim.h>
+#include <dpsim/ArrayDataLogger.h>
+#include <dpsim/BinaryDataLogger.h>
+#include <dpsim/SequentialScheduler.h>
+#include <dpsim/ThreadLevelScheduler.h>
+#include <dpsim/ThreadListScheduler.h>
+#include <dpsim/ThreadWorkStealingScheduler.h>
+
+#include "Benchmark.h"
+
+using namespace DPsim;
+using namespace DPsim::Benchmark;
+
+namespace {
+
+/// Task without work, so that only the scheduling overhead is measured
+class EmptyTask : public CPS::Task {
+public:
+  EmptyTask(const String &name, CPS::AttributeBase::Ptr input,
+            CPS::AttributeBase::Ptr output)
+      : Task(name) {
+    if (!input.isNull())
+      mAttributeDependencies.push_back(input);
+    mModifiedAttributes.push_back(output);
+  }
+
+  void execute(Real time, Int timeStepCount) {}
+};
+
+/// Independent chains of tasks, e.g. one chain per subnet or component.
+/// The last task of each chain has external side effects, like a logger.
+CPS::Task::List taskChains(UInt width, UInt depth) {
+  CPS::Task::List tasks;
+  for (UInt chain = 0; chain < width; ++chain) {
+    CPS::AttributeBase::Ptr prev;
+    for (UInt idx = 0; idx < depth; ++idx) {
+      CPS::AttributeBase::Ptr output =
+          idx == depth - 1 ? Scheduler::external
+                           : CPS::AttributeStatic<Real>::make(0);
+      tasks.push_back(std::make_shared<EmptyTask>(
+          "chain" + std::to_string(chain) + ".task" + std::to_string(idx),
+          prev, output));
+      prev = output;
+    }
+  }
+  return tasks;
+}
+
+template <typename SchedulerType, typename... Args>
+void schedulerStep(State &state, Args... schedulerArgs) {
+  auto tasks = taskChains(state.arg(0), state.arg(1));
+  SchedulerType scheduler(schedulerArgs...);
+  Scheduler::Edges inEdges, outEdges;
+  scheduler.resolveDeps(tasks, inEdges, outEdges);
+  scheduler.createSchedule(tasks, inEdges, outEdges);
+
+  Int timeStepCount = 0;
+  while (state.keepRunning()) {
+    scheduler.step(timeStepCount * 1e-4, timeStepCount);
+    ++timeStepCount;
+  }
+  scheduler.stop();
+
+  state.setItemsProcessed(static_cast<Real>(state.iterations()) *
+                          tasks.size());
+  state.setCounter("tasks", static_cast<Real>(tasks.size()));
+}
+
+// Arguments: number of chains, tasks per chain and threads
+
+void sequentialSchedulerStep(State &state) {
+  schedulerStep<SequentialScheduler>(state);
+}
+DPSIM_BENCHMARK(sequentialSchedulerStep).args({1, 10}).args({10, 10});
+
+void threadLevelSchedulerStep(State &state) {
+  schedulerStep<ThreadLevelScheduler>(state, state.arg(2));
+}
+DPSIM_BENCHMARK(threadLevelSchedulerStep)
+    .args({10, 10, 2})
+    .args({10, 10, 4});
+
+void threadListSchedulerStep(State &state) {
+  schedulerStep<ThreadListScheduler>(state, state.arg(2));
+}
+DPSIM_BENCHMARK(threadListSchedulerStep).args({10, 10, 2}).args({10, 10, 4});
+
+void workStealingSchedulerStep(State &state) {
+  schedulerStep<ThreadWorkStealingScheduler>(state, state.arg(2));
+}
+DPSIM_BENCHMARK(workStealingSchedulerStep)
+    .args({10, 10, 2})
+    .args({10, 10, 4});
+
+#ifdef WITH_OPENMP
+void openMPLevelSchedulerStep(State &state) {
+  schedulerStep<OpenMPLevelScheduler>(state, state.arg(2));
+}
+DPSIM_BENCHMARK(openMPLevelSchedulerStep)
+    .args({10, 10, 2})
+    .args({10, 10, 4});
+#endif
+
+// Logger throughput for the given number of Real attributes. Stopping the
+// logger is measured as well, since it flushes the buffered rows.
+
+template <typename LoggerType>
+void loggerThroughput(State &state, std::shared_ptr<LoggerType> logger) {
+  std::vector<CPS::Attribute<Real>::Ptr> attributes;
+  for (Int idx = 0; idx < state.arg(); ++idx) {
+    attributes.push_back(CPS::AttributeStatic<Real>::make(idx));
+    logger->logAttribute("attr" + std::to_string(idx), attributes.back());
+  }
+  logger->start();
+
+  Int timeStepCount = 0;
+  while (state.keepRunning()) {
+    logger->log(timeStepCount * 1e-4, timeStepCount);
+    ++timeStepCount;
+  }
+  state.resumeTiming();
+  logger->stop();
+  state.pauseTiming();
+
+  state.setItemsProcessed(static_cast<Real>(state.iterations()) *
+                          state.arg());
+}
+
+void csvLoggerThroughput(State &state) {
+  loggerThroughput(state, DataLogger::make("benchmark_csv"));
+}
+DPSIM_BENCHMARK(csvLoggerThroughput).args({10}).args({100});
+
+void binaryLoggerThroughput(State &state) {
+  loggerThroughput(state, BinaryDataLogger::make("benchmark_binary"));
+}
+DPSIM_BENCHMARK(binaryLoggerThroughput).args({10}).args({100});
+
+void arrayLoggerThroughput(State &state) {
+  loggerThroughput(state, ArrayDataLogger::make("benchmark_array",
+                                                state.maxIterations()));
+}
+DPSIM_BENCHMARK(arrayLoggerThroughput).args({10}).args({100});
+
+} // namespace
@@ -0,0 +1,173 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <DPsim.h>
+#include <dpsim/DenseLUAdapter.h>
+#include <dpsim/SparseLUAdapter.h>
+#ifdef WITH_KLU
+#include <dpsim/KLUAdapter.h>
+#endif
+
+#include "Benchmark.h"
+#include "Grids.h"
+
+using namespace DPsim;
+using namespace DPsim::Benchmark;
+
+namespace {
+
+/// Initialized ladder grid and its MNA components, ready for stamping
+struct MnaSetup {
+  SystemTopology system;
+  std::shared_ptr<MnaSolver<Complex>> solver;
+  CPS::MNAInterface::List components;
+  UInt size;
+
+  MnaSetup(UInt sections, Real timeStep = 1e-4)
+      : system(Grids::ladder(sections)) {
+    solver = MnaSolverFactory::factory<Complex>("benchmark_mna", Domain::DP,
+                                               Logger::Level::off);
+    solver->setTimeStep(timeStep);
+    solver->setSystem(system);
+    solver->initialize();
+
+    for (auto comp : system.mComponents)
+      if (auto mnaComp = std::dynamic_pointer_cast<CPS::MNAInterface>(comp))
+        components.push_back(mnaComp);
+    size = static_cast<UInt>(solver->leftSideVector().rows());
+  }
+
+  SparseMatrix systemMatrix() {
+    SparseMatrix matrix(size, size);
+    for (auto comp : components)
+      comp->mnaApplySystemMatrixStamp(matrix);
+    matrix.makeCompressed();
+    return matrix;
+  }
+};
+
+void setProblemSize(State &state, const MnaSetup &setup,
+                    const SparseMatrix &matrix) {
+  state.setCounter("size", setup.size);
+  state.setCounter("nnz", static_cast<Real>(matrix.nonZeros()));
+}
+
+void mnaSystemMatrixStamp(State &state) {
+  MnaSetup setup(state.arg());
+  SparseMatrix matrix(setup.size, setup.size);
+  while (state.keepRunning()) {
+    matrix.setZero();
+    for (auto comp : setup.components)
+      comp->mnaApplySystemMatrixStamp(matrix);
+    matrix.makeCompressed();
+  }
+  state.setItemsProcessed(static_cast<Real>(state.iterations()) *
+                          setup.components.size());
+  setProblemSize(state, setup, matrix);
+}
+DPSIM_BENCHMARK(mnaSystemMatrixStamp).args({10}).args({100}).args({1000});
+
+void mnaRightSideVectorStamp(State &state) {
+  MnaSetup setup(state.arg());
+  Matrix rightVector = Matrix::Zero(setup.size, 1);
+  while (state.keepRunning()) {
+    rightVector.setZero();
+    for (auto comp : setup.components)
+      comp->mnaApplyRightSideVectorStamp(rightVector);
+  }
+  state.setItemsProcessed(static_cast<Real>(state.iterations()) *
+                          setup.components.size());
+  state.setCounter("size", setup.size);
+}
+DPSIM_BENCHMARK(mnaRightSideVectorStamp).args({10}).args({100}).args({1000});
+
+// Each adapter is measured on the same system matrix. The dense adapter is
+// only run on the smaller grids, because it scales cubically.
+
+template <typename Adapter> std::shared_ptr<DirectLinearSolver> makeAdapter() {
+  return std::make_shared<Adapter>(
+      CPS::Logger::get("benchmark_adapter", Logger::Level::off));
+}
+
+template <typename Adapter> void adapterFactorize(State &state) {
+  MnaSetup setup(state.arg());
+  auto matrix = setup.systemMatrix();
+  std::vector<std::pair<UInt, UInt>> variableEntries;
+  while (state.keepRunning()) {
+    auto adapter = makeAdapter<Adapter>();
+    adapter->preprocessing(matrix, variableEntries);
+    adapter->factorize(matrix);
+  }
+  setProblemSize(state, setup, matrix);
+}
+
+template <typename Adapter> void adapterRefactorize(State &state) {
+  MnaSetup setup(state.arg());
+  auto matrix = setup.systemMatrix();
+  std::vector<std::pair<UInt, UInt>> variableEntries;
+  auto adapter = makeAdapter<Adapter>();
+  adapter->preprocessing(matrix, variableEntries);
+  adapter->factorize(matrix);
+  while (state.keepRunning())
+    adapter->refactorize(matrix);
+  setProblemSize(state, setup, matrix);
+}
+
+template <typename Adapter> void adapterSolve(State &state) {
+  MnaSetup setup(state.arg());
+  auto matrix = setup.systemMatrix();
+  std::vector<std::pair<UInt, UInt>> variableEntries;
+  auto adapter = makeAdapter<Adapter>();
+  adapter->preprocessing(matrix, variableEntries);
+  adapter->factorize(matrix);
+
+  Matrix rightVector = Matrix::Zero(setup.size, 1);
+  for (auto comp : setup.components)
+    comp->mnaApplyRightSideVectorStamp(rightVector);
+  Matrix leftVector = Matrix::Zero(setup.size, 1);
+  while (state.keepRunning())
+    adapter->solve(rightVector, leftVector);
+  setProblemSize(state, setup, matrix);
+}
+
+void denseLUFactorize(State &state) { adapterFactorize<DenseLUAdapter>(state); }
+DPSIM_BENCHMARK(denseLUFactorize).args({10}).args({100});
+
+void denseLURefactorize(State &state) {
+  adapterRefactorize<DenseLUAdapter>(state);
+}
+DPSIM_BENCHMARK(denseLURefactorize).args({10}).args({100});
+
+void denseLUSolve(State &state) { adapterSolve<DenseLUAdapter>(state); }
+DPSIM_BENCHMARK(denseLUSolve).args({10}).args({100});
+
+void sparseLUFactorize(State &state) {
+  adapterFactorize<SparseLUAdapter>(state);
+}
+DPSIM_BENCHMARK(sparseLUFactorize).args({10}).args({100}).args({1000});
+
+void sparseLURefactorize(State &state) {
+  adapterRefactorize<SparseLUAdapter>(state);
+}
+DPSIM_BENCHMARK(sparseLURefactorize).args({10}).args({100}).args({1000});
+
+void sparseLUSolve(State &state) { adapterSolve<SparseLUAdapter>(state); }
+DPSIM_BENCHMARK(sparseLUSolve).args({10}).args({100}).args({1000});
+
+#ifdef WITH_KLU
+void kluFactorize(State &state) { adapterFactorize<KLUAdapter>(state); }
+DPSIM_BENCHMARK(kluFactorize).args({10}).args({100}).args({1000});
+
+void kluRefactorize(State &state) { adapterRefactorize<KLUAdapter>(state); }
+DPSIM_BENCHMARK(kluRefactorize).args({10}).args({100}).args({1000});
+
+void kluSolve(State &state) { adapterSolve<KLUAdapter>(state); }
+DPSIM_BENCHMARK(kluSolve).args({10}).args({100}).args({1000});
+#endif
+
+} // namespace
@@ -7,6 +7,7 @@
  *********************************************************************************/
 
 #include <dpsim/Config.h>
+#include <dpsim/BatchSimulation.h>
 #include <dpsim/Simulation.h>
 #include <dpsim/Utils.h>
 
@@ -0,0 +1,89 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include <dpsim-models/Attribute.h>
+#include <dpsim-models/PtrFactory.h>
+#include <dpsim-models/Task.h>
+#include <dpsim/DataLoggerInterface.h>
+#include <dpsim/Definitions.h>
+#include <dpsim/Scheduler.h>
+
+namespace DPsim {
+
+/// Data logger recording attribute values into a preallocated in-memory
+/// array, with one row per logged step and the time in the first column.
+/// The array is row-major so that it can be shared with NumPy without
+/// copying. Steps beyond the capacity are dropped.
+class ArrayDataLogger : public DataLoggerInterface,
+                        public SharedFactory<ArrayDataLogger> {
+public:
+  typedef std::shared_ptr<ArrayDataLogger> Ptr;
+
+  ArrayDataLogger(String name, UInt capacity, UInt downsampling = 1);
+
+  virtual void start() override;
+  virtual void stop() override;
+
+  virtual void log(Real time, Int timeStepCount) override;
+
+  virtual CPS::Task::Ptr getTask() override;
+
+  /// Discards the recorded rows, keeping the allocated array
+  void reset();
+  /// Number of recorded rows
+  UInt rows() const { return mRows.load(std::memory_order_acquire); }
+  ///
+  UInt capacity() const { return mCapacity; }
+  /// Number of steps which did not fit into the array
+  UInt droppedRows() const { return mDroppedRows; }
+  /// Names of the columns including time
+  const std::vector<String> &columnNames() const { return mColumnNames; }
+  /// Complete array, only the first rows() rows are valid
+  CPS::MatrixRow &data() { return *mData; }
+  /// Shared ownership of the array for views that outlive a restart. The
+  /// array is kept by start() as long as the columns do not change.
+  std::shared_ptr<CPS::MatrixRow> dataBuffer() const { return mData; }
+
+  class Step : public CPS::Task {
+  public:
+    Step(ArrayDataLogger &logger)
+        : Task(logger.mName + ".Record"), mLogger(logger) {
+      for (auto attr : logger.mAttributes) {
+        mAttributeDependencies.push_back(attr.second);
+      }
+      mModifiedAttributes.push_back(Scheduler::external);
+    }
+
+    void execute(Real time, Int timeStepCount);
+
+  private:
+    ArrayDataLogger &mLogger;
+  };
+
+protected:
+  String mName;
+  UInt mCapacity;
+  UInt mDownsampling;
+
+  /// Attributes in column order, resolved on start
+  std::vector<CPS::Attribute<Real>::Ptr> mRealColumns;
+  std::vector<CPS::Attribute<Int>::Ptr> mIntColumns;
+  /// Column type of each attribute column, true for Int
+  std::vector<Bool> mIsIntColumn;
+  std::vector<String> mColumnNames;
+
+  std::shared_ptr<CPS::MatrixRow> mData;
+  std::atomic<UInt> mRows{0};
+  UInt mDroppedRows = 0;
+};
+} // namespace DPsim
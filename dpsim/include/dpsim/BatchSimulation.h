@@ -0,0 +1,80 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include <dpsim-models/Logger.h>
+#include <dpsim/Checkpoint.h>
+#include <dpsim/DataLoggerInterface.h>
+#include <dpsim/Definitions.h>
+#include <dpsim/Simulation.h>
+#include <dpsim/SymbolicAnalysisCache.h>
+
+namespace DPsim {
+
+/// Runs many variants (scenarios) of the same topology, e.g. for contingency
+/// screening or Monte Carlo studies, in parallel on a pool of threads.
+/// All scenarios share the symbolic analysis of their system matrices, so
+/// that only the first scenario of each matrix pattern pays for the ordering.
+class BatchSimulation {
+public:
+  /// Creates the prepared simulation of a scenario, e.g. the base grid with
+  /// the parameters, faults or switch events of the scenario. It is called
+  /// concurrently from the worker threads. Each scenario logs into its own
+  /// directory <log dir>/<batch name>_<scenario>, so simulations, components
+  /// and data loggers may have the same names in all scenarios.
+  using ScenarioFactory = std::function<Simulation::Ptr(UInt scenario)>;
+
+  /// Outcome of a single scenario
+  struct ScenarioResult {
+    UInt scenario;
+    Bool success;
+    /// Exception message of failed scenarios
+    String error;
+    /// Wall clock time for setup and simulation
+    Real duration;
+    /// Loggers of the simulation, e.g. ArrayDataLoggers with the results
+    DataLoggerInterface::List loggers;
+  };
+
+  BatchSimulation(String name, ScenarioFactory factory,
+                  CPS::Logger::Level logLevel = CPS::Logger::Level::info);
+
+  /// Number of worker threads, defaults to the number of hardware threads
+  void setThreads(UInt threads) { mThreads = threads; }
+  /// Continue all scenarios from the checkpoint instead of the initial state,
+  /// so that the initialization transient is only simulated once. Scenarios
+  /// keep their own parameters and only take over the state.
+  void setCheckpoint(Checkpoint::Ptr checkpoint) { mCheckpoint = checkpoint; }
+
+  /// Runs the scenarios 0 to numScenarios - 1 and returns their results in
+  /// scenario order. Failing scenarios do not abort the batch.
+  std::vector<ScenarioResult> run(UInt numScenarios);
+
+  /// Shared symbolic analyses, e.g. to check the number of reuses
+  SymbolicAnalysisCache::Ptr symbolicAnalysisCache() const {
+    return mSymbolicAnalysisCache;
+  }
+
+private:
+  /// Sets up, runs and stops the simulation of a scenario
+  ScenarioResult runScenario(UInt scenario);
+
+  String mName;
+  ScenarioFactory mFactory;
+  UInt mThreads;
+  SymbolicAnalysisCache::Ptr mSymbolicAnalysisCache;
+  Checkpoint::Ptr mCheckpoint;
+  CPS::Logger::Log mLog;
+  /// Log directory of the batch, which contains the scenario directories
+  String mLogDir;
+};
+} // namespace DPsim
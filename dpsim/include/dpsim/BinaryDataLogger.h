@@ -0,0 +1,121 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <dpsim-models/Attribute.h>
+#include <dpsim-models/Filesystem.h>
+#include <dpsim-models/PtrFactory.h>
+#include <dpsim-models/Task.h>
+#include <dpsim/DataLoggerInterface.h>
+#include <dpsim/Definitions.h>
+#include <dpsim/Scheduler.h>
+
+namespace DPsim {
+
+/// Data logger writing raw values into a chunked, columnar binary file.
+///
+/// File layout, values in host byte order:
+/// - header: magic "DPSIMBIN", uint32 byte order mark BYTE_ORDER_MARK,
+///   uint32 version, uint32 number of columns
+///   (including time), uint32 rows per chunk, then for every column a
+///   uint32 name length followed by the name
+/// - chunks: uint32 number of rows, followed by the values of each column
+///   as consecutive float64 blocks of that length
+///
+/// Full chunks are written to disk by a background thread.
+/// Use dpsim.binarylog.read_binary_log to load the file in Python.
+class BinaryDataLogger : public DataLoggerInterface,
+                         public SharedFactory<BinaryDataLogger> {
+public:
+  typedef std::shared_ptr<BinaryDataLogger> Ptr;
+
+  static constexpr const char *MAGIC = "DPSIMBIN";
+  static constexpr UInt VERSION = 2;
+  /// Written in host byte order so that readers can detect the byte order
+  static constexpr std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+  BinaryDataLogger(String name, Bool enabled = true, UInt downsampling = 1,
+                   UInt chunkRows = 4096);
+  virtual ~BinaryDataLogger();
+
+  virtual void start() override;
+  virtual void stop() override;
+
+  virtual void log(Real time, Int timeStepCount) override;
+
+  virtual CPS::Task::Ptr getTask() override;
+
+  ///
+  const fs::path &filename() const { return mFilename; }
+
+  class Step : public CPS::Task {
+  public:
+    Step(BinaryDataLogger &logger)
+        : Task(logger.mName + ".Write"), mLogger(logger) {
+      for (auto attr : logger.mAttributes) {
+        mAttributeDependencies.push_back(attr.second);
+      }
+      mModifiedAttributes.push_back(Scheduler::external);
+    }
+
+    void execute(Real time, Int timeStepCount);
+
+  private:
+    BinaryDataLogger &mLogger;
+  };
+
+protected:
+  struct Chunk {
+    std::vector<Real> data;
+    UInt rows = 0;
+  };
+
+  /// Hands the current chunk over to the writer thread
+  void submitChunk();
+  /// Writes the header with the column names
+  void writeHeader();
+  ///
+  void writeChunk(const Chunk &chunk);
+  ///
+  static void writerFunction(BinaryDataLogger *logger);
+
+  String mName;
+  Bool mEnabled;
+  UInt mDownsampling;
+  UInt mChunkRows;
+  fs::path mFilename;
+  std::ofstream mLogFile;
+
+  /// Attributes in column order, resolved on start
+  std::vector<CPS::Attribute<Real>::Ptr> mRealColumns;
+  std::vector<CPS::Attribute<Int>::Ptr> mIntColumns;
+  /// Column type of each attribute column, true for Int
+  std::vector<Bool> mIsIntColumn;
+  UInt mNumColumns = 0;
+
+  Chunk mCurrentChunk;
+  /// Chunks waiting to be written
+  std::deque<Chunk> mFullChunks;
+  /// Written chunks that can be reused without allocation
+  std::vector<Chunk> mFreeChunks;
+  std::mutex mMutex;
+  std::condition_variable mCondition;
+  std::thread mWriterThread;
+  Bool mStopping = false;
+  Bool mRunning = false;
+};
+} // namespace DPsim
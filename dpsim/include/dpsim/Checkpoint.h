@@ -0,0 +1,84 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <dpsim-models/Attribute.h>
+#include <dpsim-models/Filesystem.h>
+#include <dpsim/Definitions.h>
+
+namespace DPsim {
+
+/// Snapshot of the state of a simulation between two steps: the simulation
+/// time and the values of the state attributes declared by the nodes,
+/// components and solvers, e.g. interface voltages and currents and switch
+/// states. A checkpoint is applied to a simulation with the same topology
+/// after its initialization, which then continues from the time of the
+/// checkpoint with its own parameters.
+class Checkpoint {
+public:
+  typedef std::shared_ptr<Checkpoint> Ptr;
+
+  static constexpr const char *MAGIC = "DPSIMCKP";
+  static constexpr UInt VERSION = 3;
+
+  Checkpoint() = default;
+  Checkpoint(Real time, Int timeStepCount)
+      : mTime(time), mTimeStepCount(timeStepCount) {}
+
+  /// Copies the values of the state attributes. Throws if the type of an
+  /// attribute is not supported.
+  void capture(const CPS::AttributeBase::Map &attributes);
+  /// Writes the stored values into the attributes with the same path.
+  /// Throws if an attribute is missing or its type or size differs.
+  void apply(const CPS::AttributeBase::Map &attributes) const;
+
+  /// Writes the checkpoint to a compact binary file
+  void write(const fs::path &filename) const;
+  /// Reads a checkpoint written by write
+  static Ptr read(const fs::path &filename);
+
+  /// Time of the next step to compute
+  Real time() const { return mTime; }
+  ///
+  Int timeStepCount() const { return mTimeStepCount; }
+  /// Number of stored attribute values
+  UInt size() const { return static_cast<UInt>(mValues.size()); }
+
+private:
+  enum class Type : std::uint8_t {
+    Real,
+    Complex,
+    Int,
+    UInt,
+    Bool,
+    Matrix,
+    MatrixComp
+  };
+
+  struct Value {
+    Type type;
+    std::uint32_t rows;
+    std::uint32_t cols;
+    std::vector<char> data;
+  };
+
+  /// Copies the value of a supported attribute, returns false otherwise
+  static Bool toValue(const CPS::AttributeBase::Ptr &attr, Value &value);
+
+  Real mTime = 0;
+  Int mTimeStepCount = 0;
+  /// Values by attribute path
+  std::map<String, Value> mValues;
+};
+} // namespace DPsim
@@ -23,6 +23,10 @@
 #include <nvector/nvector_serial.h>
 #include <sundials/sundials_types.h>
 #include <sunlinsol/sunlinsol_dense.h>
+#ifdef WITH_SUNDIALS_KLU
+#include <sunlinsol/sunlinsol_klu.h>
+#include <sunmatrix/sunmatrix_sparse.h>
+#endif
 
 namespace DPsim {
 
@@ -65,6 +69,23 @@ protected:
   long int interalSteps = 0;
   long int resEval = 0;
   std::vector<CPS::DAEInterface::ResFn> mResidualFunctions;
+  std::vector<CPS::DAEInterface::JacFn> mJacobianFunctions;
+
+  // Sparse Jacobian
+  /// Use a sparse Jacobian and the KLU linear solver instead of dense matrices
+  Bool mSparseJacobian;
+  /// All components provide analytic Jacobians
+  Bool mAnalyticJacobian = false;
+  /// Jacobian dF/dy + cj * dF/dy' with the sparsity pattern of the system
+  CPS::SparseMatrix mJacobian;
+  /// Columns without common rows, which are perturbed at once for the
+  /// finite difference approximation of the Jacobian
+  std::vector<std::vector<Int>> mColumnGroups;
+  /// Buffers for finite differences
+  std::vector<Real> mPerturbedState;
+  std::vector<Real> mPerturbedDerivative;
+  std::vector<Real> mPerturbedResidual;
+  std::vector<Real> mIncrements;
 
   /// Residual Function of entire System
   static int residualFunctionWrapper(realtype ttime, N_Vector state,
@@ -72,10 +93,39 @@ protected:
                                      void *user_data);
   int residualFunction(realtype ttime, N_Vector state, N_Vector dstate_dt,
                        N_Vector resid);
+  void evaluateResidual(realtype ttime, const double state[],
+                        const double dstate_dt[], double resid[]);
+
+  /// Determine the sparsity pattern and set up the sparse linear solver
+  void initializeSparseJacobian();
+  /// Sparsity pattern from the residuals' response to perturbations of each
+  /// variable at several points, dense if the points disagree
+  void detectSparsityPattern(const double state[], const double dstate_dt[]);
+  /// Greedy coloring of the Jacobian columns
+  void computeColumnGroups();
+  void evaluateAnalyticJacobian(realtype ttime, realtype cj,
+                                const double state[], const double dstate_dt[]);
+  void evaluateFiniteDifferenceJacobian(realtype ttime, realtype cj,
+                                        const double state[],
+                                        const double dstate_dt[],
+                                        const double resid[]);
+
+#ifdef WITH_SUNDIALS_KLU
+  /// Jacobian Function of entire System
+  static int jacobianFunctionWrapper(realtype ttime, realtype cj,
+                                     N_Vector state, N_Vector dstate_dt,
+                                     N_Vector resid, SUNMatrix J,
+                                     void *user_data, N_Vector tmp1,
+                                     N_Vector tmp2, N_Vector tmp3);
+  int jacobianFunction(realtype ttime, realtype cj, N_Vector state,
+                       N_Vector dstate_dt, N_Vector resid, SUNMatrix J);
+#endif
 
 public:
-  /// Create solve object with given parameters
-  DAESolver(String name, const CPS::SystemTopology &system, Real dt, Real mT0);
+  /// Create solve object with given parameters. The sparse Jacobian
+  /// requires sundials with KLU support, dense matrices are used otherwise.
+  DAESolver(String name, const CPS::SystemTopology &system, Real dt, Real mT0,
+            Bool sparseJacobian = true);
   /// Deallocate all memory
   ~DAESolver();
   /// Initialize Components & Nodes with initial values
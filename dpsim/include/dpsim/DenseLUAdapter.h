@@ -48,5 +48,8 @@ public:
 
   /// solution function for a right hand side
   Matrix solve(Matrix &rightSideVector) override;
+
+  /// solution function writing into a preallocated left side vector
+  void solve(Matrix &rightSideVector, Matrix &leftSideVector) override;
 };
 } // namespace DPsim
@@ -12,6 +12,9 @@
 #include <dpsim-models/SimSignalComp.h>
 #include <dpsim-models/Solver/MNAInterface.h>
 #include <dpsim/DataLogger.h>
+#include <dpsim/DirectLinearSolver.h>
+#include <dpsim/DirectLinearSolverConfiguration.h>
+#include <dpsim/MNASolverDirect.h>
 #include <dpsim/Solver.h>
 
 #include <unordered_map>
@@ -35,8 +38,14 @@ private:
     UInt mVirtualNodeNum;
     /// Offset of block in system matrix
     UInt sysOff;
-    /// Factorization of the subnet's block
-    CPS::LUFactorized luFactorization;
+    /// Sparse system matrix block of the subnet
+    CPS::SparseMatrixRow sysMatrix;
+    /// Linear solver holding the factorization of the subnet's block
+    std::shared_ptr<DirectLinearSolver> solver;
+    /// Preallocated right side vector for the subnet's solves
+    Matrix rightVector;
+    /// Preallocated solution vector for the subnet's solves
+    Matrix solution;
     /// List of all right side vector contributions
     std::vector<const Matrix *> rightVectorStamps;
     /// Left-side vector of the subnet AFTER complete step
@@ -59,14 +68,15 @@ private:
   typename CPS::SimPowerComp<VarType>::List mTearComponents;
   CPS::SimSignalComp::List mSimSignalComps;
 
+  /// Linear solver implementation used for the subnets
+  DirectLinearSolverImpl mImplementationInUse;
+  /// Linear solver configuration used for the subnets
+  DirectLinearSolverConfiguration mConfigurationInUse;
+
   Matrix mRightSideVector;
   Matrix mLeftSideVector;
-  /// Complete matrix in block form
-  Matrix mSystemMatrix;
-  /// Inverse of the complete system matrix (only used for initialization)
-  Matrix mSystemInverse;
   /// Topology of the network removal
-  Matrix mTearTopology;
+  CPS::SparseMatrix mTearTopology;
   /// Impedance of the removed network
   CPS::SparseMatrixRow mTearImpedance;
   /// (Factorization of the) impedance matrix for the removed network, including
@@ -93,6 +103,8 @@ private:
 
   void initMatrices();
   void applyTearComponentStamp(UInt compIdx);
+  /// Creates a linear solver of the configured implementation
+  std::shared_ptr<DirectLinearSolver> createDirectSolverImplementation();
 
   void log(Real time, Int timeStepCount) override;
 
@@ -105,7 +117,11 @@ public:
 
   DiakopticsSolver(String name, CPS::SystemTopology system,
                    CPS::IdentifiedObject::List tearComponents, Real timeStep,
-                   CPS::Logger::Level logLevel);
+                   CPS::Logger::Level logLevel,
+                   DirectLinearSolverImpl implementation =
+                       DirectLinearSolverImpl::Undef,
+                   const DirectLinearSolverConfiguration &configuration =
+                       DirectLinearSolverConfiguration());
 
   CPS::Task::List getTasks() override;
 
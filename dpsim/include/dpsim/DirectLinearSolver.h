@@ -18,6 +18,7 @@
 #include <dpsim/Config.h>
 #include <dpsim/Definitions.h>
 #include <dpsim/DirectLinearSolverConfiguration.h>
+#include <dpsim/SymbolicAnalysisCache.h>
 
 namespace DPsim {
 class DirectLinearSolver {
@@ -64,12 +65,25 @@ public:
   /// solution function for a right hand side
   virtual Matrix solve(Matrix &rightSideVector) = 0;
 
+  /// solution function writing into a preallocated left side vector
+  /// of matching size, which avoids allocations in the simulation loop
+  virtual void solve(Matrix &rightSideVector, Matrix &leftSideVector) {
+    // fallback for solvers without an allocation-free implementation
+    leftSideVector = solve(rightSideVector);
+  }
+
   virtual void
   setConfiguration(DirectLinearSolverConfiguration &configuration) {
     mConfiguration = configuration;
     this->applyConfiguration();
   }
 
+  /// Share symbolic analyses with other solvers of the same matrix pattern,
+  /// only used by implementations which separate the analysis
+  void setSymbolicAnalysisCache(SymbolicAnalysisCache::Ptr cache) {
+    mSymbolicAnalysisCache = cache;
+  }
+
 protected:
   /// Stores logger of solver class
   CPS::Logger::Log mSLog;
@@ -77,6 +91,9 @@ protected:
   /// Object that carries configuration options
   DirectLinearSolverConfiguration mConfiguration;
 
+  /// Symbolic analyses shared between solvers, may be null
+  SymbolicAnalysisCache::Ptr mSymbolicAnalysisCache;
+
   virtual void applyConfiguration() {
     // no default application, configuration options vary for each solver
     // warn user that no configuration setting is used
@@ -113,7 +113,13 @@ protected:
 public:
   ///
   void addEvent(Event::Ptr e);
-  ///
-  void handleEvents(CPS::Real currentTime);
+  /// Executes the events due at the current time and returns whether there
+  /// were any
+  CPS::Bool handleEvents(CPS::Real currentTime);
+  /// Time of the next pending event, infinity if there is none
+  CPS::Real nextEventTime() const;
+  /// Discards the events handleEvents would execute at the given time,
+  /// e.g. because their effect is contained in a restored checkpoint
+  void skipEvents(CPS::Real currentTime);
 };
 } // namespace DPsim
@@ -89,5 +89,6 @@ public:
 
   /// solution function for a right hand side
   virtual Matrix solve(Matrix &rightSideVector) override;
+  using DirectLinearSolver::solve;
 };
 } // namespace DPsim
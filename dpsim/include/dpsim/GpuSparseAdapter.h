@@ -84,5 +84,6 @@ public:
 
   /// solution function for a right hand side
   virtual Matrix solve(Matrix &rightSideVector) override;
+  using DirectLinearSolver::solve;
 };
 } // namespace DPsim
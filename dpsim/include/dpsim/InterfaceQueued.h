@@ -76,6 +76,16 @@ protected:
   std::shared_ptr<moodycamel::BlockingReaderWriterQueue<AttributePacket>> mQueueDpsimToInterface;
   std::shared_ptr<moodycamel::BlockingReaderWriterQueue<AttributePacket>> mQueueInterfaceToDpsim;
 
+  // Number of preallocated value slots per exported attribute
+  static constexpr UInt EXPORT_SLOTS = 4;
+  // Recycled attributes the exported values are copied into, one list per exported attribute.
+  // A slot can be reused as soon as no queued or retained packet references it anymore.
+  std::vector<std::vector<std::shared_ptr<CPS::AttributeBase>>> mExportSlots;
+  std::vector<UInt> mNextExportSlot;
+
+  // Returns a slot of the exported attribute that is not referenced by any packet
+  std::shared_ptr<CPS::AttributeBase> &acquireExportSlot(UInt attrIdx);
+
 public:
   class WriterThread {
   private:
@@ -38,6 +38,9 @@ class KLUAdapter : public DirectLinearSolver {
   klu_common mCommon;
   klu_numeric *mNumeric = nullptr;
   klu_symbolic *mSymbolic = nullptr;
+  /// Keeps the symbolic analysis from the cache alive, mSymbolic then points
+  /// to it and must not be freed by this adapter
+  std::shared_ptr<void> mSharedSymbolic;
 
   /// Flags to indicate mode of operation
   /// Define which ordering to choose in preprocessing
@@ -82,7 +85,13 @@ public:
   /// solution function for a right hand side
   Matrix solve(Matrix &rightSideVector) override;
 
+  /// solution function writing into a preallocated left side vector
+  void solve(Matrix &rightSideVector, Matrix &leftSideVector) override;
+
 protected:
+  /// Releases the symbolic analysis, unless it is shared
+  void freeSymbolic();
+
   /// Function to print matrix in MatrixMarket's coo format
   void printMatrixMarket(SparseMatrix &systemMatrix, int counter) const;
 
@@ -0,0 +1,63 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include <dpsim/Definitions.h>
+
+namespace DPsim {
+/// Fixed-size histogram of durations with logarithmic buckets, similar to
+/// an HDR histogram. Every power of two is split into 2^SUB_BUCKET_BITS
+/// linear sub-buckets, which bounds the relative error of the percentiles
+/// to about 3%. Durations above MAX_EXPONENT are counted in the last bucket.
+///
+/// There must be only a single thread recording values, but the
+/// statistics can be read concurrently at any time.
+class LatencyHistogram {
+public:
+  typedef std::chrono::steady_clock::duration Duration;
+
+  static constexpr UInt SUB_BUCKET_BITS = 5;
+  static constexpr UInt SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+  /// Largest tracked duration is 2^MAX_EXPONENT ns (about 18 minutes)
+  static constexpr UInt MAX_EXPONENT = 40;
+  static constexpr UInt NUM_BUCKETS =
+      (MAX_EXPONENT - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+
+  LatencyHistogram() { reset(); }
+
+  /// Adds a duration. Allocation and lock free.
+  void record(Duration duration);
+  /// Clears all counters, must not be called concurrently to record
+  void reset();
+
+  /// Number of recorded durations
+  std::uint64_t count() const {
+    return mCount.load(std::memory_order_relaxed);
+  }
+  Duration mean() const;
+  Duration max() const;
+  /// Upper bound of the bucket containing the given quantile in [0, 1]
+  Duration percentile(Real quantile) const;
+
+private:
+  static UInt bucketIndex(std::uint64_t value);
+  static std::uint64_t bucketUpperBound(UInt index);
+
+  std::array<std::atomic<std::uint64_t>, NUM_BUCKETS> mBuckets;
+  std::atomic<std::uint64_t> mCount;
+  /// Sum of all recorded durations in ns
+  std::atomic<std::uint64_t> mSum;
+  std::atomic<std::uint64_t> mMax;
+};
+} // namespace DPsim
@@ -15,12 +15,16 @@
 #include <vector>
 
 #include <dpsim-models/AttributeList.h>
+#include <dpsim-models/SP/SP_Ph1_SynchronGeneratorVBRGroup.h>
 #include <dpsim-models/SimPowerComp.h>
 #include <dpsim-models/SimSignalComp.h>
 #include <dpsim-models/Solver/MNAInterface.h>
+#include <dpsim-models/Solver/MNALocalRightVectorInterface.h>
 #include <dpsim-models/Solver/MNASwitchInterface.h>
 #include <dpsim-models/Solver/MNASyncGenInterface.h>
+#include <dpsim-models/Solver/MNATimeStepIndependentInterface.h>
 #include <dpsim-models/Solver/MNAVariableCompInterface.h>
+#include <dpsim-models/Solver/MNAVariableTimeStepInterface.h>
 #include <dpsim/Config.h>
 #include <dpsim/DataLogger.h>
 #include <dpsim/Solver.h>
@@ -83,6 +87,9 @@ protected:
   Matrix mRightSideVector;
   /// List of all right side vector contributions
   std::vector<const Matrix *> mRightVectorStamps;
+  /// Right side vector entries each contribution can stamp into.
+  /// An empty list denotes a contribution that is added as dense vector.
+  std::vector<std::vector<UInt>> mRightVectorStampIndices;
 
   // #### MNA specific attributes related to harmonics / additional frequencies ####
   /// Source vector of known quantities
@@ -96,6 +103,19 @@ protected:
   CPS::MNAVariableCompInterface::List mVariableComps;
   /// List of variable components if they must be accessed as MNAInterface objects
   CPS::MNAInterface::List mMNAIntfVariableComps;
+  /// Groups of generators that replace the tasks of their members
+  CPS::SP::Ph1::SynchronGeneratorVBRGroup::List mGeneratorGroups;
+
+  // #### Attributes related to variable time steps ####
+  /// Components with a time step dependent companion model
+  CPS::MNAVariableTimeStepInterface::List mVariableTimeStepComps;
+  /// Solutions of the two previous steps for the step error estimate
+  Matrix mPrevLeftSideVector;
+  Matrix mPrevPrevLeftSideVector;
+  /// Time step between the two previous solutions
+  Real mPrevTimeStep = 0;
+  /// Number of previous solutions available for the error estimate
+  UInt mNumPrevLeftSideVectors = 0;
 
   // #### Attributes related to switching ####
   /// Index of the next switching event
@@ -132,6 +152,8 @@ protected:
   void initializeSystemWithParallelFrequencies();
   /// Initialization of system matrices and source vector
   void initializeSystemWithPrecomputedMatrices();
+  /// Stamps and factorizes the system matrices of the switch states
+  void stampPrecomputedSystemMatrices();
   /// Initialization of system matrices and source vector
   void initializeSystemWithVariableMatrix();
   /// Identify Nodes and SimPowerComps and SimSignalComps
@@ -143,6 +165,9 @@ protected:
   void collectVirtualNodes();
   // TODO: check if this works with AC sources
   void steadyStateInitialization();
+  /// Collects the components with a time step dependent companion model and
+  /// rejects the components that cannot change their time step
+  void collectVariableTimeStepComponents();
 
   /// Create left and right side vector
   void createEmptyVectors();
@@ -163,6 +188,15 @@ protected:
   /// Checks whether the status of variable MNA elements have changed
   Bool hasVariableComponentChanged();
 
+  // #### Right side vector assembly ####
+  /// Registers the right side vector contribution of a component
+  void addRightVectorStamp(CPS::MNAInterface::Ptr comp, const Matrix &stamp);
+  /// Determines the right side vector entries a component can stamp into
+  std::vector<UInt> rightVectorStampIndices(CPS::MNAInterface::Ptr comp,
+                                            const Matrix &stamp);
+  /// Sums up the right side vector contributions only at their entries
+  void assembleRightSideVector();
+
   // #### Methods to implement for system recomputation over time ####
   /// Stamps components into the variable system matrix
   virtual void stampVariableSystemMatrix() = 0;
@@ -212,10 +246,26 @@ public:
   ///
   virtual void setSystem(const CPS::SystemTopology &system) override;
   ///
+  virtual void setSwitchEvents(
+      const std::vector<SwitchConfiguration> &switchEvents) override {
+    mSwitchEvents = switchEvents;
+  }
+  ///
   Matrix &leftSideVector() { return **mLeftSideVector; }
   ///
   Matrix &rightSideVector() { return mRightSideVector; }
   ///
   virtual CPS::Task::List getTasks() override;
+  /// Solution vectors, the right side vector is assembled in every step
+  virtual CPS::AttributeBase::Map stateAttributes() override {
+    CPS::AttributeBase::Map attributes = {{"left_vector", mLeftSideVector}};
+    for (UInt freq = 0; freq < mLeftSideVectorHarm.size(); ++freq)
+      attributes["left_vector_" + std::to_string(freq)] =
+          mLeftSideVectorHarm[freq];
+    return attributes;
+  }
+  /// Deviation of the solution from the linear extrapolation of the two
+  /// previous solutions, relative to the largest solution entry
+  virtual Real stepErrorEstimate() override;
 };
 } // namespace DPsim
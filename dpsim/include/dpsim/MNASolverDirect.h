@@ -8,10 +8,14 @@
 
 #pragma once
 
+#include <atomic>
 #include <bitset>
 #include <iostream>
 #include <list>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -67,6 +71,45 @@ protected:
                      std::vector<std::shared_ptr<DirectLinearSolver>>>
       mDirectLinearSolvers;
 
+  // #### Data structures for lazily factorized switch matrices ####
+  /// Dimension of the switched system matrices
+  UInt mSwitchedMatrixDim = 0;
+  /// Switch status the cached system matrices were last selected for
+  std::bitset<SWITCH_NUM> mActiveSwitchStatus;
+  /// Switch states of the cached system matrices, most recently used first
+  std::list<std::bitset<SWITCH_NUM>> mSwitchedMatrixUsage;
+  /// Position of each cached switch status in the usage list
+  std::unordered_map<std::bitset<SWITCH_NUM>,
+                     std::list<std::bitset<SWITCH_NUM>>::iterator>
+      mSwitchedMatrixUsagePos;
+  /// System matrices and factorizations prepared by the prewarming thread
+  std::unordered_map<std::bitset<SWITCH_NUM>,
+                     std::pair<SparseMatrix, std::shared_ptr<DirectLinearSolver>>>
+      mPrewarmedSystems;
+  /// Protects the prewarmed systems shared with the prewarming thread
+  std::mutex mPrewarmMutex;
+  /// Background thread factorizing the systems of scheduled switch events
+  std::thread mPrewarmThread;
+  /// Signals the prewarming thread to terminate
+  std::atomic<bool> mStopPrewarming{false};
+
+  // #### Data structures for variable time steps ####
+  /// System matrices and factorizations of a time step not in use
+  struct TimeStepSystems {
+    std::unordered_map<std::bitset<SWITCH_NUM>, std::vector<SparseMatrix>>
+        matrices;
+    std::unordered_map<std::bitset<SWITCH_NUM>,
+                       std::vector<std::shared_ptr<DirectLinearSolver>>>
+        solvers;
+    std::list<std::bitset<SWITCH_NUM>> usage;
+    std::unordered_map<std::bitset<SWITCH_NUM>,
+                       std::list<std::bitset<SWITCH_NUM>>::iterator>
+        usagePos;
+    std::bitset<SWITCH_NUM> activeSwitchStatus;
+  };
+  /// Systems of the previously used time steps, by time step
+  std::map<Real, TimeStepSystems> mTimeStepSystems;
+
   // #### Data structures for system recomputation over time ####
   /// System matrix including all static elements
   SparseMatrix mBaseSystemMatrix;
@@ -103,6 +146,14 @@ protected:
   using MnaSolver<VarType>::mSolveTimes;
   using MnaSolver<VarType>::mRecomputationTimes;
   using MnaSolver<VarType>::mListVariableSystemMatrixEntries;
+  using MnaSolver<VarType>::mSwitchEvents;
+  using MnaSolver<VarType>::mVariableTimeStepComps;
+  using MnaSolver<VarType>::mSystem;
+  using Solver::mTimeStep;
+  using Solver::mVariableTimeStep;
+  using Solver::mLazySwitchedMatrices;
+  using Solver::mSwitchedMatrixCacheSize;
+  using Solver::mSwitchedMatrixPrewarming;
 
   // #### General
   /// Create system matrix
@@ -117,6 +168,34 @@ protected:
   void switchedMatrixStamp(
       std::size_t index,
       std::vector<std::shared_ptr<CPS::MNAInterface>> &comp) override;
+  /// Stamps components and switches into the matrix and factorizes it.
+  /// Returns the factorization time.
+  Real stampAndFactorize(const std::bitset<SWITCH_NUM> &bit,
+                         std::vector<std::shared_ptr<CPS::MNAInterface>> &comp,
+                         SparseMatrix &sys, DirectLinearSolver &solver);
+  /// Stamps components and switches into the matrix
+  void
+  stampSwitchedSystem(const std::bitset<SWITCH_NUM> &bit,
+                      std::vector<std::shared_ptr<CPS::MNAInterface>> &comp,
+                      SparseMatrix &sys);
+  /// Factorizes the matrix and returns the factorization time
+  Real factorizeSwitchedSystem(SparseMatrix &sys, DirectLinearSolver &solver);
+
+  // #### Methods for lazily factorized switch matrices ####
+  /// Updates the switch status and provides the matching factorization
+  void updateSwitchedSystem();
+  /// Adds the system of the given switch status to the cache if missing
+  void fetchSwitchedSystem(const std::bitset<SWITCH_NUM> &bit);
+  /// Drops all cached system matrices and factorizations
+  void resetSwitchedSystems();
+  /// Stamps the systems of scheduled switch events for the prewarming
+  std::vector<std::pair<std::bitset<SWITCH_NUM>, SparseMatrix>>
+  stampScheduledSwitchedSystems(const std::bitset<SWITCH_NUM> &initialStatus);
+  /// Factorizes the stamped systems, runs in mPrewarmThread
+  void prewarmSwitchedSystems(
+      std::vector<std::pair<std::bitset<SWITCH_NUM>, SparseMatrix>> systems);
+  /// Terminates the prewarming thread
+  void stopPrewarming();
 
   // #### Methods for system recomputation over time ####
   /// Stamps components into the variable system matrix
@@ -161,7 +240,14 @@ public:
                   CPS::Logger::Level logLevel = CPS::Logger::Level::info);
 
   /// Destructor
-  virtual ~MnaSolverDirect() = default;
+  virtual ~MnaSolverDirect() { stopPrewarming(); }
+
+  /// Calls subroutines to set up everything that is required before simulation
+  void initialize() override;
+
+  /// Updates the companion models and switches to the system matrices of the
+  /// new time step, which are factorized on first use and kept afterwards
+  void changeTimeStep(Real timeStep) override;
 
   /// Sets the linear solver to "implementation" and creates an object
   void
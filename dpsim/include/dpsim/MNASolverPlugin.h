@@ -33,6 +33,11 @@ public:
 
   virtual ~MnaSolverPlugin();
 
+  /// The plugin keeps the factorization of the initial time step
+  void changeTimeStep(Real timeStep) override {
+    Solver::changeTimeStep(timeStep);
+  }
+
   CPS::Task::List getTasks() override;
 
   class SolveTask : public CPS::Task {
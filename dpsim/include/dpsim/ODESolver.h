@@ -17,6 +17,10 @@
 #include <nvector/nvector_serial.h>    // access to serial N_Vector
 #include <sunlinsol/sunlinsol_dense.h> // access to dense SUNLinearSolver
 #include <sunmatrix/sunmatrix_dense.h> // access to dense SUNMatrix
+#ifdef WITH_SUNDIALS_KLU
+#include <sunlinsol/sunlinsol_klu.h>
+#include <sunmatrix/sunmatrix_sparse.h>
+#endif
 
 //using namespace CPS; // led to problems
 
@@ -43,6 +47,11 @@ protected:
   SUNMatrix A{nullptr};
   /// Empty linear solver object
   SUNLinearSolver LS{nullptr};
+  /// Use the sparse analytic Jacobian of the component and the KLU linear
+  /// solver instead of dense matrices
+  Bool mSparseJacobian;
+  /// Jacobian df/dy with the sparsity pattern of the component
+  CPS::SparseMatrix mJacobian;
 
   /// Constant time step
   Real mTimestep;
@@ -65,6 +74,7 @@ protected:
   // Similar to DAE-Solver
   CPS::ODEInterface::StSpFn mStSpFunction;
   CPS::ODEInterface::JacFn mJacFunction;
+  CPS::ODEInterface::SparseJacFn mSparseJacFunction;
 
   /// use wrappers similar to DAE_Solver
   static int StateSpaceWrapper(realtype t, N_Vector y, N_Vector ydot,
@@ -76,13 +86,24 @@ protected:
                              N_Vector tmp3);
   int Jacobian(realtype t, N_Vector y, N_Vector fy, SUNMatrix J, N_Vector tmp1,
                N_Vector tmp2, N_Vector tmp3);
+  /// Evaluate the Jacobian once to fix its sparsity pattern
+  void initializeSparseJacobian();
+#ifdef WITH_SUNDIALS_KLU
+  static int SparseJacobianWrapper(realtype t, N_Vector y, N_Vector fy,
+                                   SUNMatrix J, void *user_data, N_Vector tmp1,
+                                   N_Vector tmp2, N_Vector tmp3);
+  int SparseJacobian(realtype t, N_Vector y, N_Vector fy, SUNMatrix J);
+#endif
   /// ARKode- standard error detection function; in DAE-solver not detection function is used -> for efficiency purposes?
   int check_flag(void *flagvalue, const std::string &funcname, int opt);
 
 public:
-  /// Create solve object with corresponding component and information on the integration type
+  /// Create solve object with corresponding component and information on the integration type.
+  /// The sparse Jacobian is used for implicit integration if the component
+  /// provides it and sundials has KLU support.
   ODESolver(String name, const CPS::ODEInterface::Ptr &comp,
-            bool implicit_integration, Real timestep);
+            bool implicit_integration, Real timestep,
+            Bool sparseJacobian = true);
   /// Deallocate all memory
   ~ODESolver();
 
@@ -46,8 +46,12 @@ protected:
   /// Admittance matrix
   CPS::SparseMatrixCompRow mY;
 
-  /// Jacobian matrix
-  CPS::Matrix mJ;
+  /// Jacobian matrix with a fixed sparsity pattern derived from the admittance matrix
+  CPS::SparseMatrix mJ;
+  /// LU decomposition of the Jacobian
+  CPS::LUFactorizedSparse mJacobianLU;
+  /// Flag whether the symbolic analysis of the Jacobian pattern has been done
+  CPS::Bool mJacobianAnalyzed = false;
   /// Solution vector
   CPS::Vector mX;
   /// Vector of mismatch values
@@ -91,12 +95,21 @@ protected:
   CPS::Bool solutionInitialized = false;
   /// Flag whether complex solution vectors are initialized
   CPS::Bool solutionComplexInitialized = false;
+  /// Number of Newton iterations of each time step, zero for skipped steps
+  std::vector<CPS::UInt> mIterationsPerStep;
+  /// Number of time steps that kept the last solution
+  CPS::UInt mNumSkippedSolves = 0;
 
   /// Generate initial solution for current time step
   virtual void generateInitialSolution(Real time,
                                        bool keep_last_solution = false) = 0;
+  /// Check whether any specified value changed by more than the tolerance
+  /// compared to the last solved time step
+  virtual Bool hasSpecifiedValuesChanged(Real tolerance) = 0;
   /// Calculate mismatch
   virtual void calculateMismatch() = 0;
+  /// Create the sparsity pattern of the Jacobian
+  virtual void createJacobianPattern() = 0;
   /// Calculate the Jacobian
   virtual void calculateJacobian() = 0;
   /// Update solution in each iteration
@@ -142,7 +155,7 @@ public:
   PFSolver(CPS::String name, CPS::SystemTopology system, Real timeStep,
            CPS::Logger::Level logLevel);
   ///
-  virtual ~PFSolver(){};
+  virtual ~PFSolver();
 
   /// Set a node to VD using its name
   void setVDNode(CPS::String name);
@@ -151,6 +164,10 @@ public:
                                    CPS::PowerflowBusType powerFlowBusType);
   /// set solver and component to initialization or simulation behaviour
   void setSolverAndComponentBehaviour(Solver::Behaviour behaviour) override;
+  /// Number of Newton iterations of each solved time step
+  const std::vector<CPS::UInt> &iterationsPerStep() const {
+    return mIterationsPerStep;
+  }
 
   class SolveTask : public CPS::Task {
   public:
@@ -29,10 +29,23 @@ protected:
 
   CPS::Vector Pesp;
   CPS::Vector Qesp;
+  /// Specified voltage magnitudes, only valid at PV and VD buses
+  CPS::Vector Vesp;
+  /// Specified values of the last solved time step
+  CPS::Vector mLastPesp;
+  CPS::Vector mLastQesp;
+  CPS::Vector mLastVesp;
+
+  /// Jacobian row and column of the voltage angle of each bus, -1 for VD buses
+  std::vector<CPS::Int> mJacobianAngleIndex;
+  /// Jacobian row and column of the voltage magnitude of each bus, -1 for PV and VD buses
+  std::vector<CPS::Int> mJacobianVoltageIndex;
 
   // Core methods
   /// Generate initial solution for current time step
   void generateInitialSolution(Real time, bool keep_last_solution = false);
+  /// Create the sparsity pattern of the Jacobian
+  void createJacobianPattern();
   /// Calculate the Jacobian
   void calculateJacobian();
   /// Update solution in each iteration
@@ -41,6 +54,8 @@ protected:
   void setSolution();
   /// Calculate mismatch
   void calculateMismatch();
+  /// Check whether any specified value changed by more than the tolerance
+  Bool hasSpecifiedValuesChanged(Real tolerance);
 
   // Helper methods
   /// Resize solution vector
@@ -6,6 +6,7 @@
  */
 #pragma once
 
+#include <cstdint>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
@@ -21,21 +22,74 @@
 
 namespace DPsim {
 
+/// Logs Real, Int, Complex, Matrix and MatrixComp attributes into a preallocated buffer of rows, one row per time step.
+/// The attributes are resolved to typed columns in start(), so that logging a time step only copies the values.
+/// The CSV file is written in stop(). If a mapped file is set, the buffer is a shared memory mapping of that file
+/// and the logged rows survive a crash of the simulation.
 class RealTimeDataLogger : public DataLoggerInterface, public SharedFactory<RealTimeDataLogger> {
 
 protected:
+  /// Header of the mapped file, followed by the comma separated column names (padded to 8 bytes) and the rows
+  struct MappedFileHeader {
+    char magic[8];
+    std::uint64_t columns;
+    std::uint64_t rows;
+    std::uint64_t namesSize;
+    /// Number of rows up to the last logged time step
+    std::uint64_t rowsLogged;
+  };
+
+  /// Copies the values of an attribute into consecutive entries of a row
+  struct Column {
+    enum class Type { Real, Int, Complex, Matrix, MatrixComp };
+
+    Type type;
+    CPS::AttributeBase *attribute;
+    /// Offset of the first value in the row
+    size_t offset;
+    /// Number of logged matrix rows and columns
+    Eigen::Index rows;
+    Eigen::Index cols;
+  };
+
   std::filesystem::path mFilename;
+  std::filesystem::path mMappedFilename;
   size_t mRowNumber;
-  size_t mCurrentRow;
-  size_t mCurrentAttribute;
+  size_t mRowSize;
+  size_t mRowsLogged;
 
-  std::vector<std::vector<Real>> mAttributeData;
+  /// Limits of the logged matrix rows and columns by attribute name, 0 for all
+  std::map<String, std::pair<UInt, UInt>> mMatrixLimits;
+  std::vector<Column> mColumns;
+  std::vector<String> mColumnNames;
+
+  /// Preallocated rows, each starting with the time
+  std::vector<Real> mBuffer;
+  Real *mData;
+  MappedFileHeader *mMappedHeader;
+  size_t mMappedSize;
+
+  /// Resolves the attributes to columns and the column names
+  void compileColumns();
+  void mapFile();
+  void unmapFile();
 
 public:
   typedef std::shared_ptr<RealTimeDataLogger> Ptr;
 
   RealTimeDataLogger(std::filesystem::path &filename, Real finalTime, Real timeStep);
   RealTimeDataLogger(std::filesystem::path &filename, size_t rowNumber);
+  virtual ~RealTimeDataLogger();
+
+  using DataLoggerInterface::logAttribute;
+
+  /// Keeps the attribute as a whole instead of deriving an attribute per coefficient. Matrices are logged in
+  /// column-major order and limited to the first rowsMax rows and colsMax columns (0 for all).
+  virtual void logAttribute(const String &name, CPS::AttributeBase::Ptr attr, UInt rowsMax = 0, UInt colsMax = 0) override;
+
+  /// Stores the rows in the given file instead of memory. The file contains a MappedFileHeader, the column names and
+  /// the rows as native doubles and is kept after stop(). Throws on platforms without mmap.
+  void setMappedFile(const std::filesystem::path &filename);
 
   virtual void start() override;
   virtual void stop() override;
@@ -12,13 +12,17 @@
 
 #include <dpsim-models/Logger.h>
 #include <dpsim/Definitions.h>
+#include <dpsim/LatencyHistogram.h>
 
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <deque>
+#include <memory>
 #include <mutex>
 #include <unordered_map>
+#include <vector>
 
 namespace DPsim {
 // TODO extend / subclass
@@ -32,6 +36,28 @@ public:
   /// Time measurement for the task execution
   typedef std::chrono::steady_clock::duration TaskTime;
 
+  /// Execution time statistics of a single task
+  struct TaskStatistics {
+    CPS::String name;
+    std::uint64_t count;
+    TaskTime mean;
+    TaskTime p50;
+    TaskTime p99;
+    TaskTime max;
+    /// Number of step overruns attributed to this task
+    UInt overruns;
+    /// Total time by which the attributed steps exceeded the step budget
+    TaskTime overrunTime;
+  };
+
+  /// Time a scheduler thread spent without executing tasks
+  struct ThreadStatistics {
+    /// Waiting at the synchronization at the end of a step
+    TaskTime idle;
+    /// Waiting for the dependencies of a task or searching for work
+    TaskTime spin;
+  };
+
   ///
   Scheduler(CPS::Logger::Level logLevel = CPS::Logger::Level::off)
       : mRoot(std::make_shared<Root>()),
@@ -66,6 +92,25 @@ public:
     return getAveragedMeasurement(task.get());
   }
 
+  /// Enables the task time measurements. Has to be called before the
+  /// schedule is created. Enabled by default if a measurement file is given.
+  void doMeasurements(Bool value = true) { mMeasurementsEnabled = value; }
+  ///
+  Bool measurementsEnabled() const { return mMeasurementsEnabled; }
+  /// Steps taking longer than the budget are counted as overruns
+  void setStepBudget(TaskTime budget) { mStepBudget = budget; }
+  /// Determines if a step budget has been configured
+  Bool hasStepBudget() const { return mStepBudget != TaskTime::max(); }
+  /// Records the duration of a complete step and attributes an overrun to
+  /// the task with the longest execution time in that step
+  void updateStepMeasurement(TaskTime time);
+  /// Statistics of all measured tasks, can be queried during the simulation
+  std::vector<TaskStatistics> taskStatistics();
+  /// Statistics of the scheduler's threads, empty for sequential schedulers
+  std::vector<ThreadStatistics> threadStatistics();
+  /// Write percentiles, maximum and overruns of all tasks to a CSV file
+  void writeStatistics(CPS::String filename);
+
   /// Root task that has a dependency on the external attribute
   /// which means that it should not be removed from the task graph
   class Root : public CPS::Task {
@@ -89,7 +134,13 @@ protected:
   /// Not thread-safe for multiple calls with same task, but should only
   /// be called once for each task in each step anyway
   void updateMeasurement(CPS::Task *task, TaskTime time);
-  /// Write measurement data to file
+  ///
+  void initThreadMeasurements(Int threads);
+  /// Only to be called by the given thread
+  void updateThreadIdle(Int thread, TaskTime time);
+  /// Only to be called by the given thread
+  void updateThreadSpin(Int thread, TaskTime time);
+  /// Write the average execution time of each task to file
   void writeMeasurements(CPS::String filename);
   /// Read measurement data from file to use it for the scheduling
   void readMeasurements(
@@ -104,12 +155,28 @@ protected:
   CPS::Logger::Level mLogLevel;
   /// Logger
   CPS::Logger::Log mSLog;
+  ///
+  Bool mMeasurementsEnabled = false;
 
 private:
-  // TODO more sophisticated measurement method might be necessary for
-  // longer simulations (risk of high memory requirements and integer
-  // overflow)
-  std::unordered_map<CPS::Task *, std::vector<TaskTime>> mMeasurements;
+  struct TaskMeasurement {
+    LatencyHistogram histogram;
+    /// Execution time in the last step
+    std::atomic<TaskTime::rep> last{0};
+    std::atomic<UInt> overruns{0};
+    std::atomic<TaskTime::rep> overrunTime{0};
+  };
+
+  struct ThreadMeasurement {
+    std::atomic<TaskTime::rep> idle{0};
+    std::atomic<TaskTime::rep> spin{0};
+  };
+
+  /// Fixed-size measurements, so memory does not grow with the run time
+  std::unordered_map<CPS::Task *, std::unique_ptr<TaskMeasurement>>
+      mMeasurements;
+  std::vector<std::unique_ptr<ThreadMeasurement>> mThreadMeasurements;
+  TaskTime mStepBudget = TaskTime::max();
 };
 
 /// A barrier is used to synchronize threads. Threads running into the barrier
@@ -20,7 +20,9 @@ class SequentialScheduler : public Scheduler {
 public:
   SequentialScheduler(String outMeasurementFile = String(),
                       CPS::Logger::Level logLevel = CPS::Logger::Level::info)
-      : Scheduler(logLevel), mOutMeasurementFile(outMeasurementFile) {}
+      : Scheduler(logLevel), mOutMeasurementFile(outMeasurementFile) {
+    mMeasurementsEnabled = !outMeasurementFile.empty();
+  }
 
   void createSchedule(const CPS::Task::List &tasks, const Edges &inEdges,
                       const Edges &outEdges);
@@ -30,9 +32,6 @@ public:
 private:
   CPS::Task::List mSchedule;
 
-  std::unordered_map<size_t, std::vector<std::chrono::nanoseconds>>
-      mMeasurements;
-  std::vector<std::chrono::nanoseconds> mStepMeasurements;
   CPS::String mOutMeasurementFile;
 };
 } // namespace DPsim
@@ -10,6 +10,7 @@
 #include <dpsim-models/Logger.h>
 #include <dpsim-models/SimNode.h>
 #include <dpsim-models/SystemTopology.h>
+#include <dpsim/Checkpoint.h>
 #include <dpsim/Config.h>
 #include <dpsim/DataLogger.h>
 #include <dpsim/Event.h>
@@ -97,6 +98,35 @@ protected:
   Bool mInitFromNodesAndTerminals = true;
   /// Enable recomputation of system matrix during simulation
   Bool mSystemMatrixRecomputation = false;
+  /// Step generators of the same model type together
+  Bool mGeneratorGrouping = false;
+  /// Only factorize switched system matrices when their switch status occurs
+  Bool mLazySwitchedMatrices = false;
+  /// Maximum number of factorized switched system matrices kept in memory
+  UInt mSwitchedMatrixCacheSize = 16;
+  /// Factorize the system matrices of scheduled switch events in the background
+  Bool mSwitchedMatrixPrewarming = false;
+  /// Switch configurations scheduled during the simulation
+  std::vector<SwitchConfiguration> mSwitchEvents;
+  /// Adapt the time step to the estimated local error and the events
+  Bool mVariableTimeStep = false;
+  /// Largest time step in variable time step mode
+  Real mMaxTimeStep = 0;
+  /// Tolerance of the estimated relative local error of a step
+  Real mTimeStepTolerance = 1e-3;
+  /// The time step is mTimeStep multiplied by 2^mTimeStepLevel
+  UInt mTimeStepLevel = 0;
+  UInt mMaxTimeStepLevel = 0;
+  /// Steps since the last change of the time step
+  UInt mStepsSinceTimeStepChange = 0;
+  /// Start the Newton iterations of a time series powerflow from the last converged solution
+  Bool mPowerflowWarmStart = false;
+  /// Maximum change of the specified powerflow values for which the last solution is kept
+  Real mPowerflowSkipTolerance = -1;
+  /// Collapse attribute reference chains after the initialization
+  Bool mAttributeResolving = true;
+  /// Symbolic analyses shared with other simulations of the same topology
+  SymbolicAnalysisCache::Ptr mSymbolicAnalysisCache;
 
   /// If tearing components exist, the Diakoptics
   /// solver is selected automatically.
@@ -115,6 +145,12 @@ protected:
   Real mSteadStIniTimeLimit = 10;
   /// steady state initialization accuracy limit
   Real mSteadStIniAccLimit = 0.0001;
+  /// Log the node vectors of every steady state initialization step
+  Bool mSteadStIniVectorLogging = false;
+  /// steady state initialization time step, the simulation time step if zero
+  Real mSteadStIniTimeStep = 0;
+  /// Extrapolate the decaying transient during steady state initialization
+  Bool mSteadStIniExtrapolation = false;
 
   // #### Task dependencies und scheduling ####
   /// Scheduler used for task scheduling
@@ -145,6 +181,12 @@ protected:
   template <typename VarType> void createMNASolver();
   /// Prepare schedule for simulation
   void prepSchedule();
+  /// Selects the time step after the step at mTime and returns it
+  Real adaptTimeStep(Bool eventsHandled);
+  /// State attributes of all nodes, components including their subcomponents
+  /// and virtual nodes, and solvers by their path, e.g.
+  /// "components/line/res.i_intf"
+  CPS::AttributeBase::Map stateAttributes();
 
   /// ### SynGen Interface ###
   int mMaxIterations = 10;
@@ -216,6 +258,57 @@ public:
   void doSystemMatrixRecomputation(Bool value) {
     mSystemMatrixRecomputation = value;
   }
+  /// Step the 3rd and 4th order SP VBR generators of each model type in one
+  /// task with array-based loops. Requires system matrix recomputation.
+  void doGeneratorGrouping(Bool value = true) { mGeneratorGrouping = value; }
+  /// Factorize switched system matrices when their switch status first occurs
+  /// instead of precomputing all 2^n switch combinations
+  void doLazySwitchedMatrices(Bool value) { mLazySwitchedMatrices = value; }
+  /// Set the number of switched system matrices kept in the lazy cache
+  void setSwitchedMatrixCacheSize(UInt size) {
+    mSwitchedMatrixCacheSize = size;
+  }
+  /// Factorize the system matrices of the switch configurations added by
+  /// addSwitchConfiguration in a background thread
+  void doSwitchedMatrixPrewarming(Bool value) {
+    mSwitchedMatrixPrewarming = value;
+  }
+  /// Announce a switch configuration that becomes active at switchTime.
+  /// Bit i of systemIndex is the state of the i-th switch in the topology.
+  void addSwitchConfiguration(Real switchTime, UInt systemIndex) {
+    mSwitchEvents.push_back({switchTime, systemIndex});
+  }
+  /// Adapt the time step during the MNA simulation. The time step is a power
+  /// of two multiple of the time step set with setTimeStep, up to
+  /// maxTimeStep. It is reduced to the smallest one at events and steps land
+  /// on the event times. Only components that implement
+  /// MNAVariableTimeStepInterface or do not depend on the time step are
+  /// supported, the MNA solver rejects composites and generators without it.
+  void doVariableTimeStep(Bool value = true) { mVariableTimeStep = value; }
+  ///
+  void setMaxTimeStep(Real maxTimeStep) { mMaxTimeStep = maxTimeStep; }
+  /// The time step is halved if the relative deviation of the solution from
+  /// its linear extrapolation exceeds the tolerance and doubled if it is
+  /// below a quarter of it. Steps are not rejected: a step above the
+  /// tolerance is kept and only the following steps are shorter.
+  void setTimeStepTolerance(Real tolerance) { mTimeStepTolerance = tolerance; }
+  /// Start the powerflow of each time step from the last converged solution
+  void doPowerflowWarmStart(Bool value = true) { mPowerflowWarmStart = value; }
+  /// Skip the powerflow of a time step if no load, generation or voltage
+  /// set-point changed by more than the tolerance (per unit) since the last
+  /// converged solution. Requires warm start, a negative tolerance disables it.
+  void setPowerflowSkipTolerance(Real tolerance) {
+    mPowerflowSkipTolerance = tolerance;
+  }
+  /// Collapse attribute reference chains after the initialization so that
+  /// attribute access in the step loop is a plain load. References must not be
+  /// changed during the simulation when enabled.
+  void doAttributeResolving(Bool value = true) { mAttributeResolving = value; }
+  /// Reuse the symbolic analysis of system matrices from other simulations
+  /// with the same topology, e.g. the scenarios of a BatchSimulation
+  void setSymbolicAnalysisCache(SymbolicAnalysisCache::Ptr cache) {
+    mSymbolicAnalysisCache = cache;
+  }
   /// If logStepTimes is enabled, the time needed for every timesteps is logged
   /// and can be written to a file or the console using logStepTimes()
   void setLogStepTimes(Bool f) { mLogStepTimes = f; }
@@ -227,6 +320,15 @@ public:
   void setSteadStIniTimeLimit(Real v) { mSteadStIniTimeLimit = v; }
   /// set steady state initialization accuracy limit
   void setSteadStIniAccLimit(Real v) { mSteadStIniAccLimit = v; }
+  /// log left and right vectors during steady state initialization
+  void doSteadStIniVectorLogging(Bool f) { mSteadStIniVectorLogging = f; }
+  /// set a larger steady state initialization time step. It is only used if
+  /// all components can change their time step.
+  void setSteadStIniTimeStep(Real v) { mSteadStIniTimeStep = v; }
+  /// extrapolate the solution to the limit of the decaying transient during
+  /// steady state initialization, with the same restriction as
+  /// setSteadStIniTimeStep
+  void doSteadStIniExtrapolation(Bool f) { mSteadStIniExtrapolation = f; }
 
   // #### Simulation Control ####
   /// Create solver instances etc.
@@ -237,6 +339,12 @@ public:
   void stop();
   /// Run until next time step
   Real next();
+  /// Run the given number of time steps without passing the final time.
+  /// Unlike next(), the simulation is not stopped at the end.
+  Real stepN(UInt steps);
+  /// Run until the given time or the final time is reached.
+  /// Unlike next(), the simulation is not stopped at the end.
+  Real runUntil(Real time);
   /// Run simulation until total time is elapsed.
   void run();
   /// Solve system A * x = z for x and current time
@@ -245,6 +353,26 @@ public:
   void sync() const;
   /// Create the schedule for the independent tasks
   void schedule();
+  /// Collapse the attribute reference chains of all components and nodes
+  void resolveAttributes();
+
+  // #### Checkpoints ####
+  /// Captures the state of the simulation between two steps
+  Checkpoint::Ptr checkpoint();
+  /// Writes the state of the simulation to a binary checkpoint file
+  void saveCheckpoint(const String &filename) {
+    checkpoint()->write(filename);
+  }
+  /// Continues from the checkpoint of a simulation with the same topology
+  /// and solver settings, e.g. to fork several runs after the initialization
+  /// transient. Must be called after start(). Events before the time of the
+  /// checkpoint are discarded. Only the declared state attributes are
+  /// restored, the simulation keeps its own parameters.
+  void restoreCheckpoint(const Checkpoint &checkpoint);
+  ///
+  void restoreCheckpoint(const String &filename) {
+    restoreCheckpoint(*Checkpoint::read(filename));
+  }
 
   /// Schedule an event in the simulation
   void addEvent(Event::Ptr e) { mEvents.addEvent(e); }
@@ -275,8 +403,15 @@ public:
   Real finalTime() const { return **mFinalTime; }
   Int timeStepCount() const { return mTimeStepCount; }
   Real timeStep() const { return **mTimeStep; }
+  /// Time step of the next step, differs from timeStep() only in variable
+  /// time step mode
+  Real currentTimeStep() const {
+    return **mTimeStep * static_cast<Real>(1ULL << mTimeStepLevel);
+  }
   DataLogger::List &loggers() { return mLoggers; }
   std::shared_ptr<Scheduler> scheduler() { return mScheduler; }
+  /// Solution vector of the MNA solver with the given index
+  CPS::Attribute<Matrix>::Ptr leftSideVector(UInt solverIdx = 0);
   std::vector<Real> &stepTimes() { return mStepTimes; }
 
   // #### Set component attributes during simulation ####
@@ -18,6 +18,7 @@
 #include <dpsim/Config.h>
 #include <dpsim/Definitions.h>
 #include <dpsim/DirectLinearSolverConfiguration.h>
+#include <dpsim/SymbolicAnalysisCache.h>
 
 namespace DPsim {
 /// Holds switching time and which system should be activated.
@@ -55,6 +56,12 @@ protected:
   Real mSteadStIniAccLimit = 0.0001;
   /// Activates steady state initialization
   Bool mSteadyStateInit = false;
+  /// Log the node vectors of every steady state initialization step
+  Bool mSteadStIniVectorLogging = false;
+  /// steady state initialization time step, the simulation time step if zero
+  Real mSteadStIniTimeStep = 0;
+  /// Extrapolate the decaying transient during steady state initialization
+  Bool mSteadStIniExtrapolation = false;
   /// Determines if solver is in initialization phase, which requires different behavior
   Bool mIsInInitialization = false;
   /// Activates powerflow initialization
@@ -62,6 +69,22 @@ protected:
   Bool mInitFromNodesAndTerminals = true;
   /// Enable recomputation of system matrix during simulation
   Bool mSystemMatrixRecomputation = false;
+  /// Step generators of the same model type together
+  Bool mGeneratorGrouping = false;
+  /// Only factorize switched system matrices when their switch status occurs
+  Bool mLazySwitchedMatrices = false;
+  /// Maximum number of factorized switched system matrices kept in memory
+  UInt mSwitchedMatrixCacheSize = 16;
+  /// Factorize the system matrices of scheduled switch events in the background
+  Bool mSwitchedMatrixPrewarming = false;
+  /// Start the Newton iterations of a time series powerflow from the last converged solution
+  Bool mPowerflowWarmStart = false;
+  /// Maximum change of the specified powerflow values for which the last solution is kept
+  Real mPowerflowSkipTolerance = -1;
+  /// Symbolic analyses shared with solvers of other simulations, may be null
+  SymbolicAnalysisCache::Ptr mSymbolicAnalysisCache;
+  /// The time step may be changed between two steps
+  Bool mVariableTimeStep = false;
 
   /// Solver behaviour initialization or simulation
   Behaviour mBehaviour = Solver::Behaviour::Simulation;
@@ -90,8 +113,35 @@ public:
   void doSystemMatrixRecomputation(Bool value) {
     mSystemMatrixRecomputation = value;
   }
+  /// Step the supported reduced-order generators of the same model type in
+  /// one task instead of one task per generator
+  void doGeneratorGrouping(Bool value) { mGeneratorGrouping = value; }
 
   void setLogSolveTimes(Bool value) { mLogSolveTimes = value; }
+  /// Factorize switched system matrices on demand instead of all combinations
+  void doLazySwitchedMatrices(Bool value) { mLazySwitchedMatrices = value; }
+  /// Set the number of switched system matrices kept in the lazy cache
+  void setSwitchedMatrixCacheSize(UInt size) {
+    mSwitchedMatrixCacheSize = size;
+  }
+  /// Prepare system matrices of scheduled switch events in a background thread
+  void doSwitchedMatrixPrewarming(Bool value) {
+    mSwitchedMatrixPrewarming = value;
+  }
+  /// Start each powerflow from the last converged solution
+  void doPowerflowWarmStart(Bool value) { mPowerflowWarmStart = value; }
+  /// Keep the last powerflow solution if no specified value changed by more
+  /// than the tolerance (per unit), a negative tolerance disables skipping
+  void setPowerflowSkipTolerance(Real tolerance) {
+    mPowerflowSkipTolerance = tolerance;
+  }
+  /// Prepare the solver for changes of the time step during the simulation
+  void doVariableTimeStep(Bool value) { mVariableTimeStep = value; }
+  /// Set the switch configurations that are scheduled during the simulation
+  virtual void
+  setSwitchEvents(const std::vector<SwitchConfiguration> &switchEvents) {
+    // only solvers with switched system matrices make use of this
+  }
 
   // #### Initialization ####
   ///
@@ -102,6 +152,12 @@ public:
   void setSteadStIniTimeLimit(Real v) { mSteadStIniTimeLimit = v; }
   /// set steady state initialization accuracy limit
   void setSteadStIniAccLimit(Real v) { mSteadStIniAccLimit = v; }
+  /// log left and right vectors during steady state initialization
+  void doSteadStIniVectorLogging(Bool f) { mSteadStIniVectorLogging = f; }
+  /// set steady state initialization time step
+  void setSteadStIniTimeStep(Real v) { mSteadStIniTimeStep = v; }
+  /// extrapolate the solution during steady state initialization
+  void doSteadStIniExtrapolation(Bool f) { mSteadStIniExtrapolation = f; }
   /// set solver and component to initialization or simulation behaviour
   virtual void setSolverAndComponentBehaviour(Solver::Behaviour behaviour) {}
   /// activate powerflow initialization
@@ -111,6 +167,10 @@ public:
   setDirectLinearSolverConfiguration(DirectLinearSolverConfiguration &) {
     // not every derived class has a linear solver configuration option
   }
+  /// Share the symbolic analysis of system matrices with other solvers
+  void setSymbolicAnalysisCache(SymbolicAnalysisCache::Ptr cache) {
+    mSymbolicAnalysisCache = cache;
+  }
   /// log LU decomposition times, if applicable
   virtual void logLUTimes() {
     // no default implementation for all types of solvers
@@ -119,8 +179,18 @@ public:
   // #### Simulation ####
   /// Get tasks for scheduler
   virtual CPS::Task::List getTasks() = 0;
+  /// Attributes holding the state of the solver itself, e.g. for checkpoints
+  virtual CPS::AttributeBase::Map stateAttributes() { return {}; }
   /// Log results
   virtual void log(Real time, Int timeStepCount){};
+  /// Switch to another time step between two steps, only supported by
+  /// solvers prepared with doVariableTimeStep
+  virtual void changeTimeStep(Real timeStep) {
+    throw CPS::SystemError("Solver does not support variable time steps.");
+  }
+  /// Estimated relative local error of the last step. Called once after each
+  /// step if variable time steps are enabled.
+  virtual Real stepErrorEstimate() { return 0; }
 
   /// ### SynGen Interface ###
   int mMaxIterations = 10;
@@ -0,0 +1,59 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <dpsim/Definitions.h>
+
+namespace DPsim {
+
+/// Thread-safe store of the symbolic analyses (fill-reducing ordering and
+/// block structure) of sparse system matrices. Linear solvers of systems with
+/// the same sparsity pattern, e.g. the scenarios of a batch simulation, reuse
+/// the analysis of the first solver instead of repeating it.
+class SymbolicAnalysisCache {
+public:
+  typedef std::shared_ptr<SymbolicAnalysisCache> Ptr;
+  /// Computes the analysis of a matrix, the type depends on the solver
+  typedef std::function<std::shared_ptr<void>()> Analyze;
+
+  /// Returns the analysis of the matrix pattern and computes it on the first
+  /// request. The options distinguish analyses of different solver
+  /// implementations or settings. The analysis must only be read afterwards.
+  std::shared_ptr<void> analysis(const SparseMatrix &matrix,
+                                 const String &options, const Analyze &analyze);
+
+  /// Number of requests served from the cache
+  UInt hits() const;
+  /// Number of computed analyses
+  UInt misses() const;
+  ///
+  void clear();
+
+private:
+  struct Entry {
+    String options;
+    Int rows;
+    std::vector<Int> outerIndices;
+    std::vector<Int> innerIndices;
+    std::shared_ptr<void> analysis;
+  };
+
+  mutable std::mutex mMutex;
+  /// Entries by hash of their pattern, colliding patterns share a bucket
+  std::unordered_multimap<std::size_t, Entry> mEntries;
+  UInt mHits = 0;
+  UInt mMisses = 0;
+};
+} // namespace DPsim
@@ -0,0 +1,76 @@
+/* Copyright 2017-2021 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#pragma once
+
+#include <dpsim/Scheduler.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace DPsim {
+/// Dynamic scheduler that releases tasks as soon as all of their
+/// predecessors in the dependency graph have finished. Every thread works
+/// on its own deque of ready tasks and steals from the other threads
+/// when it runs out of work.
+class ThreadWorkStealingScheduler : public Scheduler {
+public:
+  ThreadWorkStealingScheduler(Int threads = 1,
+                              String outMeasurementFile = String(),
+                              Bool useConditionVariables = false);
+  virtual ~ThreadWorkStealingScheduler();
+
+  void createSchedule(const CPS::Task::List &tasks, const Edges &inEdges,
+                      const Edges &outEdges);
+  void step(Real time, Int timeStepCount);
+  void stop();
+
+private:
+  struct TaskEntry {
+    CPS::Task *task = nullptr;
+    /// Indices of the tasks depending on this task
+    std::vector<UInt> successors;
+    /// Number of predecessors
+    Int inDegree = 0;
+    /// Number of predecessors not finished in the current step
+    std::atomic<Int> pending{0};
+  };
+
+  struct WorkerQueue {
+    std::mutex mutex;
+    /// Owner pushes and pops at the back, thieves take from the front
+    std::deque<UInt> tasks;
+  };
+
+  void doStep(Int thread);
+  Bool popTask(Int thread, UInt &task);
+  Bool stealTask(Int thread, UInt &task);
+  void executeTask(Int thread, UInt task);
+  void waitForStepEnd(Int thread);
+  static void threadFunction(ThreadWorkStealingScheduler *sched, Int idx);
+
+  Int mNumThreads;
+  String mOutMeasurementFile;
+  Barrier mStartBarrier;
+  Barrier mEndBarrier;
+
+  std::vector<std::thread> mThreads;
+
+  std::vector<TaskEntry> mTasks;
+  /// Tasks without predecessors, distributed among the threads
+  std::vector<std::vector<UInt>> mInitialTasks;
+  std::vector<std::unique_ptr<WorkerQueue>> mQueues;
+  /// Number of tasks not yet finished in the current step
+  std::atomic<Int> mRemaining{0};
+
+  Bool mJoining = false;
+  Real mTime = 0;
+  Int mTimeStepCount = 0;
+};
+} // namespace DPsim
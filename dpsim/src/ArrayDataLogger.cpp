@@ -0,0 +1,99 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <dpsim-models/Logger.h>
+#include <dpsim/ArrayDataLogger.h>
+
+using namespace DPsim;
+
+ArrayDataLogger::ArrayDataLogger(String name, UInt capacity,
+                                 UInt downsampling)
+    : DataLoggerInterface(), mName(name), mCapacity(capacity),
+      mDownsampling(downsampling),
+      mData(std::make_shared<CPS::MatrixRow>()) {
+  if (mDownsampling == 0)
+    mDownsampling = 1;
+}
+
+void ArrayDataLogger::start() {
+  mRealColumns.clear();
+  mIntColumns.clear();
+  mIsIntColumn.clear();
+  mColumnNames = {"time"};
+  for (auto it : mAttributes) {
+    if (auto attrReal = std::dynamic_pointer_cast<CPS::Attribute<Real>>(
+            it.second.getPtr())) {
+      mRealColumns.push_back(attrReal);
+      mIsIntColumn.push_back(false);
+    } else if (auto attrInt = std::dynamic_pointer_cast<CPS::Attribute<Int>>(
+                   it.second.getPtr())) {
+      mIntColumns.push_back(attrInt);
+      mIsIntColumn.push_back(true);
+    } else {
+      throw std::runtime_error(
+          "ArrayDataLogger: Unsupported attribute type for attribute " +
+          it.first);
+    }
+    mColumnNames.push_back(it.first);
+  }
+
+  // Allocate everything here, so that recording does not allocate. Views of
+  // a previous run keep their array if the shape has changed.
+  if (mData->rows() != mCapacity ||
+      mData->cols() != static_cast<Eigen::Index>(mColumnNames.size()))
+    mData = std::make_shared<CPS::MatrixRow>(
+        CPS::MatrixRow::Zero(mCapacity, mColumnNames.size()));
+  reset();
+}
+
+void ArrayDataLogger::stop() {
+  if (mDroppedRows > 0) {
+    auto log = CPS::Logger::get("ArrayDataLogger", CPS::Logger::Level::off,
+                                CPS::Logger::Level::warn);
+    SPDLOG_LOGGER_WARN(log, "{}: {} steps exceeded the capacity of {} rows",
+                       mName, mDroppedRows, mCapacity);
+  }
+}
+
+void ArrayDataLogger::reset() {
+  mRows.store(0, std::memory_order_release);
+  mDroppedRows = 0;
+}
+
+void ArrayDataLogger::log(Real time, Int timeStepCount) {
+  if (timeStepCount % mDownsampling != 0)
+    return;
+
+  UInt row = mRows.load(std::memory_order_relaxed);
+  if (row >= mCapacity) {
+    ++mDroppedRows;
+    return;
+  }
+
+  Real *values = mData->row(row).data();
+  values[0] = time;
+  auto realIt = mRealColumns.begin();
+  auto intIt = mIntColumns.begin();
+  for (UInt col = 1; col < mColumnNames.size(); ++col) {
+    if (mIsIntColumn[col - 1])
+      values[col] = static_cast<Real>(**(*intIt++));
+    else
+      values[col] = **(*realIt++);
+  }
+
+  // Readers in other threads only see completely written rows
+  mRows.store(row + 1, std::memory_order_release);
+}
+
+void ArrayDataLogger::Step::execute(Real time, Int timeStepCount) {
+  mLogger.log(time, timeStepCount);
+}
+
+CPS::Task::Ptr ArrayDataLogger::getTask() {
+  return std::make_shared<ArrayDataLogger::Step>(*this);
+}
@@ -0,0 +1,93 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <dpsim/BatchSimulation.h>
+
+using namespace DPsim;
+
+BatchSimulation::BatchSimulation(String name, ScenarioFactory factory,
+                                 CPS::Logger::Level logLevel)
+    : mName(name), mFactory(factory),
+      mThreads(std::max(std::thread::hardware_concurrency(), 1u)),
+      mSymbolicAnalysisCache(std::make_shared<SymbolicAnalysisCache>()),
+      mLog(CPS::Logger::get(name, logLevel)) {}
+
+std::vector<BatchSimulation::ScenarioResult>
+BatchSimulation::run(UInt numScenarios) {
+  std::vector<ScenarioResult> results(numScenarios);
+  std::atomic<UInt> nextScenario{0};
+  mLogDir = CPS::Logger::logDir();
+
+  auto worker = [&]() {
+    for (UInt scenario = nextScenario++; scenario < numScenarios;
+         scenario = nextScenario++)
+      results[scenario] = runScenario(scenario);
+  };
+
+  UInt threads = std::min(std::max(mThreads, 1u), std::max(numScenarios, 1u));
+  SPDLOG_LOGGER_INFO(mLog, "Running {} scenarios on {} threads", numScenarios,
+                     threads);
+  auto start = std::chrono::steady_clock::now();
+
+  std::vector<std::thread> pool;
+  for (UInt idx = 1; idx < threads; ++idx)
+    pool.emplace_back(worker);
+  worker();
+  for (auto &thread : pool)
+    thread.join();
+
+  std::chrono::duration<Real> duration =
+      std::chrono::steady_clock::now() - start;
+  UInt failed = static_cast<UInt>(
+      std::count_if(results.begin(), results.end(),
+                    [](const ScenarioResult &r) { return !r.success; }));
+  SPDLOG_LOGGER_INFO(mLog,
+                     "Finished {} scenarios in {:.3f} s, {} failed, {} "
+                     "symbolic analyses reused",
+                     numScenarios, duration.count(), failed,
+                     mSymbolicAnalysisCache->hits());
+  return results;
+}
+
+BatchSimulation::ScenarioResult BatchSimulation::runScenario(UInt scenario) {
+  ScenarioResult result{scenario, false, "", 0, {}};
+  auto start = std::chrono::steady_clock::now();
+  CPS::Logger::setThreadLogDir(mLogDir + "/" + mName + "_" +
+                               std::to_string(scenario));
+
+  try {
+    auto sim = mFactory(scenario);
+    if (!sim)
+      throw std::invalid_argument("scenario factory returned no simulation");
+    sim->setSymbolicAnalysisCache(mSymbolicAnalysisCache);
+    if (mCheckpoint) {
+      sim->start();
+      sim->restoreCheckpoint(*mCheckpoint);
+      sim->runUntil(sim->finalTime());
+      sim->stop();
+    } else {
+      sim->run();
+    }
+    result.loggers = sim->loggers();
+    result.success = true;
+  } catch (std::exception &e) {
+    result.error = e.what();
+    SPDLOG_LOGGER_ERROR(mLog, "Scenario {} failed: {}", scenario, e.what());
+  }
+  CPS::Logger::setThreadLogDir("");
+
+  std::chrono::duration<Real> duration =
+      std::chrono::steady_clock::now() - start;
+  result.duration = duration.count();
+  return result;
+}
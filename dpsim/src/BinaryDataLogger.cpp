@@ -0,0 +1,196 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+#include <dpsim-models/Logger.h>
+#include <dpsim/BinaryDataLogger.h>
+
+using namespace DPsim;
+
+BinaryDataLogger::BinaryDataLogger(String name, Bool enabled,
+                                   UInt downsampling, UInt chunkRows)
+    : DataLoggerInterface(), mName(name), mEnabled(enabled),
+      mDownsampling(downsampling), mChunkRows(chunkRows) {
+  if (mDownsampling == 0)
+    throw std::invalid_argument("BinaryDataLogger: downsampling must be at "
+                                "least 1");
+  if (mChunkRows == 0)
+    mChunkRows = 1;
+  if (!mEnabled)
+    return;
+
+  mFilename = CPS::Logger::logDir() + "/" + name + ".bin";
+
+  if (mFilename.has_parent_path() && !fs::exists(mFilename.parent_path()))
+    fs::create_directory(mFilename.parent_path());
+}
+
+BinaryDataLogger::~BinaryDataLogger() {
+  if (mRunning)
+    stop();
+}
+
+void BinaryDataLogger::start() {
+  if (!mEnabled || mRunning)
+    return;
+
+  mRealColumns.clear();
+  mIntColumns.clear();
+  mIsIntColumn.clear();
+  for (auto it : mAttributes) {
+    if (auto attrReal = std::dynamic_pointer_cast<CPS::Attribute<Real>>(
+            it.second.getPtr())) {
+      mRealColumns.push_back(attrReal);
+      mIsIntColumn.push_back(false);
+    } else if (auto attrInt = std::dynamic_pointer_cast<CPS::Attribute<Int>>(
+                   it.second.getPtr())) {
+      mIntColumns.push_back(attrInt);
+      mIsIntColumn.push_back(true);
+    } else {
+      throw std::runtime_error(
+          "BinaryDataLogger: Unsupported attribute type for attribute " +
+          it.first);
+    }
+  }
+  // The first column holds the time
+  mNumColumns = static_cast<UInt>(mIsIntColumn.size()) + 1;
+
+  mLogFile = std::ofstream(mFilename, std::ios_base::out |
+                                          std::ios_base::trunc |
+                                          std::ios_base::binary);
+  if (!mLogFile.is_open()) {
+    throw std::runtime_error("Cannot open log file " + mFilename.string());
+  }
+  writeHeader();
+
+  mCurrentChunk.data.resize(static_cast<size_t>(mChunkRows) * mNumColumns);
+  mCurrentChunk.rows = 0;
+  mStopping = false;
+  mRunning = true;
+  mWriterThread = std::thread(writerFunction, this);
+}
+
+void BinaryDataLogger::stop() {
+  if (!mRunning)
+    return;
+
+  if (mCurrentChunk.rows > 0)
+    submitChunk();
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mStopping = true;
+  }
+  mCondition.notify_one();
+  mWriterThread.join();
+
+  mLogFile.close();
+  mFreeChunks.clear();
+  mRunning = false;
+}
+
+void BinaryDataLogger::log(Real time, Int timeStepCount) {
+  if (!mRunning || !(timeStepCount % mDownsampling == 0))
+    return;
+
+  // Column-major layout within the chunk
+  Real *row = mCurrentChunk.data.data() + mCurrentChunk.rows;
+  row[0] = time;
+  auto realIt = mRealColumns.begin();
+  auto intIt = mIntColumns.begin();
+  for (UInt col = 1; col < mNumColumns; ++col) {
+    if (mIsIntColumn[col - 1])
+      row[col * mChunkRows] = static_cast<Real>(**(*intIt++));
+    else
+      row[col * mChunkRows] = **(*realIt++);
+  }
+
+  if (++mCurrentChunk.rows == mChunkRows)
+    submitChunk();
+}
+
+void BinaryDataLogger::submitChunk() {
+  Chunk next;
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mFullChunks.push_back(std::move(mCurrentChunk));
+    if (!mFreeChunks.empty()) {
+      next = std::move(mFreeChunks.back());
+      mFreeChunks.pop_back();
+    }
+  }
+  mCondition.notify_one();
+
+  if (next.data.empty())
+    next.data.resize(static_cast<size_t>(mChunkRows) * mNumColumns);
+  next.rows = 0;
+  mCurrentChunk = std::move(next);
+}
+
+void BinaryDataLogger::writeHeader() {
+  auto writeUInt = [this](std::uint32_t value) {
+    mLogFile.write(reinterpret_cast<const char *>(&value), sizeof(value));
+  };
+
+  mLogFile.write(MAGIC, std::strlen(MAGIC));
+  writeUInt(BYTE_ORDER_MARK);
+  writeUInt(VERSION);
+  writeUInt(mNumColumns);
+  writeUInt(mChunkRows);
+
+  std::vector<String> names = {"time"};
+  for (auto it : mAttributes)
+    names.push_back(it.first);
+  for (auto &name : names) {
+    writeUInt(static_cast<std::uint32_t>(name.size()));
+    mLogFile.write(name.data(), name.size());
+  }
+}
+
+void BinaryDataLogger::writeChunk(const Chunk &chunk) {
+  std::uint32_t rows = chunk.rows;
+  mLogFile.write(reinterpret_cast<const char *>(&rows), sizeof(rows));
+  for (UInt col = 0; col < mNumColumns; ++col) {
+    mLogFile.write(
+        reinterpret_cast<const char *>(chunk.data.data() + col * mChunkRows),
+        rows * sizeof(Real));
+  }
+}
+
+void BinaryDataLogger::writerFunction(BinaryDataLogger *logger) {
+  std::unique_lock<std::mutex> lock(logger->mMutex);
+  while (true) {
+    logger->mCondition.wait(lock, [logger] {
+      return logger->mStopping || !logger->mFullChunks.empty();
+    });
+    if (logger->mFullChunks.empty())
+      break;
+
+    Chunk chunk = std::move(logger->mFullChunks.front());
+    logger->mFullChunks.pop_front();
+
+    // File access happens outside of the lock so that the simulation
+    // can continue to hand over chunks
+    lock.unlock();
+    logger->writeChunk(chunk);
+    lock.lock();
+
+    logger->mFreeChunks.push_back(std::move(chunk));
+  }
+  logger->mLogFile.flush();
+}
+
+void BinaryDataLogger::Step::execute(Real time, Int timeStepCount) {
+  mLogger.log(time, timeStepCount);
+}
+
+CPS::Task::Ptr BinaryDataLogger::getTask() {
+  return std::make_shared<BinaryDataLogger::Step>(*this);
+}
@@ -0,0 +1,215 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <cstring>
+#include <fstream>
+
+#include <dpsim/Checkpoint.h>
+
+using namespace DPsim;
+
+namespace {
+template <typename T>
+std::shared_ptr<CPS::Attribute<T>> typed(const CPS::AttributeBase::Ptr &attr) {
+  return std::dynamic_pointer_cast<CPS::Attribute<T>>(attr.getPtr());
+}
+
+template <typename T>
+void copyIn(std::vector<char> &data, const T *values, std::size_t count) {
+  data.resize(count * sizeof(T));
+  std::memcpy(data.data(), values, data.size());
+}
+
+template <typename T>
+Bool applyScalar(const CPS::AttributeBase::Ptr &attr,
+                 const std::vector<char> &data) {
+  auto attrTyped = typed<T>(attr);
+  if (!attrTyped || data.size() != sizeof(T))
+    return false;
+  std::memcpy(&attrTyped->get(), data.data(), data.size());
+  return true;
+}
+
+template <typename T>
+Bool applyMatrix(const CPS::AttributeBase::Ptr &attr,
+                 const std::vector<char> &data, std::uint32_t rows,
+                 std::uint32_t cols) {
+  auto attrTyped = typed<CPS::MatrixVar<T>>(attr);
+  if (!attrTyped)
+    return false;
+  auto &matrix = attrTyped->get();
+  if (matrix.rows() != rows || matrix.cols() != cols ||
+      data.size() != matrix.size() * sizeof(T))
+    return false;
+  std::memcpy(matrix.data(), data.data(), data.size());
+  return true;
+}
+
+template <typename T> void readValue(std::ifstream &file, T &value) {
+  file.read(reinterpret_cast<char *>(&value), sizeof(value));
+}
+
+template <typename T> void writeValue(std::ofstream &file, const T &value) {
+  file.write(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+} // namespace
+
+Bool Checkpoint::toValue(const CPS::AttributeBase::Ptr &attr, Value &value) {
+  value = {Type::Real, 1, 1, {}};
+  if (auto real = typed<Real>(attr)) {
+    copyIn(value.data, &real->get(), 1);
+  } else if (auto complex = typed<Complex>(attr)) {
+    value.type = Type::Complex;
+    copyIn(value.data, &complex->get(), 1);
+  } else if (auto integer = typed<Int>(attr)) {
+    value.type = Type::Int;
+    copyIn(value.data, &integer->get(), 1);
+  } else if (auto uinteger = typed<UInt>(attr)) {
+    value.type = Type::UInt;
+    copyIn(value.data, &uinteger->get(), 1);
+  } else if (auto boolean = typed<Bool>(attr)) {
+    value.type = Type::Bool;
+    copyIn(value.data, &boolean->get(), 1);
+  } else if (auto matrix = typed<Matrix>(attr)) {
+    auto &m = matrix->get();
+    value = {Type::Matrix, static_cast<std::uint32_t>(m.rows()),
+             static_cast<std::uint32_t>(m.cols()), {}};
+    copyIn(value.data, m.data(), m.size());
+  } else if (auto matrixComp = typed<MatrixComp>(attr)) {
+    auto &m = matrixComp->get();
+    value = {Type::MatrixComp, static_cast<std::uint32_t>(m.rows()),
+             static_cast<std::uint32_t>(m.cols()), {}};
+    copyIn(value.data, m.data(), m.size());
+  } else {
+    return false;
+  }
+  return true;
+}
+
+void Checkpoint::capture(const CPS::AttributeBase::Map &attributes) {
+  for (auto &it : attributes) {
+    Value value;
+    if (!toValue(it.second, value))
+      throw std::invalid_argument("Checkpoint: type of state attribute " +
+                                  it.first + " is not supported");
+    mValues[it.first] = std::move(value);
+  }
+}
+
+void Checkpoint::apply(const CPS::AttributeBase::Map &attributes) const {
+  for (auto &it : mValues) {
+    auto attrIt = attributes.find(it.first);
+    if (attrIt == attributes.end())
+      throw std::invalid_argument("Checkpoint: attribute " + it.first +
+                                  " does not exist in the simulation");
+    auto &attr = attrIt->second;
+    auto &value = it.second;
+
+    Bool applied = false;
+    switch (value.type) {
+    case Type::Real:
+      applied = applyScalar<Real>(attr, value.data);
+      break;
+    case Type::Complex:
+      applied = applyScalar<Complex>(attr, value.data);
+      break;
+    case Type::Int:
+      applied = applyScalar<Int>(attr, value.data);
+      break;
+    case Type::UInt:
+      applied = applyScalar<UInt>(attr, value.data);
+      break;
+    case Type::Bool:
+      applied = applyScalar<Bool>(attr, value.data);
+      break;
+    case Type::Matrix:
+      applied = applyMatrix<Real>(attr, value.data, value.rows, value.cols);
+      break;
+    case Type::MatrixComp:
+      applied = applyMatrix<Complex>(attr, value.data, value.rows, value.cols);
+      break;
+    }
+
+    if (!applied)
+      throw std::invalid_argument("Checkpoint: type or size of attribute " +
+                                  it.first + " does not match");
+  }
+}
+
+void Checkpoint::write(const fs::path &filename) const {
+  std::ofstream file(filename, std::ios_base::out | std::ios_base::trunc |
+                                   std::ios_base::binary);
+  if (!file.is_open())
+    throw std::runtime_error("Cannot open checkpoint file " +
+                             filename.string());
+
+  file.write(MAGIC, std::strlen(MAGIC));
+  writeValue<std::uint32_t>(file, VERSION);
+  writeValue(file, mTime);
+  writeValue<std::int64_t>(file, mTimeStepCount);
+  writeValue<std::uint32_t>(file, static_cast<std::uint32_t>(mValues.size()));
+
+  for (auto &it : mValues) {
+    writeValue<std::uint32_t>(file,
+                              static_cast<std::uint32_t>(it.first.size()));
+    file.write(it.first.data(), it.first.size());
+    writeValue(file, it.second.type);
+    writeValue(file, it.second.rows);
+    writeValue(file, it.second.cols);
+    writeValue<std::uint32_t>(
+        file, static_cast<std::uint32_t>(it.second.data.size()));
+    file.write(it.second.data.data(), it.second.data.size());
+  }
+
+  if (!file.good())
+    throw std::runtime_error("Cannot write checkpoint file " +
+                             filename.string());
+}
+
+Checkpoint::Ptr Checkpoint::read(const fs::path &filename) {
+  std::ifstream file(filename, std::ios_base::in | std::ios_base::binary);
+  if (!file.is_open())
+    throw std::runtime_error("Cannot open checkpoint file " +
+                             filename.string());
+
+  String magic(std::strlen(MAGIC), '\0');
+  file.read(&magic[0], magic.size());
+  std::uint32_t version = 0;
+  readValue(file, version);
+  if (!file.good() || magic != MAGIC || version != VERSION)
+    throw std::runtime_error("Invalid checkpoint file " + filename.string());
+
+  auto checkpoint = std::make_shared<Checkpoint>();
+  std::int64_t timeStepCount = 0;
+  std::uint32_t count = 0;
+  readValue(file, checkpoint->mTime);
+  readValue(file, timeStepCount);
+  readValue(file, count);
+  checkpoint->mTimeStepCount = static_cast<Int>(timeStepCount);
+
+  for (std::uint32_t idx = 0; idx < count && file.good(); ++idx) {
+    std::uint32_t length = 0;
+    readValue(file, length);
+    String name(length, '\0');
+    file.read(&name[0], length);
+
+    Value value;
+    std::uint32_t size = 0;
+    readValue(file, value.type);
+    readValue(file, value.rows);
+    readValue(file, value.cols);
+    readValue(file, size);
+    value.data.resize(size);
+    file.read(value.data.data(), size);
+    checkpoint->mValues[name] = std::move(value);
+  }
+
+  if (!file.good())
+    throw std::runtime_error("Truncated checkpoint file " + filename.string());
+  return checkpoint;
+}
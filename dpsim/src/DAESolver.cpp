@@ -6,6 +6,11 @@
  * file, You can obtain one at https://mozilla.org/MPL/2.0/.
  *********************************************************************************/
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+
 #include <dpsim-models/SimPowerComp.h>
 #include <dpsim-models/Solver/MNAInterface.h>
 #include <dpsim/DAESolver.h>
@@ -16,8 +21,16 @@ using namespace CPS;
 //#define NVECTOR_DATA(vec) NV_DATA_S (vec) // Returns pointer to the first element of array vec
 
 DAESolver::DAESolver(String name, const CPS::SystemTopology &system, Real dt,
-                     Real t0)
-    : Solver(name, CPS::Logger::Level::info), mSystem(system), mTimestep(dt) {
+                     Real t0, Bool sparseJacobian)
+    : Solver(name, CPS::Logger::Level::info), mSystem(system), mTimestep(dt),
+      mSparseJacobian(sparseJacobian) {
+#ifndef WITH_SUNDIALS_KLU
+  if (mSparseJacobian) {
+    SPDLOG_LOGGER_WARN(mSLog, "Sundials has been built without KLU, falling "
+                              "back to dense Jacobians");
+    mSparseJacobian = false;
+  }
+#endif
 
   // Defines offset vector of the residual which is composed as follows:
   // mOffset[0] = # nodal voltage equations
@@ -86,6 +99,8 @@ void DAESolver::initialize() {
   s_dtval = N_VGetArrayPointer_Serial(dstate_dt);
   std::cout << "Pointer Init done" << std::endl << std::endl;
 
+  mAnalyticJacobian = !mComponents.empty();
+
   for (auto node : mNodes) {
     // Initialize nodal voltages of state vector
     Real tempVolt;
@@ -120,6 +135,14 @@ void DAESolver::initialize() {
                   double resid[], std::vector<int> &off) {
           daeComp->daeResidual(ttime, state, dstate_dt, resid, off);
         });
+
+    mAnalyticJacobian = mAnalyticJacobian && daeComp->daeHasJacobian();
+    mJacobianFunctions.push_back(
+        [daeComp](double ttime, const double state[], const double dstate_dt[],
+                  double cj, CPS::SparseMatrix &jacobian,
+                  std::vector<int> &off) {
+          daeComp->daeJacobian(ttime, state, dstate_dt, cj, jacobian, off);
+        });
   }
 
   for (int j = 0; j < (int)mNodes.size(); j++) {
@@ -160,9 +183,13 @@ void DAESolver::initialize() {
 
   std::cout << "Call IDA Solver Stuff" << std::endl;
   // Allocate and connect Matrix A and solver LS to IDA
-  A = SUNDenseMatrix(mNEQ, mNEQ);
-  LS = SUNDenseLinearSolver(state, A);
-  ret = IDADlsSetLinearSolver(mem, LS, A);
+  if (mSparseJacobian) {
+    initializeSparseJacobian();
+  } else {
+    A = SUNDenseMatrix(mNEQ, mNEQ);
+    LS = SUNDenseLinearSolver(state, A);
+    ret = IDADlsSetLinearSolver(mem, LS, A);
+  }
 
   //TODO: Optional IDA input functions
   //ret = IDASetMaxNumSteps(mem, -1);  //Max. number of timesteps until tout (-1 = unlimited)
@@ -180,10 +207,21 @@ int DAESolver::residualFunctionWrapper(realtype ttime, N_Vector state,
 
 int DAESolver::residualFunction(realtype ttime, N_Vector state,
                                 N_Vector dstate_dt, N_Vector resid) {
+  evaluateResidual(ttime, NV_DATA_S(state), NV_DATA_S(dstate_dt),
+                   NV_DATA_S(resid));
+
+  // If successful; positive value if recoverable error, negative if fatal error
+  // TODO: Error handling
+  return 0;
+}
+
+void DAESolver::evaluateResidual(realtype ttime, const double state[],
+                                 const double dstate_dt[], double resid[]) {
   mOffsets[0] = 0; // Reset Offset
   mOffsets[1] = 0; // Reset Offset
-  double *residual = NV_DATA_S(resid);
-  double *tempstate = NV_DATA_S(state);
+  // Components add their currents to the nodal equations
+  std::fill(resid, resid + mNEQ, 0.);
+
   // Solve for all node Voltages
   for (auto node : mNodes) {
 
@@ -191,20 +229,254 @@ int DAESolver::residualFunction(realtype ttime, N_Vector state,
 
     tempVolt += std::real(node->singleVoltage());
 
-    residual[mOffsets[0]] = tempVolt - tempstate[mOffsets[0]];
+    resid[mOffsets[0]] = tempVolt - state[mOffsets[0]];
     mOffsets[0] += 1;
   }
 
   // Call all registered component residual functions
-  for (auto resFn : mResidualFunctions) {
-    resFn(ttime, NV_DATA_S(state), NV_DATA_S(dstate_dt), NV_DATA_S(resid),
-          mOffsets);
+  for (const auto &resFn : mResidualFunctions) {
+    resFn(ttime, state, dstate_dt, resid, mOffsets);
   }
+}
 
-  // If successful; positive value if recoverable error, negative if fatal error
-  // TODO: Error handling
+void DAESolver::initializeSparseJacobian() {
+  const double *sval = NV_DATA_S(state);
+  const double *s_dtval = NV_DATA_S(dstate_dt);
+
+  mPerturbedState.resize(mNEQ);
+  mPerturbedDerivative.resize(mNEQ);
+  mPerturbedResidual.resize(mNEQ);
+  mIncrements.resize(mNEQ);
+
+  if (mAnalyticJacobian) {
+    // The entries added by the components define the pattern
+    mJacobian.resize(mNEQ, mNEQ);
+    evaluateAnalyticJacobian(mT0, 1., sval, s_dtval);
+    for (Int idx = 0; idx < mNEQ; ++idx)
+      mJacobian.coeffRef(idx, idx) += 0.;
+    mJacobian.makeCompressed();
+  } else {
+    detectSparsityPattern(sval, s_dtval);
+    computeColumnGroups();
+    SPDLOG_LOGGER_INFO(mSLog,
+                       "Finite difference Jacobian with {} column groups",
+                       mColumnGroups.size());
+  }
+  SPDLOG_LOGGER_INFO(mSLog, "Sparse Jacobian with {} nonzeros for {} equations",
+                     mJacobian.nonZeros(), mNEQ);
+
+#ifdef WITH_SUNDIALS_KLU
+  A = SUNSparseMatrix(mNEQ, mNEQ, mJacobian.nonZeros(), CSC_MAT);
+  LS = SUNKLU(state, A);
+  if (!A || !LS)
+    throw SolverException();
+
+  if (IDADlsSetLinearSolver(mem, LS, A) < 0 ||
+      IDADlsSetJacFn(mem, &DAESolver::jacobianFunctionWrapper) < 0)
+    throw SolverException();
+#endif
+}
+
+void DAESolver::detectSparsityPattern(const double state[],
+                                      const double dstate_dt[]) {
+  // The first probe perturbs the initial values, the others perturb random
+  // points around them, so entries vanishing by coincidence at one point are
+  // still found. Probes disagreeing on the pattern mean that it depends on
+  // the operating point, then all entries are kept.
+  const Int numProbes = 3;
+  std::mt19937 generator(static_cast<std::mt19937::result_type>(mNEQ));
+  std::uniform_real_distribution<Real> distribution(-1., 1.);
+
+  std::vector<Real> baseState(mNEQ), baseDerivative(mNEQ), resid(mNEQ);
+  std::vector<Bool> isChanged(mNEQ);
+  std::vector<std::vector<std::pair<Int, Int>>> patterns(numProbes);
+  for (Int probe = 0; probe < numProbes; ++probe) {
+    for (Int idx = 0; idx < mNEQ; ++idx) {
+      Real spread = probe == 0 ? 0. : 0.1 * distribution(generator);
+      baseState[idx] = state[idx] + spread * std::max(std::abs(state[idx]), 1.);
+      baseDerivative[idx] = dstate_dt[idx] + spread;
+    }
+    evaluateResidual(mT0, baseState.data(), baseDerivative.data(),
+                     resid.data());
+
+    auto markChangedRows = [this, &resid, &isChanged]() {
+      for (Int row = 0; row < mNEQ; ++row) {
+        if (mPerturbedResidual[row] != resid[row])
+          isChanged[row] = true;
+      }
+    };
+
+    mPerturbedState = baseState;
+    mPerturbedDerivative = baseDerivative;
+    for (Int col = 0; col < mNEQ; ++col) {
+      Real increment = 1e-3 * (1.5 + 0.5 * distribution(generator)) *
+                       std::max(std::abs(baseState[col]), 1.);
+
+      // Residuals depending on the variable
+      mPerturbedState[col] += increment;
+      evaluateResidual(mT0, mPerturbedState.data(), baseDerivative.data(),
+                       mPerturbedResidual.data());
+      markChangedRows();
+      mPerturbedState[col] = baseState[col];
+
+      // Residuals depending on its derivative
+      mPerturbedDerivative[col] += increment;
+      evaluateResidual(mT0, baseState.data(), mPerturbedDerivative.data(),
+                       mPerturbedResidual.data());
+      markChangedRows();
+      mPerturbedDerivative[col] = baseDerivative[col];
+
+      // The diagonal is kept for pivoting
+      isChanged[col] = true;
+      for (Int row = 0; row < mNEQ; ++row) {
+        if (isChanged[row])
+          patterns[probe].emplace_back(row, col);
+        isChanged[row] = false;
+      }
+    }
+  }
+
+  std::vector<Eigen::Triplet<Real>> entries;
+  if (std::all_of(patterns.begin() + 1, patterns.end(),
+                  [&patterns](const std::vector<std::pair<Int, Int>> &pattern) {
+                    return pattern == patterns[0];
+                  })) {
+    for (const auto &entry : patterns[0])
+      entries.emplace_back(entry.first, entry.second, 0.);
+  } else {
+    SPDLOG_LOGGER_WARN(mSLog, "Sparsity pattern depends on the operating "
+                              "point, falling back to a dense pattern");
+    for (Int col = 0; col < mNEQ; ++col)
+      for (Int row = 0; row < mNEQ; ++row)
+        entries.emplace_back(row, col, 0.);
+  }
+
+  mJacobian.resize(mNEQ, mNEQ);
+  mJacobian.setFromTriplets(entries.begin(), entries.end());
+  mJacobian.makeCompressed();
+}
+
+void DAESolver::computeColumnGroups() {
+  // Row-major copy of the pattern to find the columns sharing a row
+  CPS::SparseMatrixRow pattern = mJacobian;
+  std::vector<Int> groupOfColumn(mNEQ, -1);
+  // Marks the groups which contain a column sharing a row with col
+  std::vector<Int> conflict;
+
+  mColumnGroups.clear();
+  for (Int col = 0; col < mNEQ; ++col) {
+    for (CPS::SparseMatrix::InnerIterator rowIt(mJacobian, col); rowIt;
+         ++rowIt) {
+      for (CPS::SparseMatrixRow::InnerIterator colIt(pattern, rowIt.row());
+           colIt; ++colIt) {
+        Int group = groupOfColumn[colIt.col()];
+        if (group >= 0)
+          conflict[group] = col;
+      }
+    }
+
+    Int group = 0;
+    while (group < static_cast<Int>(mColumnGroups.size()) &&
+           conflict[group] == col)
+      ++group;
+    if (group == static_cast<Int>(mColumnGroups.size())) {
+      mColumnGroups.emplace_back();
+      conflict.push_back(-1);
+    }
+    groupOfColumn[col] = group;
+    mColumnGroups[group].push_back(col);
+  }
+}
+
+void DAESolver::evaluateAnalyticJacobian(realtype ttime, realtype cj,
+                                         const double state[],
+                                         const double dstate_dt[]) {
+  if (mJacobian.isCompressed())
+    mJacobian.coeffs().setZero();
+
+  mOffsets[0] = 0;
+  mOffsets[1] = 0;
+  // Nodal voltage equations
+  for (UInt idx = 0; idx < mNodes.size(); ++idx) {
+    mJacobian.coeffRef(mOffsets[0], mOffsets[0]) -= 1.;
+    mOffsets[0] += 1;
+  }
+
+  for (const auto &jacFn : mJacobianFunctions) {
+    jacFn(ttime, state, dstate_dt, cj, mJacobian, mOffsets);
+  }
+}
+
+void DAESolver::evaluateFiniteDifferenceJacobian(realtype ttime, realtype cj,
+                                                 const double state[],
+                                                 const double dstate_dt[],
+                                                 const double resid[]) {
+  const Real relIncrement = std::sqrt(std::numeric_limits<Real>::epsilon());
+
+  mPerturbedState.assign(state, state + mNEQ);
+  mPerturbedDerivative.assign(dstate_dt, dstate_dt + mNEQ);
+  // Columns of a group do not share rows, so one residual evaluation
+  // yields the derivatives for all of them
+  for (const auto &group : mColumnGroups) {
+    for (Int col : group) {
+      mIncrements[col] = relIncrement * std::max(std::abs(state[col]), 1.);
+      mPerturbedState[col] += mIncrements[col];
+      mPerturbedDerivative[col] += cj * mIncrements[col];
+    }
+
+    evaluateResidual(ttime, mPerturbedState.data(),
+                     mPerturbedDerivative.data(), mPerturbedResidual.data());
+
+    for (Int col : group) {
+      for (CPS::SparseMatrix::InnerIterator it(mJacobian, col); it; ++it)
+        it.valueRef() =
+            (mPerturbedResidual[it.row()] - resid[it.row()]) / mIncrements[col];
+      mPerturbedState[col] = state[col];
+      mPerturbedDerivative[col] = dstate_dt[col];
+    }
+  }
+}
+
+#ifdef WITH_SUNDIALS_KLU
+int DAESolver::jacobianFunctionWrapper(realtype ttime, realtype cj,
+                                       N_Vector state, N_Vector dstate_dt,
+                                       N_Vector resid, SUNMatrix J,
+                                       void *user_data, N_Vector tmp1,
+                                       N_Vector tmp2, N_Vector tmp3) {
+  DAESolver *self = reinterpret_cast<DAESolver *>(user_data);
+
+  return self->jacobianFunction(ttime, cj, state, dstate_dt, resid, J);
+}
+
+int DAESolver::jacobianFunction(realtype ttime, realtype cj, N_Vector state,
+                                N_Vector dstate_dt, N_Vector resid,
+                                SUNMatrix J) {
+  if (mAnalyticJacobian) {
+    auto nonZeros = mJacobian.nonZeros();
+    evaluateAnalyticJacobian(ttime, cj, NV_DATA_S(state),
+                             NV_DATA_S(dstate_dt));
+    if (mJacobian.nonZeros() != nonZeros) {
+      SPDLOG_LOGGER_ERROR(mSLog, "Sparsity pattern of the Jacobian changed");
+      return -1;
+    }
+  } else {
+    evaluateFiniteDifferenceJacobian(ttime, cj, NV_DATA_S(state),
+                                     NV_DATA_S(dstate_dt), NV_DATA_S(resid));
+  }
+
+  // Both matrices are stored as compressed sparse columns
+  sunindextype *colPtrs = SM_INDEXPTRS_S(J);
+  sunindextype *rowIndices = SM_INDEXVALS_S(J);
+  realtype *values = SM_DATA_S(J);
+  for (Int col = 0; col <= mNEQ; ++col)
+    colPtrs[col] = mJacobian.outerIndexPtr()[col];
+  for (Int idx = 0; idx < mJacobian.nonZeros(); ++idx) {
+    rowIndices[idx] = mJacobian.innerIndexPtr()[idx];
+    values[idx] = mJacobian.valuePtr()[idx];
+  }
   return 0;
 }
+#endif
 
 Real DAESolver::step(Real time) {
 
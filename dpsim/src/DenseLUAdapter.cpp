@@ -39,4 +39,9 @@ void DenseLUAdapter::partialRefactorize(
 Matrix DenseLUAdapter::solve(Matrix &mRightHandSideVector) {
   return LUFactorized.solve(mRightHandSideVector);
 }
+
+void DenseLUAdapter::solve(Matrix &mRightHandSideVector,
+                           Matrix &mLeftHandSideVector) {
+  mLeftHandSideVector.noalias() = LUFactorized.solve(mRightHandSideVector);
+}
 } // namespace DPsim
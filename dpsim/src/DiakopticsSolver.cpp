@@ -22,12 +22,23 @@ namespace DPsim {
 template <typename VarType>
 DiakopticsSolver<VarType>::DiakopticsSolver(
     String name, SystemTopology system, IdentifiedObject::List tearComponents,
-    Real timeStep, Logger::Level logLevel)
-    : Solver(name, logLevel),
+    Real timeStep, Logger::Level logLevel,
+    DirectLinearSolverImpl implementation,
+    const DirectLinearSolverConfiguration &configuration)
+    : Solver(name, logLevel), mImplementationInUse(implementation),
+      mConfigurationInUse(configuration),
       mMappedTearCurrents(AttributeStatic<Matrix>::make()),
       mOrigLeftSideVector(AttributeStatic<Matrix>::make()) {
   mTimeStep = timeStep;
 
+  if (mImplementationInUse == DirectLinearSolverImpl::Undef) {
+#ifdef WITH_KLU
+    mImplementationInUse = DirectLinearSolverImpl::KLU;
+#else
+    mImplementationInUse = DirectLinearSolverImpl::SparseLU;
+#endif
+  }
+
   // Raw source and solution vector logging
   mLeftVectorLog = std::make_shared<DataLogger>(
       name + "_LeftVector", logLevel != CPS::Logger::Level::off);
@@ -214,8 +225,6 @@ template <> void DiakopticsSolver<Complex>::setLogColumns() {
 
 template <typename VarType> void DiakopticsSolver<VarType>::createMatrices() {
   UInt totalSize = mSubnets.back().sysOff + mSubnets.back().sysSize;
-  mSystemMatrix = Matrix::Zero(totalSize, totalSize);
-  mSystemInverse = Matrix::Zero(totalSize, totalSize);
 
   mRightSideVector = Matrix::Zero(totalSize, 1);
   mLeftSideVector = Matrix::Zero(totalSize, 1);
@@ -228,13 +237,15 @@ template <typename VarType> void DiakopticsSolver<VarType>::createMatrices() {
     // copy the solution there
     net.leftVector = AttributeStatic<Matrix>::make();
     net.leftVector->set(Matrix::Zero(net.sysSize, 1));
+    net.rightVector = Matrix::Zero(net.sysSize, 1);
+    net.solution = Matrix::Zero(net.sysSize, 1);
   }
 
   createTearMatrices(totalSize);
 }
 
 template <> void DiakopticsSolver<Real>::createTearMatrices(UInt totalSize) {
-  mTearTopology = Matrix::Zero(totalSize, mTearComponents.size());
+  mTearTopology = CPS::SparseMatrix(totalSize, mTearComponents.size());
   mTearImpedance =
       CPS::SparseMatrixRow(mTearComponents.size(), mTearComponents.size());
   mTearCurrents = Matrix::Zero(mTearComponents.size(), 1);
@@ -242,7 +253,7 @@ template <> void DiakopticsSolver<Real>::createTearMatrices(UInt totalSize) {
 }
 
 template <> void DiakopticsSolver<Complex>::createTearMatrices(UInt totalSize) {
-  mTearTopology = Matrix::Zero(totalSize, 2 * mTearComponents.size());
+  mTearTopology = CPS::SparseMatrix(totalSize, 2 * mTearComponents.size());
   mTearImpedance = CPS::SparseMatrixRow(2 * mTearComponents.size(),
                                         2 * mTearComponents.size());
   mTearCurrents = Matrix::Zero(2 * mTearComponents.size(), 1);
@@ -273,41 +284,74 @@ template <typename VarType> void DiakopticsSolver<VarType>::initComponents() {
     comp->initialize(mSystem.mSystemOmega, mTimeStep);
 }
 
+template <typename VarType>
+std::shared_ptr<DirectLinearSolver>
+DiakopticsSolver<VarType>::createDirectSolverImplementation() {
+  switch (mImplementationInUse) {
+  case DirectLinearSolverImpl::DenseLU:
+    return std::make_shared<DenseLUAdapter>(mSLog);
+  case DirectLinearSolverImpl::SparseLU:
+    return std::make_shared<SparseLUAdapter>(mSLog);
+#ifdef WITH_KLU
+  case DirectLinearSolverImpl::KLU:
+    return std::make_shared<KLUAdapter>(mSLog);
+#endif
+  default:
+    throw CPS::SystemError(
+        "unsupported linear solver implementation for diakoptics.");
+  }
+}
+
 template <typename VarType> void DiakopticsSolver<VarType>::initMatrices() {
+  std::vector<std::pair<UInt, UInt>> noVariableEntries;
   for (auto &net : mSubnets) {
-    // We can't directly pass the block reference to mnaApplySystemMatrixStamp,
-    // because it expects a concrete Matrix. It can't be changed to accept some common
-    // base class like DenseBase because that would make it a template function (as
-    // Eigen uses CRTP for polymorphism), which is impossible for virtual functions.
-    CPS::SparseMatrixRow partSys =
-        CPS::SparseMatrixRow(net.sysSize, net.sysSize);
+    net.sysMatrix = CPS::SparseMatrixRow(net.sysSize, net.sysSize);
     for (auto comp : net.components) {
-      comp->mnaApplySystemMatrixStamp(partSys);
+      comp->mnaApplySystemMatrixStamp(net.sysMatrix);
     }
-    auto block =
-        mSystemMatrix.block(net.sysOff, net.sysOff, net.sysSize, net.sysSize);
-    block = partSys;
-    SPDLOG_LOGGER_INFO(mSLog, "Block: \n{}", block);
-    net.luFactorization = Eigen::PartialPivLU<Matrix>(partSys);
-    SPDLOG_LOGGER_INFO(mSLog, "Factorization: \n{}",
-                       net.luFactorization.matrixLU());
+    net.sysMatrix.makeCompressed();
+    SPDLOG_LOGGER_INFO(mSLog, "Block: \n{}", net.sysMatrix);
+
+    net.solver = createDirectSolverImplementation();
+    net.solver->setConfiguration(mConfigurationInUse);
+    net.solver->preprocessing(net.sysMatrix, noVariableEntries);
+    net.solver->factorize(net.sysMatrix);
   }
-  SPDLOG_LOGGER_INFO(mSLog, "Complete system matrix: \n{}", mSystemMatrix);
 
   // initialize tear topology matrix and impedance matrix of removed network
   for (UInt compIdx = 0; compIdx < mTearComponents.size(); ++compIdx) {
     applyTearComponentStamp(compIdx);
   }
+  mTearTopology.makeCompressed();
   SPDLOG_LOGGER_INFO(mSLog, "Topology matrix: \n{}", mTearTopology);
   SPDLOG_LOGGER_INFO(mSLog, "Removed impedance matrix: \n{}", mTearImpedance);
-  // TODO this can be sped up as well by using the block diagonal form of Yinv
+
+  // Z' = Z + C^T * Y^-1 * C is accumulated subnet by subnet, as Y is block
+  // diagonal. Only the columns of C touching a subnet are solved for.
+  Matrix totalTearImpedance = mTearImpedance;
   for (auto &net : mSubnets) {
-    mSystemInverse.block(net.sysOff, net.sysOff, net.sysSize, net.sysSize) =
-        net.luFactorization.inverse();
+    Matrix topology = mTearTopology.middleRows(net.sysOff, net.sysSize);
+    std::vector<UInt> columns;
+    for (UInt col = 0; col < static_cast<UInt>(topology.cols()); ++col) {
+      if (!topology.col(col).isZero())
+        columns.push_back(col);
+    }
+    if (columns.empty())
+      continue;
+
+    Matrix rhs(net.sysSize, columns.size());
+    for (UInt idx = 0; idx < columns.size(); ++idx)
+      rhs.col(idx) = topology.col(columns[idx]);
+    Matrix sol = net.solver->solve(rhs);
+
+    for (UInt row = 0; row < columns.size(); ++row) {
+      for (UInt col = 0; col < columns.size(); ++col) {
+        totalTearImpedance(columns[row], columns[col]) +=
+            rhs.col(row).dot(sol.col(col));
+      }
+    }
   }
-  mTotalTearImpedance = Eigen::PartialPivLU<Matrix>(
-      mTearImpedance +
-      mTearTopology.transpose() * mSystemInverse * mTearTopology);
+  mTotalTearImpedance = Eigen::PartialPivLU<Matrix>(totalTearImpedance);
   SPDLOG_LOGGER_INFO(mSLog,
                      "Total removed impedance matrix LU decomposition: \n{}",
                      mTotalTearImpedance.matrixLU());
@@ -325,12 +369,12 @@ template <typename VarType> void DiakopticsSolver<VarType>::initMatrices() {
 
 template <> void DiakopticsSolver<Real>::applyTearComponentStamp(UInt compIdx) {
   auto comp = mTearComponents[compIdx];
-  mTearTopology(mNodeSubnetMap[comp->node(0)]->sysOff +
-                    comp->node(0)->matrixNodeIndex(),
-                compIdx) = 1;
-  mTearTopology(mNodeSubnetMap[comp->node(1)]->sysOff +
-                    comp->node(1)->matrixNodeIndex(),
-                compIdx) = -1;
+  mTearTopology.coeffRef(mNodeSubnetMap[comp->node(0)]->sysOff +
+                             comp->node(0)->matrixNodeIndex(),
+                         compIdx) = 1;
+  mTearTopology.coeffRef(mNodeSubnetMap[comp->node(1)]->sysOff +
+                             comp->node(1)->matrixNodeIndex(),
+                         compIdx) = -1;
 
   auto tearComp = std::dynamic_pointer_cast<MNATearInterface>(comp);
   tearComp->mnaTearApplyMatrixStamp(mTearImpedance);
@@ -343,14 +387,16 @@ void DiakopticsSolver<Complex>::applyTearComponentStamp(UInt compIdx) {
   auto net1 = mNodeSubnetMap[comp->node(0)];
   auto net2 = mNodeSubnetMap[comp->node(1)];
 
-  mTearTopology(net1->sysOff + comp->node(0)->matrixNodeIndex(), compIdx) = 1;
-  mTearTopology(net1->sysOff + net1->mCmplOff +
-                    comp->node(0)->matrixNodeIndex(),
-                mTearComponents.size() + compIdx) = 1;
-  mTearTopology(net2->sysOff + comp->node(1)->matrixNodeIndex(), compIdx) = -1;
-  mTearTopology(net2->sysOff + net2->mCmplOff +
-                    comp->node(1)->matrixNodeIndex(),
-                mTearComponents.size() + compIdx) = -1;
+  mTearTopology.coeffRef(net1->sysOff + comp->node(0)->matrixNodeIndex(),
+                         compIdx) = 1;
+  mTearTopology.coeffRef(net1->sysOff + net1->mCmplOff +
+                             comp->node(0)->matrixNodeIndex(),
+                         mTearComponents.size() + compIdx) = 1;
+  mTearTopology.coeffRef(net2->sysOff + comp->node(1)->matrixNodeIndex(),
+                         compIdx) = -1;
+  mTearTopology.coeffRef(net2->sysOff + net2->mCmplOff +
+                             comp->node(1)->matrixNodeIndex(),
+                         mTearComponents.size() + compIdx) = -1;
 
   auto tearComp = std::dynamic_pointer_cast<MNATearInterface>(comp);
   tearComp->mnaTearApplyMatrixStamp(mTearImpedance);
@@ -389,17 +435,16 @@ template <typename VarType> Task::List DiakopticsSolver<VarType>::getTasks() {
 template <typename VarType>
 void DiakopticsSolver<VarType>::SubnetSolveTask::execute(Real time,
                                                          Int timeStepCount) {
-  auto rBlock =
-      mSolver.mRightSideVector.block(mSubnet.sysOff, 0, mSubnet.sysSize, 1);
-  rBlock.setZero();
-
+  mSubnet.rightVector.setZero();
   for (auto stamp : mSubnet.rightVectorStamps)
-    rBlock += *stamp;
+    mSubnet.rightVector += *stamp;
+  mSolver.mRightSideVector.block(mSubnet.sysOff, 0, mSubnet.sysSize, 1) =
+      mSubnet.rightVector;
 
-  auto lBlock = (**mSolver.mOrigLeftSideVector)
-                    .block(mSubnet.sysOff, 0, mSubnet.sysSize, 1);
   // Solve Y' * v' = I
-  lBlock = mSubnet.luFactorization.solve(rBlock);
+  mSubnet.solver->solve(mSubnet.rightVector, mSubnet.solution);
+  (**mSolver.mOrigLeftSideVector)
+      .block(mSubnet.sysOff, 0, mSubnet.sysSize, 1) = mSubnet.solution;
 }
 
 template <typename VarType>
@@ -426,11 +471,12 @@ void DiakopticsSolver<VarType>::SolveTask::execute(Real time,
                                                    Int timeStepCount) {
   auto lBlock =
       mSolver.mLeftSideVector.block(mSubnet.sysOff, 0, mSubnet.sysSize, 1);
-  auto rBlock = (**mSolver.mMappedTearCurrents)
-                    .block(mSubnet.sysOff, 0, mSubnet.sysSize, 1);
+  mSubnet.rightVector = (**mSolver.mMappedTearCurrents)
+                            .block(mSubnet.sysOff, 0, mSubnet.sysSize, 1);
   // Solve Y' * x = C * i
   // v = v' + x
-  lBlock += mSubnet.luFactorization.solve(rBlock);
+  mSubnet.solver->solve(mSubnet.rightVector, mSubnet.solution);
+  lBlock += mSubnet.solution;
   **mSubnet.leftVector = lBlock;
 }
 
@@ -6,6 +6,8 @@
  * file, You can obtain one at https://mozilla.org/MPL/2.0/.
  *********************************************************************************/
 
+#include <limits>
+
 #include <dpsim/Event.h>
 
 using namespace DPsim;
@@ -13,8 +15,9 @@ using namespace CPS;
 
 void EventQueue::addEvent(Event::Ptr e) { mEvents.push(e); }
 
-void EventQueue::handleEvents(Real currentTime) {
+Bool EventQueue::handleEvents(Real currentTime) {
   Event::Ptr e;
+  Bool handled = false;
 
   while (!mEvents.empty()) {
     e = mEvents.top();
@@ -26,8 +29,26 @@ void EventQueue::handleEvents(Real currentTime) {
       //std::cout << std::scientific << e->mTime << ": Original event time" << std::endl;
       //std::cout << std::scientific << (e->mTime - currentTime)*1e9 << ": Difference to specified event time in ns" << std::endl;
       mEvents.pop();
+      handled = true;
     } else {
       break;
     }
   }
+  return handled;
+}
+
+Real EventQueue::nextEventTime() const {
+  if (mEvents.empty())
+    return std::numeric_limits<Real>::infinity();
+  return mEvents.top()->mTime;
+}
+
+void EventQueue::skipEvents(Real currentTime) {
+  while (!mEvents.empty()) {
+    auto e = mEvents.top();
+    if (currentTime > e->mTime || (e->mTime - currentTime) < 100e-9)
+      mEvents.pop();
+    else
+      break;
+  }
 }
@@ -18,6 +18,16 @@ void InterfaceQueued::open() {
     mInterfaceReaderThread = std::thread(InterfaceQueued::ReaderThread(mQueueInterfaceToDpsim, mInterfaceWorker, mOpened));
   }
   if (!mExportAttrsDpsim.empty()) {
+    // Preallocate the value slots and the queue so that exporting does not allocate in steady state
+    mExportSlots.clear();
+    mNextExportSlot.assign(mExportAttrsDpsim.size(), 0);
+    for (const auto &[attr, _seqId] : mExportAttrsDpsim) {
+      auto &slots = mExportSlots.emplace_back();
+      for (UInt i = 0; i < EXPORT_SLOTS; i++) {
+        slots.push_back(attr->cloneValueOntoNewAttribute().getPtr());
+      }
+    }
+    mQueueDpsimToInterface = std::make_shared<moodycamel::BlockingReaderWriterQueue<AttributePacket>>(mExportAttrsDpsim.size() * EXPORT_SLOTS + 1);
     mInterfaceWriterThread = std::thread(InterfaceQueued::WriterThread(mQueueDpsimToInterface, mInterfaceWorker));
   }
 }
@@ -114,9 +124,34 @@ void InterfaceQueued::popDpsimAttrsFromQueue(bool isSync) {
   }
 }
 
+std::shared_ptr<CPS::AttributeBase> &InterfaceQueued::acquireExportSlot(UInt attrIdx) {
+  auto &slots = mExportSlots[attrIdx];
+  for (UInt i = 0; i < slots.size(); i++) {
+    UInt slotIdx = (mNextExportSlot[attrIdx] + i) % slots.size();
+    // Only this thread creates new references, so a slot without other owners stays free
+    if (slots[slotIdx].use_count() == 1) {
+      // Synchronize with the release of the last packet reference in the writer thread
+      std::atomic_thread_fence(std::memory_order_acquire);
+      mNextExportSlot[attrIdx] = slotIdx + 1;
+      return slots[slotIdx];
+    }
+  }
+
+  // All slots are still in flight, so the writer thread is lagging behind
+  SPDLOG_LOGGER_DEBUG(mLog, "Adding export slot {} for attribute {}", slots.size(), attrIdx);
+  slots.push_back(std::get<0>(mExportAttrsDpsim[attrIdx])->cloneValueOntoNewAttribute().getPtr());
+  mNextExportSlot[attrIdx] = 0;
+  return slots.back();
+}
+
 void InterfaceQueued::pushDpsimAttrsToQueue() {
   for (UInt i = 0; i < mExportAttrsDpsim.size(); i++) {
-    mQueueDpsimToInterface->emplace(AttributePacket{std::get<0>(mExportAttrsDpsim[i])->cloneValueOntoNewAttribute(), i, std::get<1>(mExportAttrsDpsim[i]), AttributePacketFlags::PACKET_NO_FLAGS});
+    auto &slot = acquireExportSlot(i);
+    slot->copyValue(std::get<0>(mExportAttrsDpsim[i]));
+    AttributePacket packet{slot, i, std::get<1>(mExportAttrsDpsim[i]), AttributePacketFlags::PACKET_NO_FLAGS};
+    // Only allocates if the writer thread is lagging behind and the queue is full
+    if (!mQueueDpsimToInterface->try_enqueue(packet))
+      mQueueDpsimToInterface->enqueue(packet);
     std::get<1>(mExportAttrsDpsim[i]) = mCurrentSequenceDpsimToInterface;
     mCurrentSequenceDpsimToInterface++;
   }
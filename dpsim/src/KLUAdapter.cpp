@@ -12,8 +12,7 @@ using namespace DPsim;
 
 namespace DPsim {
 KLUAdapter::~KLUAdapter() {
-  if (mSymbolic)
-    klu_free_symbolic(&mSymbolic, &mCommon);
+  freeSymbolic();
   if (mNumeric)
     klu_free_numeric(&mNumeric, &mCommon);
   SPDLOG_LOGGER_INFO(mSLog, "Number of Pivot Faults: {}", mPivotFaults);
@@ -40,9 +39,7 @@ KLUAdapter::KLUAdapter(CPS::Logger::Log log) : KLUAdapter() {
 void KLUAdapter::preprocessing(
     SparseMatrix &systemMatrix,
     std::vector<std::pair<UInt, UInt>> &listVariableSystemMatrixEntries) {
-  if (mSymbolic) {
-    klu_free_symbolic(&mSymbolic, &mCommon);
-  }
+  freeSymbolic();
 
   const Int n = Eigen::internal::convert_index<Int>(systemMatrix.rows());
 
@@ -61,16 +58,46 @@ void KLUAdapter::preprocessing(
     mVaryingColumns.push_back(changedEntry.second);
   }
 
-  // this call also works if mVaryingColumns, mVaryingRows are empty
-  mSymbolic =
-      klu_analyze_partial(n, Ap, Ai, &mVaryingColumns[0], &mVaryingRows[0],
-                          varying_entries, mPreordering, &mCommon);
+  // The factorization paths of partial refactorization are computed per
+  // adapter, so only analyses without varying entries are shared
+  if (mSymbolicAnalysisCache && mChangedEntries.empty()) {
+    String options = "KLU ordering=" + std::to_string(mPreordering) +
+                     " btf=" + std::to_string(mCommon.btf);
+    klu_common common = mCommon;
+    mSharedSymbolic = mSymbolicAnalysisCache->analysis(
+        systemMatrix, options, [&]() -> std::shared_ptr<void> {
+          klu_symbolic *symbolic = klu_analyze_partial(
+              n, Ap, Ai, mVaryingColumns.data(), mVaryingRows.data(), 0,
+              mPreordering, &common);
+          return std::shared_ptr<void>(symbolic, [](void *ptr) {
+            auto symbolic = static_cast<klu_symbolic *>(ptr);
+            klu_common common;
+            klu_defaults(&common);
+            klu_free_symbolic(&symbolic, &common);
+          });
+        });
+    mSymbolic = static_cast<klu_symbolic *>(mSharedSymbolic.get());
+  } else {
+    // this call also works if mVaryingColumns, mVaryingRows are empty
+    mSymbolic =
+        klu_analyze_partial(n, Ap, Ai, &mVaryingColumns[0], &mVaryingRows[0],
+                            varying_entries, mPreordering, &mCommon);
+  }
 
   /* store non-zero value of current preprocessed matrix. only used until
      * to-do in refactorize-function is resolved. Can be removed then. */
   nnz = Eigen::internal::convert_index<Int>(systemMatrix.nonZeros());
 }
 
+void KLUAdapter::freeSymbolic() {
+  if (mSharedSymbolic) {
+    mSharedSymbolic.reset();
+    mSymbolic = nullptr;
+  } else if (mSymbolic) {
+    klu_free_symbolic(&mSymbolic, &mCommon);
+  }
+}
+
 void KLUAdapter::factorize(SparseMatrix &systemMatrix) {
   if (mNumeric) {
     klu_free_numeric(&mNumeric, &mCommon);
@@ -169,6 +196,18 @@ Matrix KLUAdapter::solve(Matrix &rightSideVector) {
   return x;
 }
 
+void KLUAdapter::solve(Matrix &rightSideVector, Matrix &leftSideVector) {
+  // copy into preallocated storage, no reallocation if the sizes match
+  leftSideVector = rightSideVector;
+
+  Int rhsCols = Eigen::internal::convert_index<Int>(leftSideVector.cols());
+  Int rhsRows = Eigen::internal::convert_index<Int>(leftSideVector.rows());
+
+  /* see solve(Matrix &) on why the transpose solve is used */
+  klu_tsolve(mSymbolic, mNumeric, rhsRows, rhsCols, leftSideVector.data(),
+             &mCommon);
+}
+
 void KLUAdapter::printMatrixMarket(SparseMatrix &matrix, int counter) const {
   std::string outputName = "A" + std::to_string(counter) + ".mtx";
   Int n = Eigen::internal::convert_index<Int>(matrix.rows());
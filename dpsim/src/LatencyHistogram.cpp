@@ -0,0 +1,103 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+
+#include <dpsim/LatencyHistogram.h>
+
+using namespace DPsim;
+
+void LatencyHistogram::record(Duration duration) {
+  auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration);
+  std::uint64_t value = ns.count() > 0 ? ns.count() : 0;
+
+  // Only one thread is recording, so plain loads and stores suffice and
+  // concurrent readers never see torn values
+  auto &bucket = mBuckets[bucketIndex(value)];
+  bucket.store(bucket.load(std::memory_order_relaxed) + 1,
+               std::memory_order_relaxed);
+  mSum.store(mSum.load(std::memory_order_relaxed) + value,
+             std::memory_order_relaxed);
+  if (value > mMax.load(std::memory_order_relaxed))
+    mMax.store(value, std::memory_order_relaxed);
+  mCount.store(mCount.load(std::memory_order_relaxed) + 1,
+               std::memory_order_release);
+}
+
+void LatencyHistogram::reset() {
+  for (auto &bucket : mBuckets)
+    bucket.store(0, std::memory_order_relaxed);
+  mCount.store(0, std::memory_order_relaxed);
+  mSum.store(0, std::memory_order_relaxed);
+  mMax.store(0, std::memory_order_relaxed);
+}
+
+LatencyHistogram::Duration LatencyHistogram::mean() const {
+  auto count = mCount.load(std::memory_order_acquire);
+  if (count == 0)
+    return Duration(0);
+  return std::chrono::duration_cast<Duration>(std::chrono::nanoseconds(
+      mSum.load(std::memory_order_relaxed) / count));
+}
+
+LatencyHistogram::Duration LatencyHistogram::max() const {
+  return std::chrono::duration_cast<Duration>(
+      std::chrono::nanoseconds(mMax.load(std::memory_order_relaxed)));
+}
+
+LatencyHistogram::Duration LatencyHistogram::percentile(Real quantile) const {
+  auto count = mCount.load(std::memory_order_acquire);
+  if (count == 0)
+    return Duration(0);
+
+  quantile = std::min(std::max(quantile, 0.), 1.);
+  auto target = std::max<std::uint64_t>(
+      static_cast<std::uint64_t>(std::ceil(quantile * count)), 1);
+  std::uint64_t cumulated = 0;
+  std::uint64_t value = 0;
+  for (UInt idx = 0; idx < NUM_BUCKETS; ++idx) {
+    cumulated += mBuckets[idx].load(std::memory_order_relaxed);
+    if (cumulated >= target) {
+      value = bucketUpperBound(idx);
+      break;
+    }
+  }
+  // The last bucket is unbounded, so the maximum is the best estimate there
+  auto max = mMax.load(std::memory_order_relaxed);
+  if (value > max || cumulated < target ||
+      value == bucketUpperBound(NUM_BUCKETS - 1))
+    value = max;
+  return std::chrono::duration_cast<Duration>(std::chrono::nanoseconds(value));
+}
+
+UInt LatencyHistogram::bucketIndex(std::uint64_t value) {
+  if (value < SUB_BUCKETS)
+    return static_cast<UInt>(value);
+
+  UInt exponent = 0;
+  for (auto v = value; v > 1; v >>= 1)
+    ++exponent;
+  if (exponent >= MAX_EXPONENT)
+    return NUM_BUCKETS - 1;
+
+  // Values in [2^e, 2^(e+1)) are split into SUB_BUCKETS linear buckets
+  UInt shift = exponent - SUB_BUCKET_BITS;
+  return (shift + 1) * SUB_BUCKETS +
+         static_cast<UInt>((value >> shift) - SUB_BUCKETS);
+}
+
+std::uint64_t LatencyHistogram::bucketUpperBound(UInt index) {
+  if (index < SUB_BUCKETS)
+    return index;
+
+  UInt shift = index / SUB_BUCKETS - 1;
+  std::uint64_t lower =
+      static_cast<std::uint64_t>(SUB_BUCKETS + index % SUB_BUCKETS) << shift;
+  return lower + (std::uint64_t(1) << shift) - 1;
+}
@@ -6,9 +6,14 @@
  * file, You can obtain one at https://mozilla.org/MPL/2.0/.
  *********************************************************************************/
 
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
 #include <dpsim/MNASolver.h>
 #include <dpsim/SequentialScheduler.h>
 #include <memory>
+#include <set>
 
 using namespace DPsim;
 using namespace CPS;
@@ -62,6 +67,8 @@ template <typename VarType> void MnaSolver<VarType>::initialize() {
   // We need to differentiate between power and signal components and
   // ground nodes should be ignored.
   identifyTopologyObjects();
+  if (mVariableTimeStep)
+    collectVariableTimeStepComponents();
   // These steps complete the network information.
   collectVirtualNodes();
   assignMatrixNodeIndices();
@@ -128,7 +135,7 @@ template <> void MnaSolver<Real>::initializeComponents() {
     comp->mnaInitialize(mSystem.mSystemOmega, mTimeStep, mLeftSideVector);
     const Matrix &stamp = comp->getRightVector()->get();
     if (stamp.size() != 0) {
-      mRightVectorStamps.push_back(&stamp);
+      addRightVectorStamp(comp, stamp);
     }
   }
 
@@ -171,8 +178,11 @@ template <> void MnaSolver<Complex>::initializeComponents() {
       comp->mnaInitializeHarm(mSystem.mSystemOmega, mTimeStep,
                               mLeftSideVectorHarm);
       const Matrix &stamp = comp->getRightVector()->get();
-      if (stamp.size() != 0)
+      if (stamp.size() != 0) {
+        // stamps of all frequencies are summed up column-wise
         mRightVectorStamps.push_back(&stamp);
+        mRightVectorStampIndices.push_back({});
+      }
     }
     // Initialize nodes
     for (UInt nodeIdx = 0; nodeIdx < mNodes.size(); ++nodeIdx) {
@@ -184,7 +194,7 @@ template <> void MnaSolver<Complex>::initializeComponents() {
       comp->mnaInitialize(mSystem.mSystemOmega, mTimeStep, mLeftSideVector);
       const Matrix &stamp = comp->getRightVector()->get();
       if (stamp.size() != 0) {
-        mRightVectorStamps.push_back(&stamp);
+        addRightVectorStamp(comp, stamp);
       }
     }
 
@@ -238,20 +248,7 @@ void MnaSolver<VarType>::initializeSystemWithParallelFrequencies() {
 
 template <typename VarType>
 void MnaSolver<VarType>::initializeSystemWithPrecomputedMatrices() {
-  // iterate over all possible switch state combinations
-  for (std::size_t i = 0; i < (1ULL << mSwitches.size()); i++) {
-    switchedMatrixEmpty(i);
-  }
-
-  if (mSwitches.size() < 1) {
-    switchedMatrixStamp(0, mMNAComponents);
-  } else {
-    // Generate switching state dependent system matrices
-    for (std::size_t i = 0; i < (1ULL << mSwitches.size()); i++) {
-      switchedMatrixStamp(i, mMNAComponents);
-    }
-    updateSwitchStatus();
-  }
+  stampPrecomputedSystemMatrices();
 
   // Initialize source vector for debugging
   // CAUTION: this does not always deliver proper source vector initialization
@@ -267,6 +264,31 @@ void MnaSolver<VarType>::initializeSystemWithPrecomputedMatrices() {
   }
 }
 
+template <typename VarType>
+void MnaSolver<VarType>::stampPrecomputedSystemMatrices() {
+  if (mSwitches.size() < 1) {
+    switchedMatrixEmpty(0);
+    switchedMatrixStamp(0, mMNAComponents);
+  } else if (mLazySwitchedMatrices) {
+    // Only the current switch status is stamped here, all other
+    // combinations are factorized once they occur during the simulation
+    updateSwitchStatus();
+    switchedMatrixEmpty(mCurrentSwitchStatus.to_ullong());
+    switchedMatrixStamp(mCurrentSwitchStatus.to_ullong(), mMNAComponents);
+  } else {
+    // iterate over all possible switch state combinations
+    for (std::size_t i = 0; i < (1ULL << mSwitches.size()); i++) {
+      switchedMatrixEmpty(i);
+    }
+
+    // Generate switching state dependent system matrices
+    for (std::size_t i = 0; i < (1ULL << mSwitches.size()); i++) {
+      switchedMatrixStamp(i, mMNAComponents);
+    }
+    updateSwitchStatus();
+  }
+}
+
 template <typename VarType>
 void MnaSolver<VarType>::initializeSystemWithVariableMatrix() {
 
@@ -308,6 +330,83 @@ Bool MnaSolver<VarType>::hasVariableComponentChanged() {
   return false;
 }
 
+template <typename VarType>
+void MnaSolver<VarType>::addRightVectorStamp(CPS::MNAInterface::Ptr comp,
+                                             const Matrix &stamp) {
+  mRightVectorStamps.push_back(&stamp);
+  mRightVectorStampIndices.push_back(rightVectorStampIndices(comp, stamp));
+}
+
+template <typename VarType>
+std::vector<UInt>
+MnaSolver<VarType>::rightVectorStampIndices(CPS::MNAInterface::Ptr comp,
+                                            const Matrix &stamp) {
+  // Only components declaring their stamp entries are added sparsely
+  auto pComp = std::dynamic_pointer_cast<SimPowerComp<VarType>>(comp);
+  if (!pComp || stamp.cols() != 1)
+    return {};
+
+  // Collect the matrix node indices of all (virtual) nodes of the
+  // component and its subcomponents, which all have to declare their entries
+  std::set<UInt> nodeIndices;
+  std::vector<typename SimPowerComp<VarType>::Ptr> comps = {pComp};
+  while (!comps.empty()) {
+    auto current = comps.back();
+    comps.pop_back();
+    if (!std::dynamic_pointer_cast<MNALocalRightVectorInterface>(current))
+      return {};
+    for (auto terminal : current->terminals()) {
+      auto node = terminal ? terminal->node() : nullptr;
+      if (node && !node->isGround())
+        for (auto idx : node->matrixNodeIndices())
+          nodeIndices.insert(idx);
+    }
+    for (auto node : current->virtualNodes()) {
+      if (node && !node->isGround())
+        for (auto idx : node->matrixNodeIndices())
+          nodeIndices.insert(idx);
+    }
+    for (auto subComp : current->subComponents())
+      comps.push_back(subComp);
+  }
+
+  // Map node indices to vector entries, see Math::setVectorElement
+  std::vector<UInt> indices;
+  if (std::is_same<VarType, Complex>::value) {
+    Int numFreqs = static_cast<Int>(mSystem.mFrequencies.size());
+    UInt harmonicOffset = static_cast<UInt>(stamp.rows() / numFreqs);
+    UInt complexOffset = harmonicOffset / 2;
+    for (Int freq = 0; freq < numFreqs; ++freq) {
+      for (auto idx : nodeIndices) {
+        indices.push_back(idx + harmonicOffset * freq);
+        indices.push_back(idx + harmonicOffset * freq + complexOffset);
+      }
+    }
+  } else {
+    indices.assign(nodeIndices.begin(), nodeIndices.end());
+  }
+
+  for (auto idx : indices)
+    if (idx >= stamp.rows())
+      return {};
+  return indices;
+}
+
+template <typename VarType>
+void MnaSolver<VarType>::assembleRightSideVector() {
+  mRightSideVector.setZero();
+  for (std::size_t i = 0; i < mRightVectorStamps.size(); ++i) {
+    const Matrix &stamp = *mRightVectorStamps[i];
+    const auto &indices = mRightVectorStampIndices[i];
+    if (indices.empty()) {
+      mRightSideVector += stamp;
+    } else {
+      for (auto idx : indices)
+        mRightSideVector(idx, 0) += stamp(idx, 0);
+    }
+  }
+}
+
 template <typename VarType> void MnaSolver<VarType>::updateSwitchStatus() {
   for (UInt i = 0; i < mSwitches.size(); ++i) {
     mCurrentSwitchStatus.set(i, mSwitches[i]->mnaIsClosed());
@@ -360,6 +459,75 @@ template <typename VarType> void MnaSolver<VarType>::identifyTopologyObjects() {
   }
 }
 
+template <typename VarType>
+void MnaSolver<VarType>::collectVariableTimeStepComponents() {
+  if (mFrequencyParallel || mSystemMatrixRecomputation)
+    throw SystemError("Variable time steps require precomputed system "
+                      "matrices without frequency parallelization.");
+  // These components integrate their states with the time step of the MNA
+  // initialization or change the system matrix themselves
+  if (!mVariableComps.empty() || !mSyncGen.empty() || !mSimSignalComps.empty())
+    throw SystemError("Variable time steps are not supported for variable "
+                      "components, iterated generators and signal components.");
+
+  // Components have to update their companion model to the new time step or
+  // declare that they do not depend on it. Subcomponents are updated by
+  // their parent, which therefore has to support variable time steps itself.
+  for (auto comp : mMNAComponents) {
+    std::vector<std::pair<CPS::MNAInterface::Ptr, Bool>> comps = {{comp, true}};
+    while (!comps.empty()) {
+      auto current = comps.back().first;
+      Bool isUpdated = comps.back().second;
+      comps.pop_back();
+
+      auto varStepComp =
+          std::dynamic_pointer_cast<CPS::MNAVariableTimeStepInterface>(current);
+      if ((varStepComp && !isUpdated) ||
+          (!varStepComp &&
+           !std::dynamic_pointer_cast<CPS::MNATimeStepIndependentInterface>(
+               current))) {
+        auto idObj = std::dynamic_pointer_cast<IdentifiedObject>(current);
+        throw SystemError("Variable time steps are not supported by " +
+                          idObj->type() + " " + idObj->name() + ".");
+      }
+      if (varStepComp && current == comp)
+        mVariableTimeStepComps.push_back(varStepComp);
+
+      auto pComp = std::dynamic_pointer_cast<SimPowerComp<VarType>>(current);
+      if (!pComp)
+        continue;
+      for (auto subComp : pComp->subComponents()) {
+        auto mnaSubComp = std::dynamic_pointer_cast<CPS::MNAInterface>(subComp);
+        if (mnaSubComp)
+          comps.push_back({mnaSubComp, varStepComp != nullptr});
+      }
+    }
+  }
+  SPDLOG_LOGGER_INFO(mSLog,
+                     "{} components with time step dependent companion model",
+                     mVariableTimeStepComps.size());
+}
+
+template <typename VarType> Real MnaSolver<VarType>::stepErrorEstimate() {
+  const Matrix &leftVector = **mLeftSideVector;
+  Real error = 0;
+  if (mNumPrevLeftSideVectors == 2) {
+    Real ratio = mTimeStep / mPrevTimeStep;
+    Real max = leftVector.lpNorm<Eigen::Infinity>();
+    if (max > 0)
+      error = (leftVector - (1 + ratio) * mPrevLeftSideVector +
+               ratio * mPrevPrevLeftSideVector)
+                  .lpNorm<Eigen::Infinity>() /
+              max;
+  }
+
+  mPrevPrevLeftSideVector.swap(mPrevLeftSideVector);
+  mPrevLeftSideVector = leftVector;
+  mPrevTimeStep = mTimeStep;
+  mNumPrevLeftSideVectors = std::min<UInt>(mNumPrevLeftSideVectors + 1, 2);
+  return error;
+}
+
 template <typename VarType> void MnaSolver<VarType>::assignMatrixNodeIndices() {
   UInt matrixNodeIndexIdx = 0;
   for (UInt idx = 0; idx < mNodes.size(); ++idx) {
@@ -485,10 +653,10 @@ void MnaSolver<VarType>::steadyStateInitialization() {
   SPDLOG_LOGGER_INFO(mSLog, "--- Run steady-state initialization ---");
 
   DataLogger initLeftVectorLog(mName + "_InitLeftVector",
-                               mLogLevel != CPS::Logger::Level::off);
+                               mSteadStIniVectorLogging);
   initLeftVectorLog.start();
   DataLogger initRightVectorLog(mName + "_InitRightVector",
-                                mLogLevel != CPS::Logger::Level::off);
+                                mSteadStIniVectorLogging);
   initRightVectorLog.start();
 
   TopologicalPowerComp::Behaviour initBehaviourPowerComps =
@@ -496,19 +664,97 @@ void MnaSolver<VarType>::steadyStateInitialization() {
   SimSignalComp::Behaviour initBehaviourSignalComps =
       SimSignalComp::Behaviour::Initialization;
 
-  // TODO: enable use of timestep distinct from simulation timestep
+  // A dedicated time step and the extrapolation of the solution require all
+  // components to follow a change of the time step and to derive their
+  // history from their interface quantities
+  Bool changeTimeStep =
+      mSteadStIniTimeStep > 0 && mSteadStIniTimeStep != mTimeStep;
+  Bool extrapolate = mSteadStIniExtrapolation;
+  if ((changeTimeStep || extrapolate) && !mVariableTimeStep) {
+    try {
+      collectVariableTimeStepComponents();
+    } catch (SystemError &e) {
+      SPDLOG_LOGGER_WARN(mSLog,
+                         "Steady-state initialization with the simulation "
+                         "time step and without extrapolation: {}",
+                         e.descr());
+      mVariableTimeStepComps.clear();
+      changeTimeStep = false;
+      extrapolate = false;
+    }
+  }
+
   Real initTimeStep = mTimeStep;
+  if (changeTimeStep) {
+    initTimeStep = mSteadStIniTimeStep;
+    // A fundamental period has to be a multiple of the EMT time step for the
+    // extrapolation
+    if (mDomain == CPS::Domain::EMT && mSystem.mSystemFrequency > 0)
+      initTimeStep =
+          1. / (mSystem.mSystemFrequency *
+                std::max(1., std::round(1. / (mSystem.mSystemFrequency *
+                                              initTimeStep))));
+    for (auto comp : mVariableTimeStepComps)
+      comp->mnaUpdateTimeStep(mSystem.mSystemOmega, initTimeStep);
+  }
 
   Int timeStepCount = 0;
   Real time = 0;
   Real maxDiff = 1.0;
   Real max = 1.0;
-  Matrix diff = Matrix::Zero(2 * mNumNodes, 1);
-  Matrix prevLeftSideVector = Matrix::Zero(2 * mNumNodes, 1);
+  Matrix diff;
+  Matrix refLeftSideVector;
+  Matrix prevLeftSideVector;
+
+  // The solution is compared with the one a fundamental period earlier. For
+  // phasors, this is the previous step. The EMT node values oscillate, so
+  // the solution one period after the reference step is interpolated between
+  // the two nearest steps.
+  Real periodSteps = 1;
+  if (mDomain == CPS::Domain::EMT && mSystem.mSystemFrequency > 0)
+    periodSteps = std::max(1., 1. / (mSystem.mSystemFrequency * initTimeStep));
+  if (std::abs(periodSteps - std::round(periodSteps)) < 1e-6)
+    periodSteps = std::round(periodSteps);
+  const Int periodStepsLow = static_cast<Int>(periodSteps);
+  const Real periodFraction = periodSteps - periodStepsLow;
+  Int refStep = 0;
+  Bool converged = false;
+
+  // The transient decays by about the same factor in every period. Once this
+  // factor is known from two consecutive periods, the node voltages and
+  // interface quantities are extrapolated to the limit of the geometric
+  // series, which the time stepping then corrects.
+  if (periodFraction > 0)
+    extrapolate = false;
+  std::vector<typename Attribute<MatrixVar<VarType>>::Ptr> states;
+  std::vector<MatrixVar<VarType>> refStates;
+  Matrix prevDiff;
+  UInt numExtrapolations = 0;
+  if (extrapolate) {
+    for (auto node : mNodes)
+      states.push_back(node->mVoltage);
+    std::function<void(typename SimPowerComp<VarType>::Ptr)> addStates =
+        [&](typename SimPowerComp<VarType>::Ptr comp) {
+          states.push_back(comp->mIntfVoltage);
+          states.push_back(comp->mIntfCurrent);
+          for (auto subComp : comp->subComponents())
+            addStates(subComp);
+        };
+    for (auto comp : mMNAComponents) {
+      if (auto pComp = std::dynamic_pointer_cast<SimPowerComp<VarType>>(comp))
+        addStates(pComp);
+    }
+    for (auto comp : mMNAIntfSwitches) {
+      if (auto pComp = std::dynamic_pointer_cast<SimPowerComp<VarType>>(comp))
+        addStates(pComp);
+    }
+  }
 
   SPDLOG_LOGGER_INFO(mSLog,
                      "Time step is {:f}s for steady-state initialization",
                      initTimeStep);
+  SPDLOG_LOGGER_INFO(mSLog, "Convergence is checked every {:f} steps",
+                     periodSteps);
 
   for (auto comp : mSystem.mComponents) {
     auto powerComp = std::dynamic_pointer_cast<CPS::TopologicalPowerComp>(comp);
@@ -554,30 +800,83 @@ void MnaSolver<VarType>::steadyStateInitialization() {
 
     sched.step(time, timeStepCount);
 
-    if (mDomain == CPS::Domain::EMT) {
-      initLeftVectorLog.logEMTNodeValues(time, leftSideVector());
-      initRightVectorLog.logEMTNodeValues(time, rightSideVector());
-    } else {
-      initLeftVectorLog.logPhasorNodeValues(time, leftSideVector());
-      initRightVectorLog.logPhasorNodeValues(time, rightSideVector());
+    if (mSteadStIniVectorLogging) {
+      if (mDomain == CPS::Domain::EMT) {
+        initLeftVectorLog.logEMTNodeValues(time, leftSideVector());
+        initRightVectorLog.logEMTNodeValues(time, rightSideVector());
+      } else {
+        initLeftVectorLog.logPhasorNodeValues(time, leftSideVector());
+        initRightVectorLog.logPhasorNodeValues(time, rightSideVector());
+      }
+    }
+
+    const Matrix &leftVector = **mLeftSideVector;
+    if (timeStepCount == 0) {
+      refLeftSideVector = leftVector;
+      for (auto state : states)
+        refStates.push_back(**state);
+    } else if (timeStepCount == refStep + periodStepsLow &&
+               periodFraction > 0) {
+      prevLeftSideVector = leftVector;
+    } else if (timeStepCount >= refStep + periodStepsLow) {
+      // Calculate difference
+      if (periodFraction > 0)
+        diff = (1 - periodFraction) * prevLeftSideVector +
+               periodFraction * leftVector - refLeftSideVector;
+      else
+        diff = leftVector - refLeftSideVector;
+      maxDiff = diff.lpNorm<Eigen::Infinity>();
+      max = leftVector.lpNorm<Eigen::Infinity>();
+      // If difference is smaller than some epsilon, stop
+      converged = (maxDiff / max) < mSteadStIniAccLimit;
+
+      if (extrapolate && !converged) {
+        if (prevDiff.size() == 0) {
+          prevDiff = diff;
+        } else {
+          Real rate =
+              diff.cwiseProduct(prevDiff).sum() / prevDiff.squaredNorm();
+          if (rate > 0 && rate < 1) {
+            Real factor = rate / (1 - rate);
+            **mLeftSideVector += factor * diff;
+            for (UInt idx = 0; idx < states.size(); ++idx)
+              **states[idx] += factor * (**states[idx] - refStates[idx]);
+            ++numExtrapolations;
+            // The decay factor is determined anew after the extrapolation
+            prevDiff.resize(0, 0);
+          } else {
+            prevDiff = diff;
+          }
+        }
+        for (UInt idx = 0; idx < states.size(); ++idx)
+          refStates[idx] = **states[idx];
+      }
+
+      refLeftSideVector = leftVector;
+      refStep = timeStepCount;
     }
 
     // Calculate new simulation time
     time = time + initTimeStep;
     ++timeStepCount;
 
-    // Calculate difference
-    diff = prevLeftSideVector - **mLeftSideVector;
-    prevLeftSideVector = **mLeftSideVector;
-    maxDiff = diff.lpNorm<Eigen::Infinity>();
-    max = (**mLeftSideVector).lpNorm<Eigen::Infinity>();
-    // If difference is smaller than some epsilon, break
-    if ((maxDiff / max) < mSteadStIniAccLimit)
+    if (converged)
       break;
   }
 
   SPDLOG_LOGGER_INFO(mSLog, "Max difference: {:f} or {:f}% at time {:f}",
                      maxDiff, maxDiff / max, time);
+  if (extrapolate)
+    SPDLOG_LOGGER_INFO(mSLog, "Extrapolated the solution {} times",
+                       numExtrapolations);
+
+  // Return to the time step of the simulation
+  if (changeTimeStep) {
+    for (auto comp : mVariableTimeStepComps)
+      comp->mnaUpdateTimeStep(mSystem.mSystemOmega, mTimeStep);
+  }
+  if (!mVariableTimeStep)
+    mVariableTimeStepComps.clear();
 
   // Reset system for actual simulation
   mRightSideVector.setZero();
@@ -612,7 +911,25 @@ template <typename VarType> Task::List MnaSolver<VarType>::getTasks() {
     for (UInt i = 0; i < mSystem.mFrequencies.size(); ++i)
       l.push_back(createSolveTaskHarm(i));
   } else if (mSystemMatrixRecomputation) {
+    mGeneratorGroups.clear();
+    if (mGeneratorGrouping) {
+      mGeneratorGroups = CPS::SP::Ph1::SynchronGeneratorVBRGroup::createGroups(
+          mName, mMNAIntfVariableComps, mLeftSideVector);
+      for (auto group : mGeneratorGroups) {
+        SPDLOG_LOGGER_INFO(mSLog, "Stepping {} generators as group",
+                           group->size());
+        for (auto task : group->mnaTasks())
+          l.push_back(task);
+      }
+    }
     for (auto comp : this->mMNAIntfVariableComps) {
+      Bool grouped = std::any_of(
+          mGeneratorGroups.begin(), mGeneratorGroups.end(),
+          [&comp](const CPS::SP::Ph1::SynchronGeneratorVBRGroup::Ptr &group) {
+            return group->contains(comp);
+          });
+      if (grouped)
+        continue;
       for (auto task : comp->mnaTasks())
         l.push_back(task);
     }
@@ -21,9 +21,77 @@ MnaSolverDirect<VarType>::MnaSolverDirect(String name, CPS::Domain domain,
   mImplementationInUse = DirectLinearSolverImpl::KLU;
 }
 
+template <typename VarType> void MnaSolverDirect<VarType>::initialize() {
+  MnaSolver<VarType>::initialize();
+
+  // The companion models of the components change with the time step, so
+  // the prewarmed systems could not be reused
+  if (mLazySwitchedMatrices && mSwitchedMatrixPrewarming &&
+      !mSwitchEvents.empty() && !mVariableTimeStep) {
+    SPDLOG_LOGGER_INFO(mSLog, "Prewarming {} scheduled switch configurations",
+                       mSwitchEvents.size());
+    // Events and simulation tasks modify the components once the simulation
+    // runs, so the matrices are stamped here and only factorized in the
+    // background
+    auto systems = stampScheduledSwitchedSystems(mActiveSwitchStatus);
+    mStopPrewarming = false;
+    mPrewarmThread =
+        std::thread(&MnaSolverDirect<VarType>::prewarmSwitchedSystems, this,
+                    std::move(systems));
+  }
+}
+
+template <typename VarType>
+void MnaSolverDirect<VarType>::changeTimeStep(Real timeStep) {
+  if (!mVariableTimeStep)
+    Solver::changeTimeStep(timeStep);
+  if (timeStep == mTimeStep)
+    return;
+
+  // Keep the systems of the current time step for later reuse
+  auto &previous = mTimeStepSystems[mTimeStep];
+  previous.matrices.swap(mSwitchedMatrices);
+  previous.solvers.swap(mDirectLinearSolvers);
+  previous.usage.swap(mSwitchedMatrixUsage);
+  previous.usagePos.swap(mSwitchedMatrixUsagePos);
+  previous.activeSwitchStatus = mActiveSwitchStatus;
+
+  mTimeStep = timeStep;
+  for (auto comp : mVariableTimeStepComps)
+    comp->mnaUpdateTimeStep(mSystem.mSystemOmega, timeStep);
+
+  auto cached = mTimeStepSystems.find(timeStep);
+  if (cached != mTimeStepSystems.end()) {
+    mSwitchedMatrices.swap(cached->second.matrices);
+    mDirectLinearSolvers.swap(cached->second.solvers);
+    mSwitchedMatrixUsage.swap(cached->second.usage);
+    mSwitchedMatrixUsagePos.swap(cached->second.usagePos);
+    mActiveSwitchStatus = cached->second.activeSwitchStatus;
+    mTimeStepSystems.erase(cached);
+  } else {
+    SPDLOG_LOGGER_DEBUG(mSLog, "Factorizing system matrices for time step {}",
+                        timeStep);
+    createEmptySystemMatrix();
+    this->stampPrecomputedSystemMatrices();
+  }
+}
+
 template <typename VarType>
 void MnaSolverDirect<VarType>::switchedMatrixEmpty(std::size_t index) {
-  mSwitchedMatrices[std::bitset<SWITCH_NUM>(index)][0].setZero();
+  auto bit = std::bitset<SWITCH_NUM>(index);
+  if (mLazySwitchedMatrices) {
+    // The system is (re-)initialized, e.g. after the steady-state
+    // initialization, so all cached matrices might be outdated
+    resetSwitchedSystems();
+    mSwitchedMatrices[bit].push_back(
+        SparseMatrix(mSwitchedMatrixDim, mSwitchedMatrixDim));
+    mDirectLinearSolvers[bit].push_back(
+        createDirectSolverImplementation(mSLog));
+    mSwitchedMatrixUsage.push_front(bit);
+    mSwitchedMatrixUsagePos[bit] = mSwitchedMatrixUsage.begin();
+    mActiveSwitchStatus = bit;
+  }
+  mSwitchedMatrices[bit][0].setZero();
 }
 
 template <typename VarType>
@@ -36,21 +104,162 @@ template <typename VarType>
 void MnaSolverDirect<VarType>::switchedMatrixStamp(
     std::size_t index, std::vector<std::shared_ptr<CPS::MNAInterface>> &comp) {
   auto bit = std::bitset<SWITCH_NUM>(index);
-  auto &sys = mSwitchedMatrices[bit][0];
+  mFactorizeTimes.push_back(stampAndFactorize(
+      bit, comp, mSwitchedMatrices[bit][0], *mDirectLinearSolvers[bit][0]));
+}
+
+template <typename VarType>
+Real MnaSolverDirect<VarType>::stampAndFactorize(
+    const std::bitset<SWITCH_NUM> &bit,
+    std::vector<std::shared_ptr<CPS::MNAInterface>> &comp, SparseMatrix &sys,
+    DirectLinearSolver &solver) {
+  stampSwitchedSystem(bit, comp, sys);
+  return factorizeSwitchedSystem(sys, solver);
+}
+
+template <typename VarType>
+void MnaSolverDirect<VarType>::stampSwitchedSystem(
+    const std::bitset<SWITCH_NUM> &bit,
+    std::vector<std::shared_ptr<CPS::MNAInterface>> &comp, SparseMatrix &sys) {
   for (auto component : comp) {
     component->mnaApplySystemMatrixStamp(sys);
   }
   for (UInt i = 0; i < mSwitches.size(); ++i)
     mSwitches[i]->mnaApplySwitchSystemMatrixStamp(bit[i], sys, 0);
+}
 
+template <typename VarType>
+Real MnaSolverDirect<VarType>::factorizeSwitchedSystem(
+    SparseMatrix &sys, DirectLinearSolver &solver) {
   // Compute LU-factorization for system matrix
-  mDirectLinearSolvers[bit][0]->preprocessing(sys,
-                                              mListVariableSystemMatrixEntries);
+  solver.preprocessing(sys, mListVariableSystemMatrixEntries);
   auto start = std::chrono::steady_clock::now();
-  mDirectLinearSolvers[bit][0]->factorize(sys);
+  solver.factorize(sys);
   auto end = std::chrono::steady_clock::now();
   std::chrono::duration<Real> diff = end - start;
-  mFactorizeTimes.push_back(diff.count());
+  return diff.count();
+}
+
+template <typename VarType>
+void MnaSolverDirect<VarType>::updateSwitchedSystem() {
+  MnaSolver<VarType>::updateSwitchStatus();
+
+  if (mLazySwitchedMatrices && mCurrentSwitchStatus != mActiveSwitchStatus) {
+    fetchSwitchedSystem(mCurrentSwitchStatus);
+    mActiveSwitchStatus = mCurrentSwitchStatus;
+  }
+}
+
+template <typename VarType>
+void MnaSolverDirect<VarType>::fetchSwitchedSystem(
+    const std::bitset<SWITCH_NUM> &bit) {
+  auto usage = mSwitchedMatrixUsagePos.find(bit);
+  if (usage != mSwitchedMatrixUsagePos.end()) {
+    // Cache hit, only mark as most recently used
+    mSwitchedMatrixUsage.splice(mSwitchedMatrixUsage.begin(),
+                                mSwitchedMatrixUsage, usage->second);
+    return;
+  }
+
+  Bool prewarmed = false;
+  {
+    std::lock_guard<std::mutex> lock(mPrewarmMutex);
+    auto system = mPrewarmedSystems.find(bit);
+    if (system != mPrewarmedSystems.end()) {
+      mSwitchedMatrices[bit].push_back(std::move(system->second.first));
+      mDirectLinearSolvers[bit].push_back(system->second.second);
+      mPrewarmedSystems.erase(system);
+      prewarmed = true;
+    }
+  }
+
+  if (!prewarmed) {
+    mSwitchedMatrices[bit].push_back(
+        SparseMatrix(mSwitchedMatrixDim, mSwitchedMatrixDim));
+    mDirectLinearSolvers[bit].push_back(
+        createDirectSolverImplementation(mSLog));
+    switchedMatrixStamp(bit.to_ullong(), mMNAComponents);
+  }
+  SPDLOG_LOGGER_DEBUG(mSLog, "Added {} system matrix for switch status {:s}",
+                      prewarmed ? "prewarmed" : "new", bit.to_string());
+
+  mSwitchedMatrixUsage.push_front(bit);
+  mSwitchedMatrixUsagePos[bit] = mSwitchedMatrixUsage.begin();
+
+  // Evict least recently used systems, the current one is at the front
+  while (mSwitchedMatrixUsage.size() >
+         std::max<UInt>(mSwitchedMatrixCacheSize, 1)) {
+    auto evicted = mSwitchedMatrixUsage.back();
+    mSwitchedMatrixUsage.pop_back();
+    mSwitchedMatrixUsagePos.erase(evicted);
+    mSwitchedMatrices.erase(evicted);
+    mDirectLinearSolvers.erase(evicted);
+  }
+}
+
+template <typename VarType>
+void MnaSolverDirect<VarType>::resetSwitchedSystems() {
+  mSwitchedMatrices.clear();
+  mDirectLinearSolvers.clear();
+  mSwitchedMatrixUsage.clear();
+  mSwitchedMatrixUsagePos.clear();
+
+  std::lock_guard<std::mutex> lock(mPrewarmMutex);
+  mPrewarmedSystems.clear();
+}
+
+template <typename VarType>
+std::vector<std::pair<std::bitset<SWITCH_NUM>, SparseMatrix>>
+MnaSolverDirect<VarType>::stampScheduledSwitchedSystems(
+    const std::bitset<SWITCH_NUM> &initialStatus) {
+  auto switchEvents = mSwitchEvents;
+  std::stable_sort(
+      switchEvents.begin(), switchEvents.end(),
+      [](const SwitchConfiguration &a, const SwitchConfiguration &b) {
+        return a.switchTime < b.switchTime;
+      });
+
+  std::vector<std::pair<std::bitset<SWITCH_NUM>, SparseMatrix>> systems;
+  for (auto &event : switchEvents) {
+    // Prewarmed systems should not displace the active one from the cache
+    if (systems.size() + 1 >= mSwitchedMatrixCacheSize)
+      break;
+    auto bit = std::bitset<SWITCH_NUM>(event.systemIndex);
+    if (bit == initialStatus ||
+        std::any_of(systems.begin(), systems.end(),
+                    [&bit](const auto &system) { return system.first == bit; }))
+      continue;
+
+    SparseMatrix sys(mSwitchedMatrixDim, mSwitchedMatrixDim);
+    stampSwitchedSystem(bit, mMNAComponents, sys);
+    systems.emplace_back(bit, std::move(sys));
+  }
+  return systems;
+}
+
+template <typename VarType>
+void MnaSolverDirect<VarType>::prewarmSwitchedSystems(
+    std::vector<std::pair<std::bitset<SWITCH_NUM>, SparseMatrix>> systems) {
+  for (auto &system : systems) {
+    if (mStopPrewarming)
+      return;
+
+    auto solver = createDirectSolverImplementation(mSLog);
+    factorizeSwitchedSystem(system.second, *solver);
+
+    std::lock_guard<std::mutex> lock(mPrewarmMutex);
+    // Prewarmed systems should not displace the active one from the cache
+    if (mPrewarmedSystems.size() + 1 >= mSwitchedMatrixCacheSize)
+      return;
+    mPrewarmedSystems.emplace(system.first,
+                              std::make_pair(std::move(system.second), solver));
+  }
+}
+
+template <typename VarType> void MnaSolverDirect<VarType>::stopPrewarming() {
+  mStopPrewarming = true;
+  if (mPrewarmThread.joinable())
+    mPrewarmThread.join();
 }
 
 template <typename VarType>
@@ -107,13 +316,9 @@ void MnaSolverDirect<VarType>::stampVariableSystemMatrix() {
 template <typename VarType>
 void MnaSolverDirect<VarType>::solveWithSystemMatrixRecomputation(
     Real time, Int timeStepCount) {
-  // Reset source vector
-  mRightSideVector.setZero();
-
   // Add together the right side vector (computed by the components'
   // pre-step tasks)
-  for (auto stamp : mRightVectorStamps)
-    mRightSideVector += *stamp;
+  this->assembleRightSideVector();
 
   // Get switch and variable comp status and update system matrix and lu factorization accordingly
   if (hasVariableComponentChanged())
@@ -121,8 +326,8 @@ void MnaSolverDirect<VarType>::solveWithSystemMatrixRecomputation(
 
   // Calculate new solution vector
   auto start = std::chrono::steady_clock::now();
-  **mLeftSideVector =
-      mDirectLinearSolverVariableSystemMatrix->solve(mRightSideVector);
+  mDirectLinearSolverVariableSystemMatrix->solve(mRightSideVector,
+                                                 **mLeftSideVector);
   auto end = std::chrono::steady_clock::now();
   std::chrono::duration<Real> diff = end - start;
   mSolveTimes.push_back(diff.count());
@@ -167,6 +372,9 @@ template <> void MnaSolverDirect<Real>::createEmptySystemMatrix() {
         SparseMatrix(mNumMatrixNodeIndices, mNumMatrixNodeIndices);
     mVariableSystemMatrix =
         SparseMatrix(mNumMatrixNodeIndices, mNumMatrixNodeIndices);
+  } else if (mLazySwitchedMatrices) {
+    // matrices are created on demand
+    mSwitchedMatrixDim = mNumMatrixNodeIndices;
   } else {
     for (std::size_t i = 0; i < (1ULL << mSwitches.size()); i++) {
       auto bit = std::bitset<SWITCH_NUM>(i);
@@ -197,6 +405,9 @@ template <> void MnaSolverDirect<Complex>::createEmptySystemMatrix() {
         SparseMatrix(2 * (mNumMatrixNodeIndices), 2 * (mNumMatrixNodeIndices));
     mVariableSystemMatrix =
         SparseMatrix(2 * (mNumMatrixNodeIndices), 2 * (mNumMatrixNodeIndices));
+  } else if (mLazySwitchedMatrices) {
+    // matrices are created on demand
+    mSwitchedMatrixDim = 2 * (mNumTotalMatrixNodeIndices);
   } else {
     for (std::size_t i = 0; i < (1ULL << mSwitches.size()); i++) {
       auto bit = std::bitset<SWITCH_NUM>(i);
@@ -232,23 +443,19 @@ std::shared_ptr<CPS::Task> MnaSolverDirect<VarType>::createLogTask() {
 
 template <typename VarType>
 void MnaSolverDirect<VarType>::solve(Real time, Int timeStepCount) {
-  // Reset source vector
-  mRightSideVector.setZero();
-
   // Add together the right side vector (computed by the components' pre-step tasks)
-  for (auto stamp : mRightVectorStamps)
-    mRightSideVector += *stamp;
+  this->assembleRightSideVector();
 
   if (!mIsInInitialization)
-    MnaSolver<VarType>::updateSwitchStatus();
+    updateSwitchedSystem();
 
   if (mSwitchedMatrices.size() > 0) {
     std::chrono::steady_clock::time_point start;
     if (Solver::mLogSolveTimes)
       start = std::chrono::steady_clock::now();
 
-    **mLeftSideVector =
-        mDirectLinearSolvers[mCurrentSwitchStatus][0]->solve(mRightSideVector);
+    mDirectLinearSolvers[mCurrentSwitchStatus][0]->solve(mRightSideVector,
+                                                         **mLeftSideVector);
 
     if (Solver::mLogSolveTimes) {
       auto end = std::chrono::steady_clock::now();
@@ -279,24 +486,19 @@ void MnaSolverDirect<VarType>::solve(Real time, Int timeStepCount) {
       if (numCompsRequireIter > 0) {
         mIter++;
 
-        // Reset source vector
-        mRightSideVector.setZero();
-
         if (!mIsInInitialization)
-          MnaSolver<VarType>::updateSwitchStatus();
+          updateSwitchedSystem();
 
         for (auto syncGen : mSyncGen)
           syncGen->correctorStep();
 
         // Add together the right side vector (computed by the components' pre-step tasks)
-        for (auto stamp : mRightVectorStamps)
-          mRightSideVector += *stamp;
+        this->assembleRightSideVector();
 
         if (mSwitchedMatrices.size() > 0) {
           auto start = std::chrono::steady_clock::now();
-          **mLeftSideVector =
-              mDirectLinearSolvers[mCurrentSwitchStatus][0]->solve(
-                  mRightSideVector);
+          mDirectLinearSolvers[mCurrentSwitchStatus][0]->solve(
+              mRightSideVector, **mLeftSideVector);
           auto end = std::chrono::steady_clock::now();
           std::chrono::duration<Real> diff = end - start;
           mSolveTimes.push_back(diff.count());
@@ -326,9 +528,8 @@ void MnaSolverDirect<VarType>::solveWithHarmonics(Real time, Int timeStepCount,
   for (auto stamp : mRightVectorStamps)
     mRightSideVectorHarm[freqIdx] += stamp->col(freqIdx);
 
-  **mLeftSideVectorHarm[freqIdx] =
-      mDirectLinearSolvers[mCurrentSwitchStatus][freqIdx]->solve(
-          mRightSideVectorHarm[freqIdx]);
+  mDirectLinearSolvers[mCurrentSwitchStatus][freqIdx]->solve(
+      mRightSideVectorHarm[freqIdx], **mLeftSideVectorHarm[freqIdx]);
 }
 
 template <typename VarType> void MnaSolverDirect<VarType>::logSystemMatrices() {
@@ -425,30 +626,39 @@ template <typename VarType>
 std::shared_ptr<DirectLinearSolver>
 MnaSolverDirect<VarType>::createDirectSolverImplementation(
     CPS::Logger::Log mSLog) {
+  std::shared_ptr<DirectLinearSolver> solver;
   switch (this->mImplementationInUse) {
   case DirectLinearSolverImpl::DenseLU:
-    return std::make_shared<DenseLUAdapter>(mSLog);
+    solver = std::make_shared<DenseLUAdapter>(mSLog);
+    break;
   case DirectLinearSolverImpl::SparseLU:
-    return std::make_shared<SparseLUAdapter>(mSLog);
+    solver = std::make_shared<SparseLUAdapter>(mSLog);
+    break;
 #ifdef WITH_KLU
   case DirectLinearSolverImpl::KLU:
-    return std::make_shared<KLUAdapter>(mSLog);
+    solver = std::make_shared<KLUAdapter>(mSLog);
+    break;
 #endif
 #ifdef WITH_CUDA
   case DirectLinearSolverImpl::CUDADense:
-    return std::make_shared<GpuDenseAdapter>(mSLog);
+    solver = std::make_shared<GpuDenseAdapter>(mSLog);
+    break;
 #ifdef WITH_CUDA_SPARSE
   case DirectLinearSolverImpl::CUDASparse:
-    return std::make_shared<GpuSparseAdapter>(mSLog);
+    solver = std::make_shared<GpuSparseAdapter>(mSLog);
+    break;
 #endif
 #ifdef WITH_MAGMA
   case DirectLinearSolverImpl::CUDAMagma:
-    return std::make_shared<GpuMagmaAdapter>(mSLog);
+    solver = std::make_shared<GpuMagmaAdapter>(mSLog);
+    break;
 #endif
 #endif
   default:
     throw CPS::SystemError("unsupported linear solver implementation.");
   }
+  solver->setSymbolicAnalysisCache(this->mSymbolicAnalysisCache);
+  return solver;
 }
 
 template <typename VarType>
@@ -146,13 +146,9 @@ template <typename VarType> Task::List MnaSolverPlugin<VarType>::getTasks() {
 
 template <typename VarType>
 void MnaSolverPlugin<VarType>::solve(Real time, Int timeStepCount) {
-  // Reset source vector
-  this->mRightSideVector.setZero();
-
   // Add together the right side vector (computed by the components'
   // pre-step tasks)
-  for (const auto &stamp : this->mRightVectorStamps)
-    this->mRightSideVector += *stamp;
+  this->assembleRightSideVector();
 
   if (!this->mIsInInitialization)
     this->updateSwitchStatus();
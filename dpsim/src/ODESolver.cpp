@@ -12,9 +12,20 @@
 using namespace DPsim;
 
 ODESolver::ODESolver(String name, const CPS::ODEInterface::Ptr &comp,
-                     bool implicit_integration, Real timestep)
+                     bool implicit_integration, Real timestep,
+                     Bool sparseJacobian)
     : Solver(name, CPS::Logger::Level::info), mComponent(comp),
-      mImplicitIntegration(implicit_integration), mTimestep(timestep) {
+      mImplicitIntegration(implicit_integration),
+      mSparseJacobian(sparseJacobian && implicit_integration &&
+                      comp->odeHasSparseJacobian()),
+      mTimestep(timestep) {
+#ifndef WITH_SUNDIALS_KLU
+  if (mSparseJacobian) {
+    SPDLOG_LOGGER_WARN(mSLog, "Sundials has been built without KLU, falling "
+                              "back to dense Jacobians");
+    mSparseJacobian = false;
+  }
+#endif
   mProbDim = mComponent->mOdePreState->get().rows();
   initialize();
 }
@@ -37,6 +48,13 @@ void ODESolver::initialize() {
                          double tmp1[], double tmp2[], double tmp3[]) {
     dummy->odeJacobian(t, y, fy, J, tmp1, tmp2, tmp3);
   };
+  mSparseJacFunction = [dummy](double t, const double y[], const double fy[],
+                               CPS::SparseMatrix &J) {
+    dummy->odeSparseJacobian(t, y, fy, J);
+  };
+
+  if (mSparseJacobian)
+    initializeSparseJacobian();
 
   // Causes numerical issues, better allocate in every step-> see step
   /*mArkode_mem= ARKodeCreate();
@@ -112,6 +130,55 @@ int ODESolver::Jacobian(realtype t, N_Vector y, N_Vector fy, SUNMatrix J,
   return 0;
 }
 
+void ODESolver::initializeSparseJacobian() {
+  std::vector<Real> fy(mProbDim);
+  mStSpFunction(0, NV_DATA_S(mStates), fy.data());
+
+  // The entries set by the component define the pattern. The diagonal is
+  // always included, as ARKode adds the identity to the matrix.
+  mJacobian.resize(mProbDim, mProbDim);
+  mSparseJacFunction(0, NV_DATA_S(mStates), fy.data(), mJacobian);
+  for (Int idx = 0; idx < mProbDim; ++idx)
+    mJacobian.coeffRef(idx, idx) += 0.;
+  mJacobian.makeCompressed();
+
+  SPDLOG_LOGGER_INFO(mSLog, "Sparse Jacobian with {} nonzeros for {} states",
+                     mJacobian.nonZeros(), mProbDim);
+}
+
+#ifdef WITH_SUNDIALS_KLU
+int ODESolver::SparseJacobianWrapper(realtype t, N_Vector y, N_Vector fy,
+                                     SUNMatrix J, void *user_data,
+                                     N_Vector tmp1, N_Vector tmp2,
+                                     N_Vector tmp3) {
+  ODESolver *self = reinterpret_cast<ODESolver *>(user_data);
+  return self->SparseJacobian(t, y, fy, J);
+}
+
+int ODESolver::SparseJacobian(realtype t, N_Vector y, N_Vector fy,
+                              SUNMatrix J) {
+  auto nonZeros = mJacobian.nonZeros();
+  mJacobian.coeffs().setZero();
+  mSparseJacFunction(t, NV_DATA_S(y), NV_DATA_S(fy), mJacobian);
+  if (mJacobian.nonZeros() != nonZeros) {
+    SPDLOG_LOGGER_ERROR(mSLog, "Sparsity pattern of the Jacobian changed");
+    return -1;
+  }
+
+  // Both matrices are stored as compressed sparse columns
+  sunindextype *colPtrs = SM_INDEXPTRS_S(J);
+  sunindextype *rowIndices = SM_INDEXVALS_S(J);
+  realtype *values = SM_DATA_S(J);
+  for (Int col = 0; col <= mProbDim; ++col)
+    colPtrs[col] = mJacobian.outerIndexPtr()[col];
+  for (Int idx = 0; idx < mJacobian.nonZeros(); ++idx) {
+    rowIndices[idx] = mJacobian.innerIndexPtr()[idx];
+    values[idx] = mJacobian.valuePtr()[idx];
+  }
+  return 0;
+}
+#endif
+
 Real ODESolver::step(Real initial_time) {
   // Not absolutely necessary; realtype by default double (same as Real)
   realtype T0 = (realtype)initial_time;
@@ -142,15 +209,29 @@ Real ODESolver::step(Real initial_time) {
     if (check_flag(&mFlag, "ARKodeInit", 1))
       throw CPS::Exception();
 
-    // Initialize dense matrix data structure
-    A = SUNDenseMatrix(mProbDim, mProbDim);
-    if (check_flag((void *)A, "SUNDenseMatrix", 0))
-      throw CPS::Exception();
+#ifdef WITH_SUNDIALS_KLU
+    if (mSparseJacobian) {
+      // Initialize sparse matrix data structure with the fixed pattern
+      A = SUNSparseMatrix(mProbDim, mProbDim, mJacobian.nonZeros(), CSC_MAT);
+      if (check_flag((void *)A, "SUNSparseMatrix", 0))
+        throw CPS::Exception();
 
-    // Initialize linear solver
-    LS = SUNDenseLinearSolver(mStates, A);
-    if (check_flag((void *)LS, "SUNDenseLinearSolver", 0))
-      throw CPS::Exception();
+      LS = SUNKLU(mStates, A);
+      if (check_flag((void *)LS, "SUNKLU", 0))
+        throw CPS::Exception();
+    }
+#endif
+    if (!mSparseJacobian) {
+      // Initialize dense matrix data structure
+      A = SUNDenseMatrix(mProbDim, mProbDim);
+      if (check_flag((void *)A, "SUNDenseMatrix", 0))
+        throw CPS::Exception();
+
+      // Initialize linear solver
+      LS = SUNDenseLinearSolver(mStates, A);
+      if (check_flag((void *)LS, "SUNDenseLinearSolver", 0))
+        throw CPS::Exception();
+    }
 
     // Attach matrix and linear solver
     mFlag = ARKDlsSetLinearSolver(mArkode_mem, LS, A);
@@ -158,7 +239,12 @@ Real ODESolver::step(Real initial_time) {
       throw CPS::Exception();
 
     // Set Jacobian routine
-    mFlag = ARKDlsSetJacFn(mArkode_mem, &ODESolver::JacobianWrapper);
+#ifdef WITH_SUNDIALS_KLU
+    if (mSparseJacobian)
+      mFlag = ARKDlsSetJacFn(mArkode_mem, &ODESolver::SparseJacobianWrapper);
+    else
+#endif
+      mFlag = ARKDlsSetJacFn(mArkode_mem, &ODESolver::JacobianWrapper);
     if (check_flag(&mFlag, "ARKDlsSetJacFn", 1))
       throw CPS::Exception();
   } else {
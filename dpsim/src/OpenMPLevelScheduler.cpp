@@ -21,6 +21,7 @@ OpenMPLevelScheduler::OpenMPLevelScheduler(Int threads,
     mNumThreads = threads;
   else
     mNumThreads = omp_get_num_threads();
+  mMeasurementsEnabled = !outMeasurementFile.empty();
 }
 
 void OpenMPLevelScheduler::createSchedule(const Task::List &tasks,
@@ -31,7 +32,7 @@ void OpenMPLevelScheduler::createSchedule(const Task::List &tasks,
   Scheduler::topologicalSort(tasks, inEdges, outEdges, ordered);
   Scheduler::levelSchedule(ordered, inEdges, outEdges, mLevels);
 
-  if (!mOutMeasurementFile.empty())
+  if (mMeasurementsEnabled)
     Scheduler::initMeasurements(tasks);
 }
 
@@ -39,7 +40,7 @@ void OpenMPLevelScheduler::step(Real time, Int timeStepCount) {
   long i, level = 0;
   std::chrono::steady_clock::time_point start, end;
 
-  if (!mOutMeasurementFile.empty()) {
+  if (mMeasurementsEnabled) {
 #pragma omp parallel shared(time, timeStepCount) private(level, i, start, end) \
     num_threads(mNumThreads)
     for (level = 0; level < static_cast<long>(mLevels.size()); level++) {
@@ -60,7 +60,8 @@ void PFSolver::initialize() {
   determineNodeBaseVoltages();
   composeAdmittanceMatrix();
 
-  mJ.setZero(mNumUnknowns, mNumUnknowns);
+  createJacobianPattern();
+  mJacobianAnalyzed = false;
   mX.setZero(mNumUnknowns);
   mF.setZero(mNumUnknowns);
 }
@@ -439,12 +440,17 @@ Bool PFSolver::solvePowerflow() {
   for (unsigned i = 1; i < mMaxIterations && !isConverged; ++i) {
 
     calculateJacobian();
-    auto sparseJ = mJ.sparseView();
 
-    // Solve system mJ*mX = mF
-    Eigen::SparseLU<SparseMatrix> lu(sparseJ);
+    // The sparsity pattern of the Jacobian is fixed,
+    // so only the numerical factorization is repeated
+    if (!mJacobianAnalyzed) {
+      mJacobianLU.analyzePattern(mJ);
+      mJacobianAnalyzed = true;
+    }
+    mJacobianLU.factorize(mJ);
 
-    mX = lu.solve(mF); /* code */
+    // Solve system mJ*mX = mF
+    mX = mJacobianLU.solve(mF);
 
     // Calculate new solution based on mX increments obtained from equation system
     updateSolution();
@@ -462,10 +468,41 @@ Bool PFSolver::solvePowerflow() {
   return isConverged;
 }
 
+PFSolver::~PFSolver() {
+  if (mIterationsPerStep.empty())
+    return;
+  UInt totalIterations = 0;
+  for (auto iterations : mIterationsPerStep)
+    totalIterations += iterations;
+  SPDLOG_LOGGER_INFO(
+      mSLog, "Newton iterations: {} in {} time steps ({:.2f} per step), {} "
+             "time steps kept the last solution",
+      totalIterations, mIterationsPerStep.size(),
+      static_cast<Real>(totalIterations) / mIterationsPerStep.size(),
+      mNumSkippedSolves);
+}
+
 void PFSolver::SolveTask::execute(Real time, Int timeStepCount) {
-  // apply keepLastSolution to save computation time
-  mSolver.generateInitialSolution(time);
+  // Seed the Newton iterations with the last converged solution
+  Bool warmStart = mSolver.mPowerflowWarmStart && mSolver.isConverged;
+  mSolver.generateInitialSolution(time, warmStart);
+
+  if (warmStart && mSolver.mPowerflowSkipTolerance >= 0 &&
+      !mSolver.hasSpecifiedValuesChanged(mSolver.mPowerflowSkipTolerance)) {
+    // The last solution, which is still set at the nodes, remains valid
+    SPDLOG_LOGGER_INFO(mSolver.mSLog,
+                       "Time {}: specified values unchanged, keeping the "
+                       "last solution",
+                       time);
+    mSolver.mNumSkippedSolves++;
+    mSolver.mIterationsPerStep.push_back(0);
+    return;
+  }
+
   mSolver.solvePowerflow();
+  mSolver.mIterationsPerStep.push_back(mSolver.mIterations);
+  SPDLOG_LOGGER_INFO(mSolver.mSLog, "Time {}: {} Newton iterations", time,
+                     mSolver.mIterations);
   mSolver.setSolution();
 }
 
@@ -19,8 +19,14 @@ PFSolverPowerPolar::PFSolverPowerPolar(CPS::String name,
 
 void PFSolverPowerPolar::generateInitialSolution(Real time,
                                                  bool keep_last_solution) {
-  resize_sol(mSystem.mNodes.size());
-  resize_complex_sol(mSystem.mNodes.size());
+  if (keep_last_solution && solutionInitialized) {
+    // Keep voltages and angles, the powers are accumulated from the components
+    sol_P.setZero();
+    sol_Q.setZero();
+  } else {
+    resize_sol(mSystem.mNodes.size());
+    resize_complex_sol(mSystem.mNodes.size());
+  }
 
   // update all components for the new time
   for (auto comp : mSystem.mComponents) {
@@ -166,6 +172,7 @@ void PFSolverPowerPolar::generateInitialSolution(Real time,
 
   Pesp = sol_P;
   Qesp = sol_Q;
+  Vesp = sol_V;
 
   SPDLOG_LOGGER_INFO(mSLog, "#### Initial solution: ");
   SPDLOG_LOGGER_INFO(mSLog, "P\t\tQ\t\tV\t\tD");
@@ -192,103 +199,116 @@ void PFSolverPowerPolar::calculateMismatch() {
   }
 }
 
-void PFSolverPowerPolar::calculateJacobian() {
+void PFSolverPowerPolar::createJacobianPattern() {
   UInt npqpv = mNumPQBuses + mNumPVBuses;
-  double val;
-  UInt k, j;
-  UInt da, db;
 
-  mJ.setZero();
+  mJacobianAngleIndex.assign(mSystem.mNodes.size(), -1);
+  mJacobianVoltageIndex.assign(mSystem.mNodes.size(), -1);
+  for (UInt a = 0; a < npqpv; ++a) {
+    mJacobianAngleIndex[mPQPVBusIndices[a]] = a;
+    if (a < mNumPQBuses)
+      mJacobianVoltageIndex[mPQPVBusIndices[a]] = a + npqpv;
+  }
 
-  //J1
-  for (UInt a = 0; a < npqpv; ++a) { //rows
-    k = mPQPVBusIndices[a];
-    //diagonal
-    mJ.coeffRef(a, a) = -Q(k) - B(k, k) * sol_V.coeff(k) * sol_V.coeff(k);
-
-    //non diagonal elements
-    for (UInt b = 0; b < npqpv; ++b) {
-      if (b != a) {
-        j = mPQPVBusIndices[b];
-        val = sol_V.coeff(k) * sol_V.coeff(j) *
-              (G(k, j) * sin(sol_D.coeff(k) - sol_D.coeff(j)) -
-               B(k, j) * cos(sol_D.coeff(k) - sol_D.coeff(j)));
-        //if (val != 0.0)
-        mJ.coeffRef(a, b) = val;
-      }
+  // Entries are nonzero for the diagonal blocks and for buses
+  // connected by a nonzero admittance
+  std::vector<Eigen::Triplet<Real>> entries;
+  for (UInt a = 0; a < npqpv; ++a) {
+    UInt k = mPQPVBusIndices[a];
+    Int qa = mJacobianVoltageIndex[k];
+
+    entries.emplace_back(a, a, 0.);
+    if (qa >= 0) {
+      entries.emplace_back(a, qa, 0.);
+      entries.emplace_back(qa, a, 0.);
+      entries.emplace_back(qa, qa, 0.);
     }
-  }
 
-  //J2
-  da = 0;
-  db = npqpv;
-  for (UInt a = 0; a < npqpv; ++a) { //rows
-    k = mPQPVBusIndices[a];
-    //diagonal
-    //std::cout << "J2D:" << (a + da) << "," << (a + db) << std::endl;
-    if (a < mNumPQBuses)
-      mJ.coeffRef(a + da, a + db) =
-          P(k) + G(k, k) * sol_V.coeff(k) * sol_V.coeff(k);
-
-    //non diagonal elements
-    for (UInt b = 0; b < mNumPQBuses; ++b) {
-      if (b != a) {
-        j = mPQPVBusIndices[b];
-        val = sol_V.coeff(k) * sol_V.coeff(j) *
-              (G(k, j) * cos(sol_D.coeff(k) - sol_D.coeff(j)) +
-               B(k, j) * sin(sol_D.coeff(k) - sol_D.coeff(j)));
-        //if (val != 0.0)
-        //std::cout << "J2ij:" << (a + da) << "," << (b + db) << std::endl;
-        mJ.coeffRef(a + da, b + db) = val;
+    for (SparseMatrixCompRow::InnerIterator it(mY, k); it; ++it) {
+      UInt j = static_cast<UInt>(it.col());
+      Int b = mJacobianAngleIndex[j];
+      if (j == k || b < 0)
+        continue;
+      Int qb = mJacobianVoltageIndex[j];
+
+      entries.emplace_back(a, b, 0.);
+      if (qb >= 0)
+        entries.emplace_back(a, qb, 0.);
+      if (qa >= 0) {
+        entries.emplace_back(qa, b, 0.);
+        if (qb >= 0)
+          entries.emplace_back(qa, qb, 0.);
       }
     }
   }
 
-  //J3
-  da = npqpv;
-  db = 0;
-  for (UInt a = 0; a < mNumPQBuses; ++a) { //rows
-    k = mPQPVBusIndices[a];
-    //diagonal
-    //std::cout << "J3:" << (a + da) << "," << (a + db) << std::endl;
-    mJ.coeffRef(a + da, a + db) =
-        P(k) - G(k, k) * sol_V.coeff(k) * sol_V.coeff(k);
-
-    //non diagonal elements
-    for (UInt b = 0; b < npqpv; ++b) {
-      if (b != a) {
-        j = mPQPVBusIndices[b];
-        val = sol_V.coeff(k) * sol_V.coeff(j) *
-              (G(k, j) * cos(sol_D.coeff(k) - sol_D.coeff(j)) +
-               B(k, j) * sin(sol_D.coeff(k) - sol_D.coeff(j)));
-        //if (val != 0.0)
-        //std::cout << "J3:" << (a + da) << "," << (b + db) << std::endl;
-        mJ.coeffRef(a + da, b + db) = -val;
-      }
-    }
+  mJ = SparseMatrix(mNumUnknowns, mNumUnknowns);
+  mJ.setFromTriplets(entries.begin(), entries.end());
+  mJ.makeCompressed();
+  SPDLOG_LOGGER_INFO(mSLog, "Jacobian with {} nonzero entries", mJ.nonZeros());
+}
+
+Bool PFSolverPowerPolar::hasSpecifiedValuesChanged(Real tolerance) {
+  if (mLastPesp.size() != Pesp.size() || mLastVesp.size() != Vesp.size())
+    return true;
+  if ((Pesp - mLastPesp).lpNorm<Eigen::Infinity>() > tolerance ||
+      (Qesp - mLastQesp).lpNorm<Eigen::Infinity>() > tolerance)
+    return true;
+  // Voltages at PQ buses are results of the previous solution
+  for (auto idx : mPVBusIndices) {
+    if (std::abs(Vesp.coeff(idx) - mLastVesp.coeff(idx)) > tolerance)
+      return true;
   }
+  for (auto idx : mVDBusIndices) {
+    if (std::abs(Vesp.coeff(idx) - mLastVesp.coeff(idx)) > tolerance)
+      return true;
+  }
+  return false;
+}
 
-  //J4
-  da = npqpv;
-  db = npqpv;
-  for (UInt a = 0; a < mNumPQBuses; ++a) { //rows
-    k = mPQPVBusIndices[a];
-    //diagonal
-    //std::cout << "J4:" << (a + da) << "," << (a + db) << std::endl;
-    mJ.coeffRef(a + da, a + db) =
-        Q(k) - B(k, k) * sol_V.coeff(k) * sol_V.coeff(k);
-
-    //non diagonal elements
-    for (UInt b = 0; b < mNumPQBuses; ++b) {
-      if (b != a) {
-        j = mPQPVBusIndices[b];
-        val = sol_V.coeff(k) * sol_V.coeff(j) *
-              (G(k, j) * sin(sol_D.coeff(k) - sol_D.coeff(j)) -
-               B(k, j) * cos(sol_D.coeff(k) - sol_D.coeff(j)));
-        if (val != 0.0) {
-          //std::cout << "J4:" << (a + da) << "," << (b + db) << std::endl;
-          mJ.coeffRef(a + da, b + db) = val;
-        }
+void PFSolverPowerPolar::calculateJacobian() {
+  UInt npqpv = mNumPQBuses + mNumPVBuses;
+
+  // Only the values are updated, the pattern stays the same
+  mJ.coeffs().setZero();
+
+  for (UInt a = 0; a < npqpv; ++a) {
+    UInt k = mPQPVBusIndices[a];
+    Int qa = mJacobianVoltageIndex[k];
+    Real Vk = sol_V.coeff(k);
+    Real Pk = P(k);
+    Real Qk = Q(k);
+
+    // Diagonal elements of J1 to J4
+    mJ.coeffRef(a, a) = -Qk - B(k, k) * Vk * Vk;
+    if (qa >= 0) {
+      mJ.coeffRef(a, qa) = Pk + G(k, k) * Vk * Vk;
+      mJ.coeffRef(qa, a) = Pk - G(k, k) * Vk * Vk;
+      mJ.coeffRef(qa, qa) = Qk - B(k, k) * Vk * Vk;
+    }
+
+    // Non diagonal elements, only nonzero for connected buses
+    for (SparseMatrixCompRow::InnerIterator it(mY, k); it; ++it) {
+      UInt j = static_cast<UInt>(it.col());
+      Int b = mJacobianAngleIndex[j];
+      if (j == k || b < 0)
+        continue;
+      Int qb = mJacobianVoltageIndex[j];
+
+      Real Gkj = it.value().real();
+      Real Bkj = it.value().imag();
+      Real angle = sol_D.coeff(k) - sol_D.coeff(j);
+      Real VkVj = Vk * sol_V.coeff(j);
+      Real valSin = VkVj * (Gkj * sin(angle) - Bkj * cos(angle));
+      Real valCos = VkVj * (Gkj * cos(angle) + Bkj * sin(angle));
+
+      mJ.coeffRef(a, b) = valSin;
+      if (qb >= 0)
+        mJ.coeffRef(a, qb) = valCos;
+      if (qa >= 0) {
+        mJ.coeffRef(qa, b) = -valCos;
+        if (qb >= 0)
+          mJ.coeffRef(qa, qb) = valSin;
       }
     }
   }
@@ -317,6 +337,11 @@ void PFSolverPowerPolar::updateSolution() {
 }
 
 void PFSolverPowerPolar::setSolution() {
+  // Remember the specified values this solution belongs to
+  mLastPesp = Pesp;
+  mLastQesp = Qesp;
+  mLastVesp = Vesp;
+
   if (!isConverged) {
     SPDLOG_LOGGER_INFO(mSLog, "Not converged within {} iterations",
                        mIterations);
@@ -398,18 +423,23 @@ void PFSolverPowerPolar::calculateNodalInjection() {
 
 Real PFSolverPowerPolar::P(UInt k) {
   Real val = 0.0;
-  for (UInt j = 0; j < mSystem.mNodes.size(); ++j) {
-    val += sol_V.coeff(j) * (G(k, j) * cos(sol_D.coeff(k) - sol_D.coeff(j)) +
-                             B(k, j) * sin(sol_D.coeff(k) - sol_D.coeff(j)));
+  // Only buses with a nonzero admittance contribute
+  for (SparseMatrixCompRow::InnerIterator it(mY, k); it; ++it) {
+    UInt j = static_cast<UInt>(it.col());
+    val += sol_V.coeff(j) *
+           (it.value().real() * cos(sol_D.coeff(k) - sol_D.coeff(j)) +
+            it.value().imag() * sin(sol_D.coeff(k) - sol_D.coeff(j)));
   }
   return sol_V.coeff(k) * val;
 }
 
 Real PFSolverPowerPolar::Q(UInt k) {
   Real val = 0.0;
-  for (UInt j = 0; j < mSystem.mNodes.size(); ++j) {
-    val += sol_V.coeff(j) * (G(k, j) * sin(sol_D.coeff(k) - sol_D.coeff(j)) -
-                             B(k, j) * cos(sol_D.coeff(k) - sol_D.coeff(j)));
+  for (SparseMatrixCompRow::InnerIterator it(mY, k); it; ++it) {
+    UInt j = static_cast<UInt>(it.col());
+    val += sol_V.coeff(j) *
+           (it.value().real() * sin(sol_D.coeff(k) - sol_D.coeff(j)) -
+            it.value().imag() * cos(sol_D.coeff(k) - sol_D.coeff(j)));
   }
   return sol_V.coeff(k) * val;
 }
@@ -5,8 +5,17 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 #include "dpsim-models/Attribute.h"
+#include <cstring>
 #include <iomanip>
 
+#include <dpsim/Config.h>
+
+#ifdef HAVE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 #include <dpsim-models/Logger.h>
 #include <dpsim/RealTimeDataLogger.h>
 #include <memory>
@@ -14,20 +23,151 @@
 using namespace DPsim;
 
 RealTimeDataLogger::RealTimeDataLogger(std::filesystem::path &filename, size_t rowNumber)
-    : DataLoggerInterface(), mFilename(filename), mRowNumber(rowNumber), mCurrentRow(0), mCurrentAttribute(0), mAttributeData() {}
+    : DataLoggerInterface(), mFilename(filename), mRowNumber(rowNumber), mRowSize(0), mRowsLogged(0), mData(nullptr), mMappedHeader(nullptr), mMappedSize(0) {}
 
 RealTimeDataLogger::RealTimeDataLogger(std::filesystem::path &filename, Real finalTime, Real timeStep)
-    : DataLoggerInterface(), mFilename(filename), mRowNumber((finalTime / timeStep + 0.5)), mCurrentRow(0), mCurrentAttribute(0), mAttributeData() {}
+    : RealTimeDataLogger(filename, static_cast<size_t>(finalTime / timeStep + 0.5)) {}
+
+RealTimeDataLogger::~RealTimeDataLogger() { unmapFile(); }
+
+void RealTimeDataLogger::logAttribute(const String &name, CPS::AttributeBase::Ptr attr, UInt rowsMax, UInt colsMax) {
+  auto base = attr.getPtr().get();
+  if (!dynamic_cast<CPS::Attribute<Real> *>(base) && !dynamic_cast<CPS::Attribute<Int> *>(base) && !dynamic_cast<CPS::Attribute<Complex> *>(base) &&
+      !dynamic_cast<CPS::Attribute<Matrix> *>(base) && !dynamic_cast<CPS::Attribute<MatrixComp> *>(base)) {
+    throw std::runtime_error("RealTimeDataLogger: Unknown attribute type for attribute " + name);
+  }
+  mAttributes[name] = attr;
+  mMatrixLimits[name] = std::make_pair(rowsMax, colsMax);
+}
+
+void RealTimeDataLogger::compileColumns() {
+  mColumns.clear();
+  mColumnNames.clear();
+  // The time is the first value of each row
+  size_t offset = 1;
+
+  for (auto &it : mAttributes) {
+    const String &name = it.first;
+    auto base = it.second.getPtr().get();
+    Column column{Column::Type::Real, base, offset, 1, 1};
+
+    if (dynamic_cast<CPS::Attribute<Real> *>(base)) {
+      mColumnNames.push_back(name);
+    } else if (dynamic_cast<CPS::Attribute<Int> *>(base)) {
+      column.type = Column::Type::Int;
+      mColumnNames.push_back(name);
+    } else if (dynamic_cast<CPS::Attribute<Complex> *>(base)) {
+      column.type = Column::Type::Complex;
+      mColumnNames.push_back(name + ".re");
+      mColumnNames.push_back(name + ".im");
+    } else {
+      auto matrix = dynamic_cast<CPS::Attribute<Matrix> *>(base);
+      auto matrixComp = dynamic_cast<CPS::Attribute<MatrixComp> *>(base);
+      Eigen::Index rows = matrix ? (**matrix).rows() : (**matrixComp).rows();
+      Eigen::Index cols = matrix ? (**matrix).cols() : (**matrixComp).cols();
+
+      auto limits = mMatrixLimits[name];
+      column.type = matrix ? Column::Type::Matrix : Column::Type::MatrixComp;
+      column.rows = (limits.first == 0 || limits.first > rows) ? rows : limits.first;
+      column.cols = (limits.second == 0 || limits.second > cols) ? cols : limits.second;
+
+      // Same names as DataLoggerInterface, but in the column-major order of the values
+      for (Eigen::Index l = 0; l < column.cols; ++l) {
+        for (Eigen::Index k = 0; k < column.rows; ++k) {
+          String coeffName = name;
+          if (rows > 1 || cols > 1)
+            coeffName += "_" + std::to_string(k);
+          if (cols > 1)
+            coeffName += "_" + std::to_string(l);
+
+          if (matrix) {
+            mColumnNames.push_back(coeffName);
+          } else {
+            mColumnNames.push_back(coeffName + ".re");
+            mColumnNames.push_back(coeffName + ".im");
+          }
+        }
+      }
+    }
+
+    mColumns.push_back(column);
+    offset = mColumnNames.size() + 1;
+  }
+  mRowSize = offset;
+}
+
+void RealTimeDataLogger::setMappedFile(const std::filesystem::path &filename) {
+#ifdef HAVE_MMAP
+  mMappedFilename = filename;
+#else
+  throw std::runtime_error("RealTimeDataLogger: Mapped log files are not supported on this platform");
+#endif
+}
+
+void RealTimeDataLogger::mapFile() {
+#ifdef HAVE_MMAP
+  String names = "time";
+  for (auto &name : mColumnNames)
+    names += "," + name;
+  names.resize((names.size() + 7) / 8 * 8, ' ');
+
+  size_t dataOffset = sizeof(MappedFileHeader) + names.size();
+  mMappedSize = dataOffset + mRowNumber * mRowSize * sizeof(Real);
+
+  int fd = ::open(mMappedFilename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0)
+    throw std::runtime_error("Cannot open mapped log file " + mMappedFilename.string());
+  if (::ftruncate(fd, static_cast<off_t>(mMappedSize)) != 0) {
+    ::close(fd);
+    throw std::runtime_error("Cannot resize mapped log file " + mMappedFilename.string());
+  }
+  void *mapping = ::mmap(nullptr, mMappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  // The mapping stays valid after closing the descriptor
+  ::close(fd);
+  if (mapping == MAP_FAILED)
+    throw std::runtime_error("Cannot map log file " + mMappedFilename.string());
+
+  mMappedHeader = static_cast<MappedFileHeader *>(mapping);
+  std::memcpy(mMappedHeader->magic, "DPSIMRTL", sizeof(mMappedHeader->magic));
+  mMappedHeader->columns = mRowSize;
+  mMappedHeader->rows = mRowNumber;
+  mMappedHeader->namesSize = names.size();
+  mMappedHeader->rowsLogged = 0;
+
+  char *namesData = static_cast<char *>(mapping) + sizeof(MappedFileHeader);
+  std::memcpy(namesData, names.data(), names.size());
+  mData = reinterpret_cast<Real *>(static_cast<char *>(mapping) + dataOffset);
+  // Fault in all pages now instead of during the simulation
+  ::madvise(mapping, mMappedSize, MADV_WILLNEED);
+  std::memset(mData, 0, mRowNumber * mRowSize * sizeof(Real));
+#endif
+}
+
+void RealTimeDataLogger::unmapFile() {
+  if (!mMappedHeader)
+    return;
+#ifdef HAVE_MMAP
+  ::msync(mMappedHeader, mMappedSize, MS_SYNC);
+  ::munmap(mMappedHeader, mMappedSize);
+#endif
+  mMappedHeader = nullptr;
+  mData = nullptr;
+}
 
 void RealTimeDataLogger::start() {
-  double mb_size = static_cast<double>(mRowNumber) * (mAttributes.size() + 1) * sizeof(Real);
+  compileColumns();
+  mRowsLogged = 0;
+
+  double mb_size = static_cast<double>(mRowNumber) * mRowSize * sizeof(Real);
   auto log = CPS::Logger::get("RealTimeDataLogger", CPS::Logger::Level::off, CPS::Logger::Level::info);
-  log->info("Preallocating memory for real-time data logger: {} rows for {} attributes ({} MB)", mRowNumber, mAttributes.size(), mb_size / (1024 * 1024));
+  log->info("Preallocating memory for real-time data logger: {} rows for {} columns ({} MB)", mRowNumber, mRowSize - 1, mb_size / (1024 * 1024));
+
   // We are doing real time so preallocate everything
-  mAttributeData.resize(mRowNumber);
-  for (auto &it : mAttributeData) {
-    // We have to add one to the size because we also log the time
-    it.resize(mAttributes.size() + 1);
+  if (!mMappedFilename.empty()) {
+    mapFile();
+  } else {
+    mBuffer.assign(mRowNumber * mRowSize, 0);
+    mData = mBuffer.data();
   }
 }
 
@@ -38,36 +178,68 @@ void RealTimeDataLogger::stop() {
   }
 
   mLogFile << std::right << std::setw(14) << "time";
-  for (auto it : mAttributes)
-    mLogFile << ", " << std::right << std::setw(13) << it.first;
+  for (auto &name : mColumnNames)
+    mLogFile << ", " << std::right << std::setw(13) << name;
   mLogFile << '\n';
 
-  for (auto row : mAttributeData) {
-    mLogFile << std::scientific << std::right << std::setw(14) << row[0];
-    for (size_t i = 1; i < row.size(); ++i)
-      mLogFile << ", " << std::right << std::setw(13) << row[i];
+  for (size_t row = 0; row < mRowsLogged; ++row) {
+    const Real *values = mData + row * mRowSize;
+    mLogFile << std::scientific << std::right << std::setw(14) << values[0];
+    for (size_t i = 1; i < mRowSize; ++i)
+      mLogFile << ", " << std::right << std::setw(13) << values[i];
     mLogFile << '\n';
   }
   mLogFile.close();
+
+  unmapFile();
 }
 
 void RealTimeDataLogger::log(Real time, Int timeStepCount) {
-  mCurrentRow = timeStepCount;
   if (timeStepCount < 0 || static_cast<size_t>(timeStepCount) >= mRowNumber) {
     throw std::runtime_error("RealTimeDataLogger: timeStepCount out of bounds. Please verify the logger was initialized correctly.");
   }
-  if (mAttributeData.size() != mRowNumber || mAttributeData[mCurrentRow].size() != mAttributes.size() + 1) {
-    throw std::runtime_error("RealTimeDataLogger: Attribute data size mismatch");
+  if (!mData) {
+    throw std::runtime_error("RealTimeDataLogger: Logger was not started");
   }
-  mAttributeData[mCurrentRow][0] = time;
-  mCurrentAttribute = 1;
-
-  for (auto it : mAttributes) {
-    if (it.second->getType() == typeid(Real)) {
-      mAttributeData[mCurrentRow][mCurrentAttribute++] = **std::dynamic_pointer_cast<std::shared_ptr<CPS::Attribute<Real>>>(it.second.getPtr());
-    } else if (it.second->getType() == typeid(Int)) {
-      mAttributeData[mCurrentRow][mCurrentAttribute++] = **std::dynamic_pointer_cast<std::shared_ptr<CPS::Attribute<Int>>>(it.second.getPtr());
+  Real *row = mData + static_cast<size_t>(timeStepCount) * mRowSize;
+  row[0] = time;
+
+  for (auto &column : mColumns) {
+    Real *values = row + column.offset;
+    switch (column.type) {
+    case Column::Type::Real:
+      *values = **static_cast<CPS::Attribute<Real> *>(column.attribute);
+      break;
+    case Column::Type::Int:
+      *values = static_cast<Real>(**static_cast<CPS::Attribute<Int> *>(column.attribute));
+      break;
+    case Column::Type::Complex:
+      std::memcpy(values, &**static_cast<CPS::Attribute<Complex> *>(column.attribute), sizeof(Complex));
+      break;
+    case Column::Type::Matrix: {
+      const Matrix &matrix = **static_cast<CPS::Attribute<Matrix> *>(column.attribute);
+      if (matrix.rows() < column.rows || matrix.cols() < column.cols)
+        throw std::runtime_error("RealTimeDataLogger: Matrix size changed after start");
+      // Column-major, so the logged part of each matrix column is contiguous
+      for (Eigen::Index l = 0; l < column.cols; ++l)
+        std::memcpy(values + l * column.rows, matrix.data() + l * matrix.rows(), column.rows * sizeof(Real));
+      break;
     }
+    case Column::Type::MatrixComp: {
+      const MatrixComp &matrix = **static_cast<CPS::Attribute<MatrixComp> *>(column.attribute);
+      if (matrix.rows() < column.rows || matrix.cols() < column.cols)
+        throw std::runtime_error("RealTimeDataLogger: Matrix size changed after start");
+      for (Eigen::Index l = 0; l < column.cols; ++l)
+        std::memcpy(values + 2 * l * column.rows, matrix.data() + l * matrix.rows(), column.rows * sizeof(Complex));
+      break;
+    }
+    }
+  }
+
+  if (static_cast<size_t>(timeStepCount) >= mRowsLogged) {
+    mRowsLogged = static_cast<size_t>(timeStepCount) + 1;
+    if (mMappedHeader)
+      mMappedHeader->rowsLogged = mRowsLogged;
   }
 }
 
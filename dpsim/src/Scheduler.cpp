@@ -21,23 +21,89 @@ CPS::AttributeBase::Ptr Scheduler::external;
 void Scheduler::initMeasurements(const Task::List &tasks) {
   // Fill map here already since it's not protected by a mutex
   for (auto task : tasks) {
-    mMeasurements[task.get()] = std::vector<TaskTime>();
+    mMeasurements[task.get()] = std::make_unique<TaskMeasurement>();
   }
 }
 
 void Scheduler::updateMeasurement(Task *ptr, TaskTime time) {
-  mMeasurements[ptr].push_back(time);
+  auto it = mMeasurements.find(ptr);
+  if (it == mMeasurements.end())
+    return;
+  it->second->histogram.record(time);
+  it->second->last.store(time.count(), std::memory_order_relaxed);
+}
+
+void Scheduler::initThreadMeasurements(Int threads) {
+  mThreadMeasurements.clear();
+  for (Int thread = 0; thread < threads; thread++)
+    mThreadMeasurements.push_back(std::make_unique<ThreadMeasurement>());
+}
+
+void Scheduler::updateThreadIdle(Int thread, TaskTime time) {
+  auto &idle = mThreadMeasurements[thread]->idle;
+  idle.store(idle.load(std::memory_order_relaxed) + time.count(),
+             std::memory_order_relaxed);
+}
+
+void Scheduler::updateThreadSpin(Int thread, TaskTime time) {
+  auto &spin = mThreadMeasurements[thread]->spin;
+  spin.store(spin.load(std::memory_order_relaxed) + time.count(),
+             std::memory_order_relaxed);
+}
+
+void Scheduler::updateStepMeasurement(TaskTime time) {
+  if (time <= mStepBudget || mMeasurements.empty())
+    return;
+
+  // The task that took longest in this step is considered to be the cause
+  TaskMeasurement *culprit = nullptr;
+  TaskTime::rep longest = -1;
+  for (auto &pair : mMeasurements) {
+    auto last = pair.second->last.load(std::memory_order_relaxed);
+    if (last > longest) {
+      longest = last;
+      culprit = pair.second.get();
+    }
+  }
+  culprit->overruns.fetch_add(1, std::memory_order_relaxed);
+  culprit->overrunTime.fetch_add((time - mStepBudget).count(),
+                                 std::memory_order_relaxed);
+}
+
+std::vector<Scheduler::TaskStatistics> Scheduler::taskStatistics() {
+  std::vector<TaskStatistics> statistics;
+  for (auto &pair : mMeasurements) {
+    auto &meas = *pair.second;
+    TaskStatistics stats;
+    stats.name = pair.first->toString();
+    stats.count = meas.histogram.count();
+    stats.mean = meas.histogram.mean();
+    stats.p50 = meas.histogram.percentile(0.5);
+    stats.p99 = meas.histogram.percentile(0.99);
+    stats.max = meas.histogram.max();
+    stats.overruns = meas.overruns.load(std::memory_order_relaxed);
+    stats.overrunTime =
+        TaskTime(meas.overrunTime.load(std::memory_order_relaxed));
+    statistics.push_back(stats);
+  }
+  return statistics;
+}
+
+std::vector<Scheduler::ThreadStatistics> Scheduler::threadStatistics() {
+  std::vector<ThreadStatistics> statistics;
+  for (auto &meas : mThreadMeasurements) {
+    statistics.push_back({TaskTime(meas->idle.load(std::memory_order_relaxed)),
+                          TaskTime(meas->spin.load(std::memory_order_relaxed))});
+  }
+  return statistics;
 }
 
 void Scheduler::writeMeasurements(String filename) {
+  // Keep the format of name and average readable by readMeasurements
   std::ofstream os(filename);
-  std::unordered_map<String, TaskTime> averages;
   for (auto &pair : mMeasurements) {
-    averages[pair.first->toString()] = getAveragedMeasurement(pair.first);
-  }
-  // TODO think of nicer output format
-  for (auto pair : averages) {
-    os << pair.first << "," << pair.second.count() << std::endl;
+    os << pair.first->toString() << ","
+       << pair.second->histogram.mean().count() << std::endl;
   }
   os.close();
 }
@@ -62,17 +128,30 @@ void Scheduler::readMeasurements(
   }
 }
 
-Scheduler::TaskTime Scheduler::getAveragedMeasurement(CPS::Task *task) {
-  TaskTime avg(0), tot(0);
-
-  for (TaskTime time : mMeasurements[task]) {
-    tot += time;
+void Scheduler::writeStatistics(String filename) {
+  // Tasks fill the execution time columns, threads the idle and spin columns
+  std::ofstream os(filename);
+  os << "name,count,mean,p50,p99,max,overruns,overrun_time,idle,spin"
+     << std::endl;
+  for (auto &stats : taskStatistics()) {
+    os << stats.name << "," << stats.count << "," << stats.mean.count() << ","
+       << stats.p50.count() << "," << stats.p99.count() << ","
+       << stats.max.count() << "," << stats.overruns << ","
+       << stats.overrunTime.count() << ",," << std::endl;
   }
+  auto threads = threadStatistics();
+  for (UInt thread = 0; thread < threads.size(); thread++) {
+    os << "thread_" << thread << ",,,,,,,," << threads[thread].idle.count()
+       << "," << threads[thread].spin.count() << std::endl;
+  }
+  os.close();
+}
 
-  if (!mMeasurements[task].empty())
-    avg = tot / mMeasurements[task].size();
-
-  return avg;
+Scheduler::TaskTime Scheduler::getAveragedMeasurement(CPS::Task *task) {
+  auto it = mMeasurements.find(task);
+  if (it == mMeasurements.end())
+    return TaskTime(0);
+  return it->second->histogram.mean();
 }
 
 void Scheduler::resolveDeps(Task::List &tasks, Edges &inEdges,
@@ -21,7 +21,7 @@ using namespace DPsim;
 void SequentialScheduler::createSchedule(const Task::List &tasks,
                                          const Edges &inEdges,
                                          const Edges &outEdges) {
-  if (mOutMeasurementFile.size() != 0)
+  if (mMeasurementsEnabled)
     Scheduler::initMeasurements(tasks);
   Scheduler::topologicalSort(tasks, inEdges, outEdges, mSchedule);
 
@@ -30,7 +30,7 @@ void SequentialScheduler::createSchedule(const Task::List &tasks,
 }
 
 void SequentialScheduler::step(Real time, Int timeStepCount) {
-  if (mOutMeasurementFile.size() != 0) {
+  if (mMeasurementsEnabled) {
     for (auto task : mSchedule) {
       auto start = std::chrono::steady_clock::now();
       task->execute(time, timeStepCount);
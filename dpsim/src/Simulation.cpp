@@ -82,6 +82,11 @@ void Simulation::initialize() {
 
   schedule();
 
+  // Dependencies have been collected by the scheduler, the update tasks
+  // are not needed anymore for plain references
+  if (mAttributeResolving)
+    resolveAttributes();
+
   mInitialized = true;
 }
 
@@ -102,6 +107,8 @@ template <typename VarType> void Simulation::createSolvers() {
                                                   mLogLevel);
     solver->doInitFromNodesAndTerminals(mInitFromNodesAndTerminals);
     solver->setSolverAndComponentBehaviour(mSolverBehaviour);
+    solver->doPowerflowWarmStart(mPowerflowWarmStart);
+    solver->setPowerflowSkipTolerance(mPowerflowSkipTolerance);
     solver->initialize();
     mSolvers.push_back(solver);
     break;
@@ -146,7 +153,8 @@ template <typename VarType> void Simulation::createMNASolver() {
     if (mTearComponents.size() > 0) {
       // Tear components available, use diakoptics
       solver = std::make_shared<DiakopticsSolver<VarType>>(
-          **mName, subnets[net], mTearComponents, **mTimeStep, mLogLevel);
+          **mName, subnets[net], mTearComponents, **mTimeStep, mLogLevel,
+          mDirectImpl, mDirectLinearSolverConfiguration);
     } else {
       // Default case with lu decomposition from mna factory
       solver = MnaSolverFactory::factory<VarType>(**mName + copySuffix, mDomain,
@@ -158,10 +166,20 @@ template <typename VarType> void Simulation::createMNASolver() {
       solver->doFrequencyParallelization(mFreqParallel);
       solver->setSteadStIniTimeLimit(mSteadStIniTimeLimit);
       solver->setSteadStIniAccLimit(mSteadStIniAccLimit);
+      solver->doSteadStIniVectorLogging(mSteadStIniVectorLogging);
+      solver->setSteadStIniTimeStep(mSteadStIniTimeStep);
+      solver->doSteadStIniExtrapolation(mSteadStIniExtrapolation);
       solver->setSystem(subnets[net]);
       solver->setSolverAndComponentBehaviour(mSolverBehaviour);
       solver->doInitFromNodesAndTerminals(mInitFromNodesAndTerminals);
       solver->doSystemMatrixRecomputation(mSystemMatrixRecomputation);
+      solver->doGeneratorGrouping(mGeneratorGrouping);
+      solver->doLazySwitchedMatrices(mLazySwitchedMatrices);
+      solver->setSwitchedMatrixCacheSize(mSwitchedMatrixCacheSize);
+      solver->doSwitchedMatrixPrewarming(mSwitchedMatrixPrewarming);
+      solver->doVariableTimeStep(mVariableTimeStep);
+      solver->setSwitchEvents(mSwitchEvents);
+      solver->setSymbolicAnalysisCache(mSymbolicAnalysisCache);
       solver->setDirectLinearSolverConfiguration(
           mDirectLinearSolverConfiguration);
       solver->initialize();
@@ -212,9 +230,101 @@ void Simulation::schedule() {
   SPDLOG_LOGGER_INFO(mLog, "Scheduling tasks.");
   prepSchedule();
   mScheduler->createSchedule(mTasks, mTaskInEdges, mTaskOutEdges);
+  // Steps exceeding the time step would be overruns in real-time, unless a
+  // different budget was configured
+  if (!mScheduler->hasStepBudget())
+    mScheduler->setStepBudget(std::chrono::duration_cast<Scheduler::TaskTime>(
+        std::chrono::duration<Real>(**mTimeStep)));
   SPDLOG_LOGGER_INFO(mLog, "Scheduling done.");
 }
 
+void Simulation::resolveAttributes() {
+  UInt resolved = 0, total = 0;
+  auto resolve = [&resolved, &total](const AttributeBase::Map &attributes) {
+    for (auto &attr : attributes) {
+      ++total;
+      if (attr.second->resolve())
+        ++resolved;
+    }
+  };
+
+  for (auto comp : mSystem.mComponents)
+    resolve(comp->attributes());
+  for (auto node : mSystem.mNodes)
+    resolve(node->attributes());
+
+  SPDLOG_LOGGER_INFO(mLog, "Resolved {} of {} attributes.", resolved, total);
+}
+
+namespace {
+void addAttributes(AttributeBase::Map &attributes, const String &path,
+                   IdentifiedObject &object) {
+  for (auto &attr : object.stateAttributes())
+    attributes[path + "." + attr.first] = attr.second;
+}
+
+template <typename VarType>
+void addSubComponentAttributes(AttributeBase::Map &attributes,
+                               const String &path,
+                               const IdentifiedObject::Ptr &object) {
+  auto comp = std::dynamic_pointer_cast<SimPowerComp<VarType>>(object);
+  if (!comp)
+    return;
+
+  for (auto &node : comp->virtualNodes())
+    addAttributes(attributes, path + "/" + node->uid(), *node);
+  for (auto &subComp : comp->subComponents()) {
+    String subPath = path + "/" + subComp->uid();
+    addAttributes(attributes, subPath, *subComp);
+    addSubComponentAttributes<VarType>(attributes, subPath, subComp);
+  }
+}
+} // namespace
+
+AttributeBase::Map Simulation::stateAttributes() {
+  AttributeBase::Map attributes;
+  for (auto node : mSystem.mNodes)
+    addAttributes(attributes, "nodes/" + node->uid(), *node);
+  for (auto comp : mSystem.mComponents) {
+    String path = "components/" + comp->uid();
+    addAttributes(attributes, path, *comp);
+    addSubComponentAttributes<Real>(attributes, path, comp);
+    addSubComponentAttributes<Complex>(attributes, path, comp);
+  }
+  for (UInt idx = 0; idx < mSolvers.size(); ++idx)
+    for (auto &attr : mSolvers[idx]->stateAttributes())
+      attributes["solvers/" + std::to_string(idx) + "." + attr.first] =
+          attr.second;
+  return attributes;
+}
+
+Checkpoint::Ptr Simulation::checkpoint() {
+  auto checkpoint = std::make_shared<Checkpoint>(mTime, mTimeStepCount);
+  checkpoint->capture(stateAttributes());
+  SPDLOG_LOGGER_INFO(mLog, "Captured {} attributes at time {}",
+                     checkpoint->size(), mTime);
+  return checkpoint;
+}
+
+void Simulation::restoreCheckpoint(const Checkpoint &checkpoint) {
+  if (!mInitialized)
+    throw SystemError("Simulation must be started before restoring a "
+                      "checkpoint");
+
+  // The time step the checkpoint was taken with is not part of it
+  if (mVariableTimeStep)
+    throw SystemError("Checkpoints cannot be restored with variable time "
+                      "steps");
+
+  checkpoint.apply(stateAttributes());
+  mTime = checkpoint.time();
+  mTimeStepCount = checkpoint.timeStepCount();
+  // The last step before the checkpoint already handled these events
+  mEvents.skipEvents(mTime - **mTimeStep);
+  SPDLOG_LOGGER_INFO(mLog, "Restored {} attributes at time {}",
+                     checkpoint.size(), mTime);
+}
+
 #ifdef WITH_GRAPHVIZ
 Graph::Graph Simulation::dependencyGraph() {
   if (!mInitialized)
@@ -354,6 +464,18 @@ void Simulation::start() {
   SPDLOG_LOGGER_INFO(mLog, "Time step: {:e}", **mTimeStep);
   SPDLOG_LOGGER_INFO(mLog, "Final time: {:e}", **mFinalTime);
 
+  mTimeStepLevel = 0;
+  mMaxTimeStepLevel = 0;
+  mStepsSinceTimeStepChange = 0;
+  if (mVariableTimeStep) {
+    while (**mTimeStep * static_cast<Real>(2ULL << mMaxTimeStepLevel) <=
+           mMaxTimeStep * (1 + 1e-9))
+      ++mMaxTimeStepLevel;
+    SPDLOG_LOGGER_INFO(mLog, "Variable time step up to: {:e}",
+                       **mTimeStep *
+                           static_cast<Real>(1ULL << mMaxTimeStepLevel));
+  }
+
   // In PF we dont log the initial conditions of the componentes because they are not calculated
   // In dynamic simulations log initial values of attributes (t=0)
   if (mSolverType != Solver::Type::NRP) {
@@ -396,6 +518,21 @@ Real Simulation::next() {
   return mTime;
 }
 
+Real Simulation::stepN(UInt steps) {
+  for (UInt i = 0; i < steps && mTime < **mFinalTime + DOUBLE_EPSILON; ++i)
+    step();
+
+  return mTime;
+}
+
+Real Simulation::runUntil(Real time) {
+  Real endTime = std::min(time, **mFinalTime);
+  while (mTime < endTime + DOUBLE_EPSILON)
+    step();
+
+  return mTime;
+}
+
 void Simulation::run() {
   start();
 
@@ -412,10 +549,20 @@ Real Simulation::step() {
     start = std::chrono::steady_clock::now();
   }
 
-  mEvents.handleEvents(mTime);
-  mScheduler->step(mTime, mTimeStepCount);
+  Bool eventsHandled = mEvents.handleEvents(mTime);
+  if (mScheduler->measurementsEnabled()) {
+    auto stepStart = std::chrono::steady_clock::now();
+    mScheduler->step(mTime, mTimeStepCount);
+    mScheduler->updateStepMeasurement(std::chrono::steady_clock::now() -
+                                      stepStart);
+  } else {
+    mScheduler->step(mTime, mTimeStepCount);
+  }
 
-  mTime += **mTimeStep;
+  if (mVariableTimeStep)
+    mTime += adaptTimeStep(eventsHandled);
+  else
+    mTime += **mTimeStep;
   ++mTimeStepCount;
 
   if (mLogStepTimes) {
@@ -426,6 +573,41 @@ Real Simulation::step() {
   return mTime;
 }
 
+Real Simulation::adaptTimeStep(Bool eventsHandled) {
+  Real error = 0;
+  for (auto solver : mSolvers)
+    error = std::max(error, solver->stepErrorEstimate());
+
+  UInt level = mTimeStepLevel;
+  ++mStepsSinceTimeStepChange;
+  if (eventsHandled) {
+    // Resolve the transient following an event with the smallest time step
+    level = 0;
+  } else if (error > mTimeStepTolerance && level > 0) {
+    --level;
+  } else if (error < mTimeStepTolerance / 4 && level < mMaxTimeStepLevel &&
+             mStepsSinceTimeStepChange > 2) {
+    ++level;
+  }
+
+  // Land on the next event or the final time instead of stepping over it
+  Real nextStop = std::min(mEvents.nextEventTime(), **mFinalTime);
+  while (level > 0 &&
+         mTime + **mTimeStep * static_cast<Real>(1ULL << level) >
+             nextStop + 100e-9)
+    --level;
+
+  if (level != mTimeStepLevel) {
+    mTimeStepLevel = level;
+    mStepsSinceTimeStepChange = 0;
+    for (auto solver : mSolvers)
+      solver->changeTimeStep(currentTimeStep());
+    SPDLOG_LOGGER_DEBUG(mLog, "Time step {:e} at time {:e}", currentTimeStep(),
+                        mTime);
+  }
+  return currentTimeStep();
+}
+
 void Simulation::logStepTimes(String logName) {
   auto stepTimeLog = Logger::get(logName, Logger::Level::info);
   if (!mLogStepTimes) {
@@ -487,6 +669,23 @@ CPS::AttributeBase::Ptr Simulation::getIdObjAttribute(const String &comp,
   }
 }
 
+CPS::Attribute<Matrix>::Ptr Simulation::leftSideVector(UInt solverIdx) {
+  if (!mInitialized)
+    initialize();
+
+  if (solverIdx >= mSolvers.size())
+    throw SystemError("Simulation has no solver with index " +
+                      std::to_string(solverIdx));
+  if (auto solver =
+          std::dynamic_pointer_cast<MnaSolver<Real>>(mSolvers[solverIdx]))
+    return solver->mLeftSideVector;
+  if (auto solver =
+          std::dynamic_pointer_cast<MnaSolver<Complex>>(mSolvers[solverIdx]))
+    return solver->mLeftSideVector;
+  throw SystemError("Solver " + std::to_string(solverIdx) +
+                    " is not an MNA solver");
+}
+
 void Simulation::logIdObjAttribute(const String &comp, const String &attr) {
   CPS::AttributeBase::Ptr attrPtr = getIdObjAttribute(comp, attr);
   String name = comp + "." + attr;
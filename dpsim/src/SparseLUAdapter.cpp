@@ -38,4 +38,9 @@ void SparseLUAdapter::partialRefactorize(
 Matrix SparseLUAdapter::solve(Matrix &mRightHandSideVector) {
   return LUFactorizedSparse.solve(mRightHandSideVector);
 }
+
+void SparseLUAdapter::solve(Matrix &mRightHandSideVector,
+                            Matrix &mLeftHandSideVector) {
+  mLeftHandSideVector = LUFactorizedSparse.solve(mRightHandSideVector);
+}
 } // namespace DPsim
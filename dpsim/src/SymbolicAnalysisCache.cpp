@@ -0,0 +1,81 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <algorithm>
+
+#include <dpsim/SymbolicAnalysisCache.h>
+
+using namespace DPsim;
+
+namespace {
+std::size_t combineHash(std::size_t seed, std::size_t value) {
+  return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+} // namespace
+
+std::shared_ptr<void>
+SymbolicAnalysisCache::analysis(const SparseMatrix &matrix,
+                                const String &options, const Analyze &analyze) {
+  // The pattern of uncompressed matrices contains unused entries
+  if (!matrix.isCompressed())
+    return analyze();
+
+  Int rows = static_cast<Int>(matrix.rows());
+  const Int *outer = matrix.outerIndexPtr();
+  const Int *inner = matrix.innerIndexPtr();
+  Int nonZeros = static_cast<Int>(matrix.nonZeros());
+
+  std::size_t hash = std::hash<String>()(options);
+  hash = combineHash(hash, rows);
+  for (Int idx = 0; idx <= matrix.outerSize(); ++idx)
+    hash = combineHash(hash, outer[idx]);
+  for (Int idx = 0; idx < nonZeros; ++idx)
+    hash = combineHash(hash, inner[idx]);
+
+  // The lock is held during the analysis, so that scenarios started at the
+  // same time wait for the first analysis instead of repeating it
+  std::lock_guard<std::mutex> lock(mMutex);
+  auto range = mEntries.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it) {
+    auto &entry = it->second;
+    if (entry.options == options && entry.rows == rows &&
+        entry.innerIndices.size() == static_cast<std::size_t>(nonZeros) &&
+        std::equal(entry.outerIndices.begin(), entry.outerIndices.end(),
+                   outer) &&
+        std::equal(entry.innerIndices.begin(), entry.innerIndices.end(),
+                   inner)) {
+      ++mHits;
+      return entry.analysis;
+    }
+  }
+
+  ++mMisses;
+  Entry entry{options, rows,
+              std::vector<Int>(outer, outer + matrix.outerSize() + 1),
+              std::vector<Int>(inner, inner + nonZeros), analyze()};
+  auto analysis = entry.analysis;
+  mEntries.emplace(hash, std::move(entry));
+  return analysis;
+}
+
+UInt SymbolicAnalysisCache::hits() const {
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mHits;
+}
+
+UInt SymbolicAnalysisCache::misses() const {
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mMisses;
+}
+
+void SymbolicAnalysisCache::clear() {
+  std::lock_guard<std::mutex> lock(mMutex);
+  mEntries.clear();
+  mHits = 0;
+  mMisses = 0;
+}
@@ -21,6 +21,8 @@ ThreadScheduler::ThreadScheduler(Int threads, String outMeasurementFile,
     throw SchedulingException();
   mTempSchedules.resize(threads);
   mSchedules.resize(threads, nullptr);
+  mMeasurementsEnabled = !outMeasurementFile.empty();
+  initThreadMeasurements(threads);
 }
 
 ThreadScheduler::~ThreadScheduler() {
@@ -71,11 +73,16 @@ void ThreadScheduler::step(Real time, Int timeStepCount) {
   doStep(0);
   // since we don't have a final BarrierTask, wait for all threads to finish
   // their last task explicitly
+  std::chrono::steady_clock::time_point start;
+  if (mMeasurementsEnabled)
+    start = std::chrono::steady_clock::now();
   for (int thread = 1; thread < mNumThreads; thread++) {
     if (mTempSchedules[thread].size() != 0)
       mSchedules[thread][mTempSchedules[thread].size() - 1].endCounter.wait(
           mTimeStepCount + 1);
   }
+  if (mMeasurementsEnabled)
+    updateThreadIdle(0, std::chrono::steady_clock::now() - start);
 }
 
 void ThreadScheduler::stop() {
@@ -102,7 +109,7 @@ void ThreadScheduler::threadFunction(ThreadScheduler *sched, Int idx) {
 }
 
 void ThreadScheduler::doStep(Int thread) {
-  if (mOutMeasurementFile.empty()) {
+  if (!mMeasurementsEnabled) {
     for (size_t i = 0; i != mTempSchedules[thread].size(); i++) {
       ScheduleEntry *entry = &mSchedules[thread][i];
       for (Counter *counter : entry->reqCounters)
@@ -113,9 +120,11 @@ void ThreadScheduler::doStep(Int thread) {
   } else {
     for (size_t i = 0; i != mTempSchedules[thread].size(); i++) {
       ScheduleEntry *entry = &mSchedules[thread][i];
+      auto waitStart = std::chrono::steady_clock::now();
       for (Counter *counter : entry->reqCounters)
         counter->wait(mTimeStepCount + 1);
       auto start = std::chrono::steady_clock::now();
+      updateThreadSpin(thread, start - waitStart);
       entry->task->execute(mTime, mTimeStepCount);
       auto end = std::chrono::steady_clock::now();
       updateMeasurement(entry->task, end - start);
@@ -0,0 +1,214 @@
+/* Copyright 2017-2021 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <dpsim/ThreadWorkStealingScheduler.h>
+
+using namespace CPS;
+using namespace DPsim;
+
+// Number of unsuccessful attempts to find work before an idle thread
+// yields its time slice
+static const Int SPINS_BEFORE_YIELD = 64;
+
+ThreadWorkStealingScheduler::ThreadWorkStealingScheduler(
+    Int threads, String outMeasurementFile, Bool useConditionVariables)
+    : mNumThreads(threads), mOutMeasurementFile(outMeasurementFile),
+      mStartBarrier(threads, useConditionVariables),
+      mEndBarrier(threads, useConditionVariables) {
+  if (threads < 1)
+    throw SchedulingException();
+  mInitialTasks.resize(threads);
+  for (Int thread = 0; thread < threads; thread++)
+    mQueues.push_back(std::make_unique<WorkerQueue>());
+  mMeasurementsEnabled = !outMeasurementFile.empty();
+  initThreadMeasurements(threads);
+}
+
+ThreadWorkStealingScheduler::~ThreadWorkStealingScheduler() {
+  // Release the helper threads if the simulation was not stopped
+  if (!mThreads.empty()) {
+    mJoining = true;
+    mStartBarrier.wait();
+    for (auto &thread : mThreads)
+      thread.join();
+  }
+}
+
+void ThreadWorkStealingScheduler::createSchedule(const Task::List &tasks,
+                                                 const Edges &inEdges,
+                                                 const Edges &outEdges) {
+  Task::List ordered;
+
+  Scheduler::topologicalSort(tasks, inEdges, outEdges, ordered);
+  Scheduler::initMeasurements(ordered);
+
+  std::unordered_map<Task::Ptr, UInt> indices;
+  for (UInt idx = 0; idx < ordered.size(); idx++)
+    indices[ordered[idx]] = idx;
+
+  // Edges to tasks that are not part of the schedule, e.g. the root task,
+  // are ignored. Duplicate edges are kept, as they are counted on both ends.
+  mTasks = std::vector<TaskEntry>(ordered.size());
+  for (UInt idx = 0; idx < ordered.size(); idx++) {
+    auto &task = ordered[idx];
+    mTasks[idx].task = task.get();
+    if (outEdges.find(task) == outEdges.end())
+      continue;
+    for (auto &after : outEdges.at(task)) {
+      auto afterIdx = indices.find(after);
+      if (afterIdx == indices.end())
+        continue;
+      mTasks[idx].successors.push_back(afterIdx->second);
+      mTasks[afterIdx->second].inDegree++;
+    }
+  }
+
+  // Distribute the tasks without predecessors in topological order
+  Int thread = 0;
+  for (UInt idx = 0; idx < mTasks.size(); idx++) {
+    if (mTasks[idx].inDegree == 0) {
+      mInitialTasks[thread].push_back(idx);
+      thread = (thread + 1) % mNumThreads;
+    }
+  }
+
+  for (Int i = 1; i < mNumThreads; i++) {
+    mThreads.emplace_back(threadFunction, this, i);
+  }
+}
+
+void ThreadWorkStealingScheduler::step(Real time, Int timeStepCount) {
+  mTime = time;
+  mTimeStepCount = timeStepCount;
+
+  // The other threads are waiting at the start barrier, so the state can
+  // be reset without synchronization
+  for (auto &entry : mTasks)
+    entry.pending.store(entry.inDegree, std::memory_order_relaxed);
+  for (Int thread = 0; thread < mNumThreads; thread++) {
+    auto &queue = mQueues[thread]->tasks;
+    queue.assign(mInitialTasks[thread].begin(), mInitialTasks[thread].end());
+  }
+  mRemaining.store(static_cast<Int>(mTasks.size()), std::memory_order_relaxed);
+
+  mStartBarrier.wait();
+  doStep(0);
+  waitForStepEnd(0);
+}
+
+void ThreadWorkStealingScheduler::stop() {
+  if (!mThreads.empty()) {
+    mJoining = true;
+    mStartBarrier.wait();
+    for (auto &thread : mThreads)
+      thread.join();
+    mThreads.clear();
+  }
+  if (!mOutMeasurementFile.empty()) {
+    writeMeasurements(mOutMeasurementFile);
+  }
+}
+
+void ThreadWorkStealingScheduler::threadFunction(
+    ThreadWorkStealingScheduler *sched, Int idx) {
+  while (true) {
+    sched->mStartBarrier.wait();
+    if (sched->mJoining)
+      return;
+
+    sched->doStep(idx);
+    sched->waitForStepEnd(idx);
+  }
+}
+
+void ThreadWorkStealingScheduler::waitForStepEnd(Int thread) {
+  if (!mMeasurementsEnabled) {
+    mEndBarrier.wait();
+    return;
+  }
+  auto start = std::chrono::steady_clock::now();
+  mEndBarrier.wait();
+  updateThreadIdle(thread, std::chrono::steady_clock::now() - start);
+}
+
+void ThreadWorkStealingScheduler::doStep(Int thread) {
+  Int spins = 0;
+  UInt task;
+  // Start of the current search for work, only used for measurements
+  std::chrono::steady_clock::time_point spinStart;
+  Bool spinning = false;
+
+  while (mRemaining.load(std::memory_order_acquire) > 0) {
+    if (popTask(thread, task) || stealTask(thread, task)) {
+      if (spinning) {
+        updateThreadSpin(thread, std::chrono::steady_clock::now() - spinStart);
+        spinning = false;
+      }
+      executeTask(thread, task);
+      spins = 0;
+    } else {
+      if (mMeasurementsEnabled && !spinning) {
+        spinStart = std::chrono::steady_clock::now();
+        spinning = true;
+      }
+      if (++spins >= SPINS_BEFORE_YIELD) {
+        std::this_thread::yield();
+        spins = 0;
+      }
+    }
+  }
+  if (spinning)
+    updateThreadSpin(thread, std::chrono::steady_clock::now() - spinStart);
+}
+
+Bool ThreadWorkStealingScheduler::popTask(Int thread, UInt &task) {
+  auto &queue = *mQueues[thread];
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  if (queue.tasks.empty())
+    return false;
+  task = queue.tasks.back();
+  queue.tasks.pop_back();
+  return true;
+}
+
+Bool ThreadWorkStealingScheduler::stealTask(Int thread, UInt &task) {
+  for (Int i = 1; i < mNumThreads; i++) {
+    auto &queue = *mQueues[(thread + i) % mNumThreads];
+    std::unique_lock<std::mutex> lock(queue.mutex, std::try_to_lock);
+    if (!lock.owns_lock() || queue.tasks.empty())
+      continue;
+    task = queue.tasks.front();
+    queue.tasks.pop_front();
+    return true;
+  }
+  return false;
+}
+
+void ThreadWorkStealingScheduler::executeTask(Int thread, UInt task) {
+  TaskEntry &entry = mTasks[task];
+
+  if (!mMeasurementsEnabled) {
+    entry.task->execute(mTime, mTimeStepCount);
+  } else {
+    auto start = std::chrono::steady_clock::now();
+    entry.task->execute(mTime, mTimeStepCount);
+    auto end = std::chrono::steady_clock::now();
+    updateMeasurement(entry.task, end - start);
+  }
+
+  // Successors that became ready are pushed to the own deque so that they
+  // are likely executed next by this thread, reusing its cache
+  for (UInt after : entry.successors) {
+    if (mTasks[after].pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      auto &queue = *mQueues[thread];
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      queue.tasks.push_back(after);
+    }
+  }
+  mRemaining.fetch_sub(1, std::memory_order_acq_rel);
+}
@@ -14,11 +14,37 @@
 #include <dpsim/pybind/BaseComponents.h>
 #include <dpsim/pybind/Utils.h>
 
+#include <pybind11/complex.h>
+#include <pybind11/numpy.h>
+
 PYBIND11_DECLARE_HOLDER_TYPE(T, CPS::AttributePointer<T>);
 
 namespace py = pybind11;
 using namespace pybind11::literals;
 
+// Describes the column-major storage of a matrix attribute. For dynamic
+// attributes, get() updates the value before the buffer is handed out.
+template <typename T>
+py::buffer_info matrixBuffer(CPS::Attribute<CPS::MatrixVar<T>> &attr) {
+  auto &mat = attr.get();
+  return py::buffer_info(
+      mat.data(), sizeof(T), py::format_descriptor<T>::format(), 2,
+      {mat.rows(), mat.cols()},
+      {static_cast<py::ssize_t>(sizeof(T)),
+       static_cast<py::ssize_t>(sizeof(T) * mat.rows())});
+}
+
+// NumPy array sharing the memory of the attribute, the attribute is kept
+// alive as base object. The view is invalidated if the matrix is resized.
+template <typename T> py::array matrixView(py::object self) {
+  auto &attr = self.cast<CPS::Attribute<CPS::MatrixVar<T>> &>();
+  auto &mat = attr.get();
+  return py::array_t<T>({mat.rows(), mat.cols()},
+                        {static_cast<py::ssize_t>(sizeof(T)),
+                         static_cast<py::ssize_t>(sizeof(T) * mat.rows())},
+                        mat.data(), self);
+}
+
 void addAttributes(py::module_ m) {
 
   py::class_<CPS::AttributeBase, CPS::AttributePointer<CPS::AttributeBase>>(
@@ -64,7 +90,9 @@ void addAttributes(py::module_ m) {
 
   py::class_<CPS::Attribute<CPS::Matrix>,
              CPS::AttributePointer<CPS::Attribute<CPS::Matrix>>,
-             CPS::AttributeBase>(m, "AttributeMatrix")
+             CPS::AttributeBase>(m, "AttributeMatrix", py::buffer_protocol())
+      .def_buffer(&matrixBuffer<CPS::Real>)
+      .def("numpy", &matrixView<CPS::Real>)
       .def("get", &CPS::Attribute<CPS::Matrix>::get)
       .def("set", &CPS::Attribute<CPS::Matrix>::set)
       .def("derive_coeff",
@@ -80,7 +108,10 @@ void addAttributes(py::module_ m) {
 
   py::class_<CPS::Attribute<CPS::MatrixComp>,
              CPS::AttributePointer<CPS::Attribute<CPS::MatrixComp>>,
-             CPS::AttributeBase>(m, "AttributeMatrixComp")
+             CPS::AttributeBase>(m, "AttributeMatrixComp",
+                                 py::buffer_protocol())
+      .def_buffer(&matrixBuffer<CPS::Complex>)
+      .def("numpy", &matrixView<CPS::Complex>)
       .def("get", &CPS::Attribute<CPS::MatrixComp>::get)
       .def("set", &CPS::Attribute<CPS::MatrixComp>::set)
       .def("derive_coeff",
@@ -12,13 +12,20 @@
 #include <pybind11/eigen.h>
 #include <pybind11/functional.h>
 #include <pybind11/iostream.h>
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
 #include <DPsim.h>
 #include <dpsim-models/IdentifiedObject.h>
+#include <dpsim/ArrayDataLogger.h>
+#include <dpsim/BinaryDataLogger.h>
 #include <dpsim/RealTimeSimulation.h>
+#include <dpsim/SequentialScheduler.h>
 #include <dpsim/Simulation.h>
+#include <dpsim/ThreadLevelScheduler.h>
+#include <dpsim/ThreadListScheduler.h>
+#include <dpsim/ThreadWorkStealingScheduler.h>
 
 #include <dpsim-models/CSVReader.h>
 
@@ -172,6 +179,98 @@ PYBIND11_MODULE(dpsimpy, m) {
                getPartialRefactorizationMethod)
       .def("get_btf", &DPsim::DirectLinearSolverConfiguration::getBTF);
 
+  // Durations of the scheduler statistics are given in seconds
+  auto toSeconds = [](DPsim::Scheduler::TaskTime time) {
+    return std::chrono::duration<CPS::Real>(time).count();
+  };
+
+  py::class_<DPsim::Scheduler::TaskStatistics>(m, "TaskStatistics")
+      .def_readonly("name", &DPsim::Scheduler::TaskStatistics::name)
+      .def_readonly("count", &DPsim::Scheduler::TaskStatistics::count)
+      .def_property_readonly(
+          "mean",
+          [toSeconds](const DPsim::Scheduler::TaskStatistics &stats) {
+            return toSeconds(stats.mean);
+          })
+      .def_property_readonly(
+          "p50",
+          [toSeconds](const DPsim::Scheduler::TaskStatistics &stats) {
+            return toSeconds(stats.p50);
+          })
+      .def_property_readonly(
+          "p99",
+          [toSeconds](const DPsim::Scheduler::TaskStatistics &stats) {
+            return toSeconds(stats.p99);
+          })
+      .def_property_readonly(
+          "max",
+          [toSeconds](const DPsim::Scheduler::TaskStatistics &stats) {
+            return toSeconds(stats.max);
+          })
+      .def_readonly("overruns", &DPsim::Scheduler::TaskStatistics::overruns)
+      .def_property_readonly(
+          "overrun_time",
+          [toSeconds](const DPsim::Scheduler::TaskStatistics &stats) {
+            return toSeconds(stats.overrunTime);
+          });
+
+  py::class_<DPsim::Scheduler::ThreadStatistics>(m, "ThreadStatistics")
+      .def_property_readonly(
+          "idle",
+          [toSeconds](const DPsim::Scheduler::ThreadStatistics &stats) {
+            return toSeconds(stats.idle);
+          })
+      .def_property_readonly(
+          "spin",
+          [toSeconds](const DPsim::Scheduler::ThreadStatistics &stats) {
+            return toSeconds(stats.spin);
+          });
+
+  py::class_<DPsim::Scheduler, std::shared_ptr<DPsim::Scheduler>>(m,
+                                                                 "Scheduler")
+      .def("do_measurements", &DPsim::Scheduler::doMeasurements,
+           "value"_a = true)
+      .def("set_step_budget",
+           [](DPsim::Scheduler &sched, CPS::Real budget) {
+             sched.setStepBudget(
+                 std::chrono::duration_cast<DPsim::Scheduler::TaskTime>(
+                     std::chrono::duration<CPS::Real>(budget)));
+           })
+      .def("task_statistics", &DPsim::Scheduler::taskStatistics)
+      .def("thread_statistics", &DPsim::Scheduler::threadStatistics)
+      .def("write_statistics", &DPsim::Scheduler::writeStatistics,
+           "filename"_a);
+
+  py::class_<DPsim::SequentialScheduler, DPsim::Scheduler,
+             std::shared_ptr<DPsim::SequentialScheduler>>(
+      m, "SequentialScheduler")
+      .def(py::init<std::string, CPS::Logger::Level>(),
+           "out_measurement_file"_a = "",
+           "loglevel"_a = CPS::Logger::Level::info);
+
+  py::class_<DPsim::ThreadLevelScheduler, DPsim::Scheduler,
+             std::shared_ptr<DPsim::ThreadLevelScheduler>>(
+      m, "ThreadLevelScheduler")
+      .def(py::init<CPS::Int, std::string, std::string, CPS::Bool,
+                    CPS::Bool>(),
+           "threads"_a = 1, "out_measurement_file"_a = "",
+           "in_measurement_file"_a = "", "use_condition_variables"_a = false,
+           "sort_task_types"_a = false);
+
+  py::class_<DPsim::ThreadListScheduler, DPsim::Scheduler,
+             std::shared_ptr<DPsim::ThreadListScheduler>>(
+      m, "ThreadListScheduler")
+      .def(py::init<CPS::Int, std::string, std::string, CPS::Bool>(),
+           "threads"_a = 1, "out_measurement_file"_a = "",
+           "in_measurement_file"_a = "", "use_condition_variables"_a = false);
+
+  py::class_<DPsim::ThreadWorkStealingScheduler, DPsim::Scheduler,
+             std::shared_ptr<DPsim::ThreadWorkStealingScheduler>>(
+      m, "ThreadWorkStealingScheduler")
+      .def(py::init<CPS::Int, std::string, CPS::Bool>(), "threads"_a = 1,
+           "out_measurement_file"_a = "",
+           "use_condition_variables"_a = false);
+
   py::class_<DPsim::Simulation>(m, "Simulation")
       .def(py::init<std::string, CPS::Logger::Level>(), "name"_a,
            "loglevel"_a = CPS::Logger::Level::off)
@@ -180,12 +279,32 @@ PYBIND11_MODULE(dpsimpy, m) {
       .def("set_final_time", &DPsim::Simulation::setFinalTime)
       .def("add_logger", &DPsim::Simulation::addLogger)
       .def("set_system", &DPsim::Simulation::setSystem)
-      .def("run", &DPsim::Simulation::run)
+      // The simulation loop does not call back into Python, so other Python
+      // threads can run while the simulation advances
+      .def("run", &DPsim::Simulation::run,
+           py::call_guard<py::gil_scoped_release>())
       .def("set_solver", &DPsim::Simulation::setSolverType)
       .def("set_domain", &DPsim::Simulation::setDomain)
-      .def("start", &DPsim::Simulation::start)
-      .def("next", &DPsim::Simulation::next)
-      .def("stop", &DPsim::Simulation::stop)
+      .def("start", &DPsim::Simulation::start,
+           py::call_guard<py::gil_scoped_release>())
+      .def("next", &DPsim::Simulation::next,
+           py::call_guard<py::gil_scoped_release>())
+      .def("step_n", &DPsim::Simulation::stepN, "n"_a,
+           py::call_guard<py::gil_scoped_release>())
+      .def("run_until", &DPsim::Simulation::runUntil, "time"_a,
+           py::call_guard<py::gil_scoped_release>())
+      .def("stop", &DPsim::Simulation::stop,
+           py::call_guard<py::gil_scoped_release>())
+      .def("save_checkpoint", &DPsim::Simulation::saveCheckpoint,
+           "filename"_a)
+      .def("restore_checkpoint",
+           py::overload_cast<const DPsim::String &>(
+               &DPsim::Simulation::restoreCheckpoint),
+           "filename"_a)
+      .def("set_scheduler", &DPsim::Simulation::setScheduler, "scheduler"_a)
+      .def("scheduler", &DPsim::Simulation::scheduler)
+      .def("left_side_vector", &DPsim::Simulation::leftSideVector,
+           "solver"_a = 0)
       .def("get_idobj_attr", &DPsim::Simulation::getIdObjAttribute, "comp"_a,
            "attr"_a)
       .def("add_interface", &DPsim::Simulation::addInterface, "interface"_a)
@@ -197,11 +316,39 @@ PYBIND11_MODULE(dpsimpy, m) {
            &DPsim::Simulation::doInitFromNodesAndTerminals)
       .def("do_system_matrix_recomputation",
            &DPsim::Simulation::doSystemMatrixRecomputation)
+      .def("do_generator_grouping", &DPsim::Simulation::doGeneratorGrouping,
+           "value"_a = true)
+      .def("do_lazy_switched_matrices",
+           &DPsim::Simulation::doLazySwitchedMatrices)
+      .def("set_switched_matrix_cache_size",
+           &DPsim::Simulation::setSwitchedMatrixCacheSize)
+      .def("do_switched_matrix_prewarming",
+           &DPsim::Simulation::doSwitchedMatrixPrewarming)
+      .def("do_powerflow_warm_start", &DPsim::Simulation::doPowerflowWarmStart,
+           "value"_a = true)
+      .def("set_powerflow_skip_tolerance",
+           &DPsim::Simulation::setPowerflowSkipTolerance)
+      .def("do_variable_time_step", &DPsim::Simulation::doVariableTimeStep,
+           "value"_a = true)
+      .def("set_max_time_step", &DPsim::Simulation::setMaxTimeStep)
+      .def("set_time_step_tolerance",
+           &DPsim::Simulation::setTimeStepTolerance)
+      .def("add_switch_configuration",
+           &DPsim::Simulation::addSwitchConfiguration, "switch_time"_a,
+           "system_index"_a)
       .def("do_steady_state_init", &DPsim::Simulation::doSteadyStateInit)
+      .def("do_steady_state_init_vector_logging",
+           &DPsim::Simulation::doSteadStIniVectorLogging)
+      .def("set_steady_state_init_time_step",
+           &DPsim::Simulation::setSteadStIniTimeStep)
+      .def("do_steady_state_init_extrapolation",
+           &DPsim::Simulation::doSteadStIniExtrapolation)
       .def("do_frequency_parallelization",
            &DPsim::Simulation::doFrequencyParallelization)
       .def("do_split_subnets",
            &DPsim::Simulation::doSplitSubnets)
+      .def("do_attribute_resolving",
+           &DPsim::Simulation::doAttributeResolving, "value"_a = true)
       .def("set_tearing_components", &DPsim::Simulation::setTearingComponents)
       .def("add_event", &DPsim::Simulation::addEvent)
       .def("set_solver_component_behaviour",
@@ -223,7 +370,8 @@ PYBIND11_MODULE(dpsimpy, m) {
       .def("set_system", &DPsim::RealTimeSimulation::setSystem)
       .def("run",
            static_cast<void (DPsim::RealTimeSimulation::*)(CPS::Int startIn)>(
-               &DPsim::RealTimeSimulation::run))
+               &DPsim::RealTimeSimulation::run),
+           py::call_guard<py::gil_scoped_release>())
       .def("set_solver", &DPsim::RealTimeSimulation::setSolverType)
       .def("set_domain", &DPsim::RealTimeSimulation::setDomain);
 
@@ -320,6 +468,79 @@ PYBIND11_MODULE(dpsimpy, m) {
              logger.logAttribute(names, comp.attribute(attr));
            });
 
+  py::class_<DPsim::BinaryDataLogger, DPsim::DataLoggerInterface,
+             std::shared_ptr<DPsim::BinaryDataLogger>>(m, "BinaryLogger")
+      .def(py::init<std::string, CPS::Bool, CPS::UInt, CPS::UInt>(), "name"_a,
+           "enabled"_a = true, "downsampling"_a = 1, "chunk_rows"_a = 4096)
+      .def("filename",
+           [](DPsim::BinaryDataLogger &logger) {
+             return logger.filename().string();
+           })
+      .def("log_attribute",
+           py::overload_cast<const CPS::String &, CPS::AttributeBase::Ptr,
+                             CPS::UInt, CPS::UInt>(
+               &DPsim::BinaryDataLogger::logAttribute),
+           "name"_a, "attr"_a, "max_cols"_a = 0, "max_rows"_a = 0)
+      .def("log_attribute",
+           py::overload_cast<const std::vector<CPS::String> &,
+                             CPS::AttributeBase::Ptr>(
+               &DPsim::BinaryDataLogger::logAttribute),
+           "names"_a, "attr"_a)
+      .def(
+          "log_attribute",
+          [](DPsim::BinaryDataLogger &logger, const CPS::String &name,
+             const CPS::String &attr, const CPS::IdentifiedObject &comp,
+             CPS::UInt rowsMax, CPS::UInt colsMax) {
+            logger.logAttribute(name, comp.attribute(attr), rowsMax, colsMax);
+          },
+          "name"_a, "attr"_a, "comp"_a, "rows_max"_a = 0, "cols_max"_a = 0);
+
+  py::class_<DPsim::ArrayDataLogger, DPsim::DataLoggerInterface,
+             std::shared_ptr<DPsim::ArrayDataLogger>>(m, "ArrayLogger")
+      .def(py::init<std::string, CPS::UInt, CPS::UInt>(), "name"_a,
+           "capacity"_a, "downsampling"_a = 1)
+      .def("rows", &DPsim::ArrayDataLogger::rows)
+      .def("capacity", &DPsim::ArrayDataLogger::capacity)
+      .def("dropped_rows", &DPsim::ArrayDataLogger::droppedRows)
+      .def("column_names", &DPsim::ArrayDataLogger::columnNames)
+      .def("reset", &DPsim::ArrayDataLogger::reset)
+      // View of the recorded rows without copying. The view owns a
+      // reference to the array, so it stays valid after a restart, but its
+      // rows are overwritten by the next run if the columns are unchanged.
+      .def("data",
+           [](std::shared_ptr<DPsim::ArrayDataLogger> logger) {
+             auto buffer = new std::shared_ptr<CPS::MatrixRow>(
+                 logger->dataBuffer());
+             py::capsule owner(buffer, [](void *ptr) {
+               delete static_cast<std::shared_ptr<CPS::MatrixRow> *>(ptr);
+             });
+             auto &data = **buffer;
+             return py::array_t<CPS::Real>(
+                 {static_cast<py::ssize_t>(logger->rows()),
+                  static_cast<py::ssize_t>(data.cols())},
+                 {static_cast<py::ssize_t>(sizeof(CPS::Real) * data.cols()),
+                  static_cast<py::ssize_t>(sizeof(CPS::Real))},
+                 data.data(), owner);
+           })
+      .def("log_attribute",
+           py::overload_cast<const CPS::String &, CPS::AttributeBase::Ptr,
+                             CPS::UInt, CPS::UInt>(
+               &DPsim::ArrayDataLogger::logAttribute),
+           "name"_a, "attr"_a, "max_cols"_a = 0, "max_rows"_a = 0)
+      .def("log_attribute",
+           py::overload_cast<const std::vector<CPS::String> &,
+                             CPS::AttributeBase::Ptr>(
+               &DPsim::ArrayDataLogger::logAttribute),
+           "names"_a, "attr"_a)
+      .def(
+          "log_attribute",
+          [](DPsim::ArrayDataLogger &logger, const CPS::String &name,
+             const CPS::String &attr, const CPS::IdentifiedObject &comp,
+             CPS::UInt rowsMax, CPS::UInt colsMax) {
+            logger.logAttribute(name, comp.attribute(attr), rowsMax, colsMax);
+          },
+          "name"_a, "attr"_a, "comp"_a, "rows_max"_a = 0, "cols_max"_a = 0);
+
   py::class_<CPS::IdentifiedObject, std::shared_ptr<CPS::IdentifiedObject>>(
       m, "IdentifiedObject")
       .def("name", &CPS::IdentifiedObject::name)
@@ -339,7 +560,15 @@ PYBIND11_MODULE(dpsimpy, m) {
       .def("loadCIM", (CPS::SystemTopology(CPS::CIM::Reader::*)(
                           CPS::Real, const std::list<CPS::String> &,
                           CPS::Domain, CPS::PhaseType, CPS::GeneratorType)) &
-                          CPS::CIM::Reader::loadCIM);
+                          CPS::CIM::Reader::loadCIM)
+      .def("use_parallel_import", &CPS::CIM::Reader::useParallelImport,
+           "value"_a = true, "threads"_a = 0)
+      .def(
+          "set_cache_directory",
+          [](CPS::CIM::Reader &reader, const CPS::String &directory) {
+            reader.setCacheDirectory(directory);
+          },
+          "directory"_a);
 #endif
 
   py::class_<CPS::CSVReader>(m, "CSVReader")
@@ -0,0 +1,68 @@
+import struct
+
+import numpy as np
+
+MAGIC = b'DPSIMBIN'
+VERSION = 2
+BYTE_ORDER_MARK = 0x01020304
+
+
+def read_binary_log(filename):
+    """Read a log file written by dpsimpy.BinaryLogger.
+
+    Returns a dict mapping the column names, including 'time',
+    to numpy arrays.
+    """
+    with open(filename, 'rb') as f:
+        data = f.read()
+
+    if data[:len(MAGIC)] != MAGIC:
+        raise ValueError('%s is not a DPsim binary log file' % filename)
+    pos = len(MAGIC)
+
+    # The values are stored in the byte order of the writing host
+    (mark,) = struct.unpack_from('<I', data, pos)
+    if mark == BYTE_ORDER_MARK:
+        order = '<'
+    elif mark == struct.unpack('>I', struct.pack('<I', BYTE_ORDER_MARK))[0]:
+        order = '>'
+    else:
+        raise ValueError('Invalid byte order mark in %s' % filename)
+    pos += 4
+
+    version, num_columns, chunk_rows = struct.unpack_from(order + 'III', data, pos)
+    pos += 12
+    if version != VERSION:
+        raise ValueError('Unsupported binary log version %d' % version)
+
+    names = []
+    for _ in range(num_columns):
+        (length,) = struct.unpack_from(order + 'I', data, pos)
+        pos += 4
+        names.append(data[pos:pos + length].decode('utf-8'))
+        pos += length
+
+    chunks = [[] for _ in range(num_columns)]
+    while pos + 4 <= len(data):
+        (rows,) = struct.unpack_from(order + 'I', data, pos)
+        pos += 4
+        # A chunk cut off by an aborted simulation is skipped
+        if pos + num_columns * rows * 8 > len(data):
+            break
+        for col in range(num_columns):
+            chunks[col].append(np.frombuffer(data, dtype=order + 'f8', count=rows, offset=pos))
+            pos += rows * 8
+
+    return {
+        name: np.concatenate(col) if col else np.empty(0)
+        for name, col in zip(names, chunks)
+    }
+
+
+def read_binary_log_dataframe(filename):
+    """Read a log file written by dpsimpy.BinaryLogger into a pandas DataFrame indexed by time."""
+    import pandas as pd
+
+    columns = read_binary_log(filename)
+    time = columns.pop('time')
+    return pd.DataFrame(columns, index=pd.Index(time, name='time'))